@@ -0,0 +1,43 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file absolute_time.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Helpers for releasing periodic activities at absolute times
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// zephyr
+#include <zephyr/kernel.h>
+
+// std
+#include <chrono>
+
+namespace bike_computer {
+
+// Sleep until the given up time (as returned by zpp_lib::Time::getUpTime()).
+// Releasing periodic activities at absolute times does not accumulate drift,
+// unlike sleeping for a relative duration computed after some processing.
+// Returns immediately if the up time is already passed.
+inline void sleepUntil(const std::chrono::microseconds& upTime) {
+  k_sleep(K_TIMEOUT_ABS_US(upTime.count()));
+}
+
+}  // namespace bike_computer
@@ -25,29 +25,40 @@
 #include "bike_display.hpp"
 
 // zephyr
+#include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 
 // std
-#include <cstdio>
+#include <algorithm>
+#include <cstring>
 
 // zpp_lib
 #include "zpp_include/display.hpp"
 
+// local
+#include "fixed_point_format.hpp"
+#include "frame_buffer.hpp"
+#include "glyph_cache.hpp"
+
 // icons and fonts
 #if CONFIG_SHIELD_ADAFRUIT_2_8_TFT_TOUCH_V2 == 1
-#include "resources/celsius_icon_20.hpp"
-#include "resources/distance_icon_50.hpp"
-#include "resources/gear_icon_50.hpp"
-#include "resources/speedometer_icon_50.hpp"
-#include "resources/thermometer_icon_50.hpp"
+#include "resources/celsius_icon_20_rle.hpp"
+#include "resources/distance_icon_50_rle.hpp"
+#include "resources/font16_packed.hpp"
+#include "resources/font18_packed.hpp"
+#include "resources/gear_icon_50_rle.hpp"
+#include "resources/speedometer_icon_50_rle.hpp"
+#include "resources/thermometer_icon_50_rle.hpp"
 #else
-#include "resources/celsius_icon_32.hpp"
-#include "resources/distance_icon_100.hpp"
-#include "resources/gear_icon_100.hpp"
-#include "resources/speedometer_icon_100.hpp"
-#include "resources/thermometer_icon_100.hpp"
+#include "resources/celsius_icon_32_rle.hpp"
+#include "resources/distance_icon_100_rle.hpp"
+#include "resources/font18_packed.hpp"
+#include "resources/font26b_packed.hpp"
+#include "resources/font36b_packed.hpp"
+#include "resources/gear_icon_100_rle.hpp"
+#include "resources/speedometer_icon_100_rle.hpp"
+#include "resources/thermometer_icon_100_rle.hpp"
 #endif
-#include "resources/fonts.hpp"
 
 LOG_MODULE_DECLARE(bike_computer, CONFIG_APP_LOG_LEVEL);
 
@@ -57,6 +68,10 @@ namespace bike_computer {
 
 // create the Display instance as a global variable (not on stack)
 static zpp_lib::Display gDisplay;
+#if CONFIG_BIKE_DISPLAY_FRAMEBUFFER == 1
+// all drawing is composed in RAM and dirty tiles are sent to the display in bulk
+static FrameBuffer gFrameBuffer;
+#endif
 
 // constants
 static constexpr uint32_t DISPLAY_COLOR_BLUE  = 0xFF0000FFUL;
@@ -64,35 +79,49 @@ static constexpr uint32_t DISPLAY_COLOR_WHITE = 0xFFFFFFFFUL;
 static constexpr uint32_t DISPLAY_COLOR_BLACK = 0x00000000UL;
 #if CONFIG_SHIELD_ADAFRUIT_2_8_TFT_TOUCH_V2 == 1
 static constexpr uint32_t kTitleHeight = 60;
+// fonts used for the title and for each info box
+static constexpr const PackedFont& kTitleFont       = kFont18;
+static constexpr const PackedFont& kGearFont        = kFont18;
+static constexpr const PackedFont& kSpeedFont       = kFont16;
+static constexpr const PackedFont& kDistanceFont    = kFont16;
+static constexpr const PackedFont& kTemperatureFont = kFont16;
+static constexpr uint8_t kGlyphCacheSize            = 16;
 #else
 static constexpr uint32_t kTitleHeight = 112;
+// fonts used for the title and for each info box
+static constexpr const PackedFont& kTitleFont       = kFont18;
+static constexpr const PackedFont& kGearFont        = kFont36b;
+static constexpr const PackedFont& kSpeedFont       = kFont18;
+static constexpr const PackedFont& kDistanceFont    = kFont18;
+static constexpr const PackedFont& kTemperatureFont = kFont26b;
+static constexpr uint8_t kGlyphCacheSize            = 8;
 #endif
 
+// cache of rendered glyphs, large enough for the cells of all fonts in use
+static constexpr uint32_t getCellPixels(const PackedFont& font) {
+  return static_cast<uint32_t>(font.width) * font.height;
+}
+static constexpr uint32_t kMaxGlyphCellPixels =
+    std::max({getCellPixels(kTitleFont),
+              getCellPixels(kGearFont),
+              getCellPixels(kSpeedFont),
+              getCellPixels(kDistanceFont),
+              getCellPixels(kTemperatureFont)});
+static GlyphCache<kGlyphCacheSize, kMaxGlyphCellPixels> gGlyphCache;
+
 // type definitions for logos
 struct Logos {
-  struct ImageInfo {
-    const uint32_t* pImageData;
-    const uint8_t imageWidth;
-    const uint8_t imageHeight;
-  };
-
-  static constexpr uint8_t kNbrOfImages               = 4;
-  static constexpr ImageInfo _imageInfo[kNbrOfImages] = {
-      {.pImageData  = speedometer_icon,
-       .imageWidth  = kSpeedometerIconWidth,
-       .imageHeight = kSpeedometerIconHeight},
-      {.pImageData  = gear_icon,
-       .imageWidth  = kGearIconWidth,
-       .imageHeight = kGearIconHeight},
-      {.pImageData  = thermometer_icon,
-       .imageWidth  = kThermometerIconWidth,
-       .imageHeight = kThermometerIconHeight},
-      {.pImageData  = distance_icon,
-       .imageWidth  = kDistanceIconWidth,
-       .imageHeight = kDistanceIconHeight}};
+  static constexpr uint8_t kNbrOfImages                     = 4;
+  static constexpr CompressedImage _imageInfo[kNbrOfImages] = {
+      speedometer_icon, gear_icon, thermometer_icon, distance_icon};
 };
 static const Logos gLogos;
 
+// compressed images are decoded in chunks of rows into this buffer
+static constexpr uint32_t kNbrOfChunkRows = 4;
+static constexpr uint32_t kMaxImageWidth  = 100;
+static uint32_t gImageChunk[kNbrOfChunkRows * kMaxImageWidth];
+
 zpp_lib::ZephyrResult BikeDisplay::initialize() {
   // initialize the display
   auto res = gDisplay.initialize();
@@ -103,6 +132,14 @@ zpp_lib::ZephyrResult BikeDisplay::initialize() {
     LOG_DBG("Display initialized");
   }
 
+#if CONFIG_BIKE_DISPLAY_FRAMEBUFFER == 1
+  // fall back to direct drawing if the display does not support the frame buffer
+  _isFrameBufferUsed = static_cast<bool>(gFrameBuffer.initialize());
+  if (!_isFrameBufferUsed) {
+    LOG_WRN("Frame buffer not supported, drawing directly to the display");
+  }
+#endif
+
   // compute positions
   computePositions();
 
@@ -113,8 +150,9 @@ zpp_lib::ZephyrResult BikeDisplay::initialize() {
   displayIcons();
 
   // setup font for printing bike info
-  gDisplay.setBackColor(DISPLAY_COLOR_WHITE);
-  gDisplay.setTextColor(DISPLAY_COLOR_BLUE);
+  setColors(DISPLAY_COLOR_BLUE, DISPLAY_COLOR_WHITE);
+
+  flush();
 
   return res;
 }
@@ -156,13 +194,14 @@ void BikeDisplay::computePositions() {
 }
 
 void BikeDisplay::displayTitle() {
-  gDisplay.fillDisplay(DISPLAY_COLOR_WHITE);
-  gDisplay.setTextColor(DISPLAY_COLOR_BLUE);
-  gDisplay.fillRectangle(DISPLAY_COLOR_BLUE, 0, 0, gDisplay.getWidth(), kTitleHeight);
-  gDisplay.setBackColor(DISPLAY_COLOR_BLUE);
-  gDisplay.setTextColor(DISPLAY_COLOR_WHITE);
-  gDisplay.setFont(getFont18());
-  gDisplay.drawStringAtLine(1, "Bike Computer", zpp_lib::Display::AlignMode::CENTER_MODE);
+  fillRectangle(DISPLAY_COLOR_WHITE, 0, 0, gDisplay.getWidth(), gDisplay.getHeight());
+  fillRectangle(DISPLAY_COLOR_BLUE, 0, 0, gDisplay.getWidth(), kTitleHeight);
+  setColors(DISPLAY_COLOR_WHITE, DISPLAY_COLOR_BLUE);
+  _pFont = &kTitleFont;
+  // centered on the first text line
+  static constexpr char kTitle[] = "Bike Computer";
+  const uint32_t titleLen        = (sizeof(kTitle) - 1) * _pFont->width;
+  drawString((gDisplay.getWidth() - titleLen) / 2, _pFont->height, kTitle);
 }
 
 void BikeDisplay::displayIcons() {
@@ -171,108 +210,214 @@ void BikeDisplay::displayIcons() {
   drawHorizontalLine(DISPLAY_COLOR_BLUE, _horLineYPos, kLineWidth);
 
   // draw the speedometer icon
-  gDisplay.drawPicture(
-      _speedometerIconXPos,
-      _speedometerIconYPos,
-      const_cast<uint32_t*>(gLogos._imageInfo[kSpeedometerIndex].pImageData),
-      gLogos._imageInfo[kSpeedometerIndex].imageWidth,
-      gLogos._imageInfo[kSpeedometerIndex].imageHeight);
+  drawImage(
+      _speedometerIconXPos, _speedometerIconYPos, gLogos._imageInfo[kSpeedometerIndex]);
 
   // draw the distance icon
-  gDisplay.drawPicture(
-      _distanceIconXPos,
-      _distanceIconYPos,
-      const_cast<uint32_t*>(gLogos._imageInfo[kDistanceIndex].pImageData),
-      gLogos._imageInfo[kDistanceIndex].imageWidth,
-      gLogos._imageInfo[kDistanceIndex].imageHeight);
+  drawImage(_distanceIconXPos, _distanceIconYPos, gLogos._imageInfo[kDistanceIndex]);
 
   // draw the temperature icon
-  gDisplay.drawPicture(
-      _temperatureIconXPos,
-      _temperatureIconYPos,
-      const_cast<uint32_t*>(gLogos._imageInfo[kTemperatureIndex].pImageData),
-      gLogos._imageInfo[kTemperatureIndex].imageWidth,
-      gLogos._imageInfo[kTemperatureIndex].imageHeight);
+  drawImage(
+      _temperatureIconXPos, _temperatureIconYPos, gLogos._imageInfo[kTemperatureIndex]);
 
   // draw the gear icon
-  gDisplay.drawPicture(_gearIconXPos,
-                       _gearIconYPos,
-                       const_cast<uint32_t*>(gLogos._imageInfo[kGearIndex].pImageData),
-                       gLogos._imageInfo[kGearIndex].imageWidth,
-                       gLogos._imageInfo[kGearIndex].imageHeight);
+  drawImage(_gearIconXPos, _gearIconYPos, gLogos._imageInfo[kGearIndex]);
 }
 
 void BikeDisplay::displayGear(uint8_t gear) {
   char msg[10] = {0};
-  int strlen   = snprintf(msg, sizeof(msg), "%d", gear);
-#if CONFIG_SHIELD_ADAFRUIT_2_8_TFT_TOUCH_V2 == 1
-  gDisplay.setFont(getFont18());
-#else
-  gDisplay.setFont(getFont36b());
-#endif
-  const uint32_t msgLen   = strlen * gDisplay.getFont()->width;
-  const uint32_t textXPos = _gearTextMidXPos - msgLen / 2;
-  const uint32_t textYPos = _gearTextYPos - gDisplay.getFont()->height / 2;
-  gDisplay.drawStringAt(textXPos, textYPos, msg, zpp_lib::Display::AlignMode::LEFT_MODE);
+  int strlen   = fixed_point_format::format(gear, 0, msg, sizeof(msg));
+  _pFont = &kGearFont;
+  updateTextField(_gearField, msg, strlen, _gearTextMidXPos, _gearTextYPos);
 }
 
 void BikeDisplay::displaySpeed(float speed) {
   char msg[10] = {0};
-  int strlen   = snprintf(msg, sizeof(msg), "%.1f", static_cast<double>(speed));
-#if CONFIG_SHIELD_ADAFRUIT_2_8_TFT_TOUCH_V2 == 1
-  gDisplay.setFont(getFont16());
-#else
-  gDisplay.setFont(getFont18());
-#endif
-  const uint32_t msgLen   = strlen * gDisplay.getFont()->width;
-  const uint32_t textXPos = _speedometerTextMidXPos - msgLen / 2;
-  const uint32_t textYPos = _speedometerTextYPos - gDisplay.getFont()->height / 2;
-  gDisplay.drawStringAt(textXPos, textYPos, msg, zpp_lib::Display::AlignMode::LEFT_MODE);
+  int strlen   = fixed_point_format::format(
+      fixed_point_format::toFixedPoint(speed, 1), 1, msg, sizeof(msg));
+  _pFont = &kSpeedFont;
+  updateTextField(
+      _speedField, msg, strlen, _speedometerTextMidXPos, _speedometerTextYPos);
 }
 
 void BikeDisplay::displayDistance(float distance) {
   char msg[10] = {0};
-  int strlen   = snprintf(msg, sizeof(msg), "%.2f", static_cast<double>(distance));
-#if CONFIG_SHIELD_ADAFRUIT_2_8_TFT_TOUCH_V2 == 1
-  gDisplay.setFont(getFont16());
-#else
-  gDisplay.setFont(getFont18());
-#endif
-  const uint32_t msgLen   = strlen * gDisplay.getFont()->width;
-  const uint32_t textXPos = _distanceTextMidXPos - msgLen / 2;
-  const uint32_t textYPos = _distanceTextYPos - gDisplay.getFont()->height / 2;
-  gDisplay.drawStringAt(textXPos, textYPos, msg, zpp_lib::Display::AlignMode::LEFT_MODE);
+  int strlen   = fixed_point_format::format(
+      fixed_point_format::toFixedPoint(distance, 2), 2, msg, sizeof(msg));
+  _pFont = &kDistanceFont;
+  updateTextField(_distanceField, msg, strlen, _distanceTextMidXPos, _distanceTextYPos);
 }
 
 void BikeDisplay::displayTemperature(float temperature) {
   char msg[10] = {0};
-  int strlen   = snprintf(msg, sizeof(msg), "%.1f", static_cast<double>(temperature));
-#if CONFIG_SHIELD_ADAFRUIT_2_8_TFT_TOUCH_V2 == 1
-  gDisplay.setFont(getFont16());
-#else
-  gDisplay.setFont(getFont26b());
-#endif
-  const uint32_t msgLen   = strlen * gDisplay.getFont()->width;
-  const uint32_t textXPos = _temperatureTextMidXPos - msgLen / 2;
-  const uint32_t textYPos = _temperatureTextYPos - gDisplay.getFont()->height / 2;
-  gDisplay.drawStringAt(textXPos, textYPos, msg, zpp_lib::Display::AlignMode::LEFT_MODE);
+  int strlen   = fixed_point_format::format(
+      fixed_point_format::toFixedPoint(temperature, 1), 1, msg, sizeof(msg));
+  _pFont = &kTemperatureFont;
+  // the celsius icon must be cleared before the text is redrawn, since the new
+  // text may overlap its previous position
+  const uint32_t msgLen          = getTextLength(strlen) * _pFont->width;
+  const uint32_t textXPos        = _temperatureTextMidXPos - msgLen / 2;
+  const uint32_t textYPos        = _temperatureTextYPos - _pFont->height / 2;
   const uint32_t celsiusIconXPos = textXPos + msgLen;
   const uint32_t celsiusIconYPos = textYPos - kCelsiusIconHeight / 5;
-  gDisplay.drawPicture(celsiusIconXPos,
-                       celsiusIconYPos,
-                       const_cast<uint32_t*>(celsius_icon),
-                       kCelsiusIconWidth,
-                       kCelsiusIconHeight);
+
+  const bool isIconMoved = !_isCelsiusIconDrawn || celsiusIconXPos != _celsiusIconXPos ||
+                           celsiusIconYPos != _celsiusIconYPos;
+  if (_isCelsiusIconDrawn && isIconMoved) {
+    clearRectangle(
+        _celsiusIconXPos, _celsiusIconYPos, kCelsiusIconWidth, kCelsiusIconHeight);
+  }
+  updateTextField(
+      _temperatureField, msg, strlen, _temperatureTextMidXPos, _temperatureTextYPos);
+  if (isIconMoved) {
+    _isCelsiusIconDrawn = true;
+    _celsiusIconXPos    = celsiusIconXPos;
+    _celsiusIconYPos    = celsiusIconYPos;
+    drawImage(celsiusIconXPos, celsiusIconYPos, celsius_icon);
+  }
 }
 
-void BikeDisplay::drawVerticalLine(uint32_t color, uint32_t xPos, uint32_t width) {
-  for (uint32_t i = kTitleHeight; i < gDisplay.getHeight(); i++) {
-    gDisplay.fillRectangle(color, xPos, i, width, 1);
+void BikeDisplay::updateTextField(TextField& field,
+                                  const char* text,
+                                  int length,
+                                  uint32_t midXPos,
+                                  uint32_t midYPos) {
+  const uint8_t textLength  = getTextLength(length);
+  const uint32_t charWidth  = _pFont->width;
+  const uint32_t charHeight = _pFont->height;
+  const uint32_t xPos       = midXPos - (textLength * charWidth) / 2;
+  const uint32_t yPos       = midYPos - charHeight / 2;
+  const uint32_t oldEndXPos = field.xPos + field.length * charWidth;
+  const uint32_t endXPos    = xPos + textLength * charWidth;
+
+  if (field.length > 0) {
+    if (field.yPos != yPos) {
+      clearRectangle(field.xPos, field.yPos, oldEndXPos - field.xPos, charHeight);
+    } else {
+      // clear the parts of the previous text that are not covered by the new one
+      if (field.xPos < xPos) {
+        clearRectangle(
+            field.xPos, yPos, std::min(xPos, oldEndXPos) - field.xPos, charHeight);
+      }
+      if (oldEndXPos > endXPos) {
+        const uint32_t clearXPos = std::max(endXPos, field.xPos);
+        clearRectangle(clearXPos, yPos, oldEndXPos - clearXPos, charHeight);
+      }
+    }
   }
+
+  // redraw only the character cells whose content changed
+  char glyph[2] = {0};
+  for (uint8_t charIndex = 0; charIndex < textLength; charIndex++) {
+    const uint32_t charXPos = xPos + charIndex * charWidth;
+    if (field.length > 0 && field.yPos == yPos && charXPos >= field.xPos &&
+        charXPos < oldEndXPos && (charXPos - field.xPos) % charWidth == 0 &&
+        field.text[(charXPos - field.xPos) / charWidth] == text[charIndex]) {
+      continue;
+    }
+    glyph[0] = text[charIndex];
+    drawString(charXPos, yPos, glyph);
+  }
+
+  memcpy(field.text, text, textLength);
+  field.length = textLength;
+  field.xPos   = xPos;
+  field.yPos   = yPos;
+}
+
+uint8_t BikeDisplay::getTextLength(int length) {
+  // the formatted length is 0 if the text does not fit in the buffer
+  return static_cast<uint8_t>(std::clamp(length, 0, TextField::kMaxLength - 1));
+}
+
+void BikeDisplay::clearRectangle(uint32_t xPos,
+                                 uint32_t yPos,
+                                 uint32_t width,
+                                 uint32_t height) {
+  if (width == 0 || height == 0) {
+    return;
+  }
+  fillRectangle(DISPLAY_COLOR_WHITE, xPos, yPos, width, height);
+}
+
+void BikeDisplay::drawVerticalLine(uint32_t color, uint32_t xPos, uint32_t width) {
+  fillRectangle(color, xPos, kTitleHeight, width, gDisplay.getHeight() - kTitleHeight);
 }
 
 void BikeDisplay::drawHorizontalLine(uint32_t color, uint32_t yPos, uint32_t width) {
-  gDisplay.fillRectangle(color, 0, yPos, gDisplay.getWidth(), width);
+  fillRectangle(color, 0, yPos, gDisplay.getWidth(), width);
+}
+
+void BikeDisplay::setColors(uint32_t textColor, uint32_t backColor) {
+  gDisplay.setTextColor(textColor);
+  gDisplay.setBackColor(backColor);
+  _textColor = textColor;
+  _backColor = backColor;
+}
+
+void BikeDisplay::fillRectangle(
+    uint32_t color, uint32_t xPos, uint32_t yPos, uint32_t width, uint32_t height) {
+#if CONFIG_BIKE_DISPLAY_FRAMEBUFFER == 1
+  if (_isFrameBufferUsed) {
+    gFrameBuffer.fillRectangle(color, xPos, yPos, width, height);
+    return;
+  }
+#endif
+  gDisplay.fillRectangle(color, xPos, yPos, width, height);
+}
+
+void BikeDisplay::drawPicture(uint32_t xPos,
+                              uint32_t yPos,
+                              const uint32_t* pImageData,
+                              uint32_t width,
+                              uint32_t height) {
+#if CONFIG_BIKE_DISPLAY_FRAMEBUFFER == 1
+  if (_isFrameBufferUsed) {
+    gFrameBuffer.drawPicture(xPos, yPos, pImageData, width, height);
+    return;
+  }
+#endif
+  gDisplay.drawPicture(xPos, yPos, const_cast<uint32_t*>(pImageData), width, height);
+}
+
+void BikeDisplay::drawImage(uint32_t xPos, uint32_t yPos, const CompressedImage& image) {
+  __ASSERT(image.imageWidth <= kMaxImageWidth, "Image too wide: %d", image.imageWidth);
+  CompressedImageDecoder decoder(image);
+  uint32_t rowIndex = 0;
+  while (rowIndex < image.imageHeight) {
+    // decode a chunk of rows and blit it at once
+    uint32_t nbrOfRows = 0;
+    while (nbrOfRows < kNbrOfChunkRows &&
+           decoder.decodeRow(&gImageChunk[nbrOfRows * image.imageWidth])) {
+      nbrOfRows++;
+    }
+    drawPicture(xPos, yPos + rowIndex, gImageChunk, image.imageWidth, nbrOfRows);
+    rowIndex += nbrOfRows;
+  }
+}
+
+void BikeDisplay::drawString(uint32_t xPos, uint32_t yPos, const char* text) {
+  // each character cell is sent as one picture, rendered once in the cache
+  for (; *text != '\0'; text++) {
+    const uint32_t* pPixels =
+        gGlyphCache.getGlyph(*_pFont, *text, _textColor, _backColor);
+    __ASSERT(pPixels != nullptr, "Glyph cell does not fit in the glyph cache");
+    if (pPixels != nullptr) {
+      drawPicture(xPos, yPos, pPixels, _pFont->width, _pFont->height);
+    }
+    xPos += _pFont->width;
+  }
+}
+
+void BikeDisplay::flush() {
+#if CONFIG_BIKE_DISPLAY_FRAMEBUFFER == 1
+  if (_isFrameBufferUsed) {
+    auto res = gFrameBuffer.flush();
+    if (!res) {
+      LOG_ERR("Failed to flush frame buffer: %d", (int)res.error());
+    }
+  }
+#endif  // CONFIG_BIKE_DISPLAY_FRAMEBUFFER == 1
 }
 
 #endif  // CONFIG_DISPLAY == 1
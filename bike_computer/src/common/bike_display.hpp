@@ -27,6 +27,10 @@
 // zpp_lib
 #include "zpp_include/zephyr_result.hpp"
 
+// local
+#include "compressed_image.hpp"
+#include "packed_font.hpp"
+
 namespace bike_computer {
 
 #if CONFIG_DISPLAY == 1
@@ -43,6 +47,10 @@ class BikeDisplay {
   void displaySpeed(float speed);
   void displayDistance(float distance);
   void displayTemperature(float temperature);
+  // send the changes drawn by the display methods to the display in as few bulk
+  // transfers as possible (no effect without frame buffer)
+  // to be called once after a group of display calls
+  void flush();
   void reset();
 
  private:
@@ -55,6 +63,35 @@ class BikeDisplay {
   void drawVerticalLine(uint32_t color, uint32_t xPos, uint32_t width);
   void drawHorizontalLine(uint32_t color, uint32_t yPos, uint32_t width);
 
+  // text displayed in an info box, cached for redrawing only the characters
+  // that changed since the last call
+  struct TextField {
+    static constexpr uint8_t kMaxLength = 10;
+    char text[kMaxLength]               = {0};
+    uint8_t length                      = 0;
+    uint32_t xPos                       = 0;
+    uint32_t yPos                       = 0;
+  };
+  // draw the text centered on (midXPos, midYPos) with the current font
+  void updateTextField(TextField& field,
+                       const char* text,
+                       int length,
+                       uint32_t midXPos,
+                       uint32_t midYPos);
+  static uint8_t getTextLength(int length);
+  void clearRectangle(uint32_t xPos, uint32_t yPos, uint32_t width, uint32_t height);
+  // drawing primitives, composed in the frame buffer if it is used
+  void setColors(uint32_t textColor, uint32_t backColor);
+  void fillRectangle(
+      uint32_t color, uint32_t xPos, uint32_t yPos, uint32_t width, uint32_t height);
+  void drawPicture(uint32_t xPos,
+                   uint32_t yPos,
+                   const uint32_t* pImageData,
+                   uint32_t width,
+                   uint32_t height);
+  void drawImage(uint32_t xPos, uint32_t yPos, const CompressedImage& image);
+  void drawString(uint32_t xPos, uint32_t yPos, const char* text);
+
   static constexpr uint32_t kLineWidth   = 2;
   static constexpr uint32_t kIconXMargin = 20;
 #if CONFIG_SHIELD_ADAFRUIT_2_8_TFT_TOUCH_V2 == 1
@@ -85,6 +122,22 @@ class BikeDisplay {
   uint32_t _distanceIconYPos                 = 0;
   uint32_t _distanceTextMidXPos              = 0;
   uint32_t _distanceTextYPos                 = 0;
+  // last rendered text of each info box
+  TextField _speedField;
+  TextField _gearField;
+  TextField _temperatureField;
+  TextField _distanceField;
+  // position of the celsius icon (valid if _isCelsiusIconDrawn is true)
+  bool _isCelsiusIconDrawn  = false;
+  uint32_t _celsiusIconXPos = 0;
+  uint32_t _celsiusIconYPos = 0;
+  // current font and text colors
+  const PackedFont* _pFont = nullptr;
+  uint32_t _textColor      = 0;
+  uint32_t _backColor      = 0;
+#if CONFIG_BIKE_DISPLAY_FRAMEBUFFER == 1
+  bool _isFrameBufferUsed = false;
+#endif
 };
 
 #else
@@ -98,6 +151,7 @@ class BikeDisplay {
   void displaySpeed(float speed) {}
   void displayDistance(float distance) {}
   void displayTemperature(float temperature) {}
+  void flush() {}
 };
 
 #endif  // CONFIG_DISPLAY == 1
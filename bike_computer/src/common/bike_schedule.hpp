@@ -0,0 +1,45 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file bike_schedule.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Cyclic schedule of the bike system tasks (computed at compile time)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// local
+#include "schedule_synthesizer.hpp"
+#include "task_manager.hpp"
+
+namespace bike_computer {
+
+// bounds used for the schedule synthesis
+static constexpr uint16_t kMaxNbrOfMinorCycles = 16;
+static constexpr uint16_t kMaxMinorCycleSize   = 4;
+
+// schedule synthesized from the TaskManager task set
+// each entry of kBikeSchedule.frames is a TaskManager::TaskType value
+static constexpr auto kBikeSchedule =
+    synthesizeSchedule<kMaxNbrOfMinorCycles, kMaxMinorCycleSize>(
+        TaskManager::kTaskPeriods, TaskManager::kTaskComputationTimes);
+static_assert(kBikeSchedule.isFeasible,
+              "The TaskManager task set cannot be scheduled by a cyclic executive");
+
+}  // namespace bike_computer
@@ -0,0 +1,58 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file bike_state.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief State shared between the bike system tasks
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// local
+#include "constants.hpp"
+#include "snapshot_channel.hpp"
+
+namespace bike_computer {
+
+// each state is published by a single task (producer) and read by other tasks
+// published by the gear task
+struct GearState {
+  uint8_t gear     = kMinGear;
+  uint8_t gearSize = kMinGearSize;
+};
+
+// published by the speed and distance task
+struct SpeedState {
+  float speed    = 0.0f;
+  float distance = 0.0f;
+};
+
+// published by the temperature task
+struct TemperatureState {
+  float temperature = 0.0f;
+};
+
+// consistent view of the bike state, as read by the display tasks
+struct BikeState {
+  SnapshotChannel<GearState> gear;
+  SnapshotChannel<SpeedState> speed;
+  SnapshotChannel<TemperatureState> temperature;
+};
+
+}  // namespace bike_computer
@@ -0,0 +1,67 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file compressed_image.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Streaming decoder of palette indexed RLE images
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "compressed_image.hpp"
+
+// zephyr
+#include <zephyr/kernel.h>
+
+namespace bike_computer {
+
+bool CompressedImageDecoder::decodeRow(uint32_t* pRow) {
+  if (_rowIndex >= _image.imageHeight) {
+    return false;
+  }
+  uint32_t pixelIndex = 0;
+  while (pixelIndex < _image.imageWidth) {
+    const uint8_t control = *_pData++;
+    const uint8_t length  = (control & 0x7F) + 1;
+    // packets never span rows: clamp malformed data to the row
+    const uint32_t remainingPixels = _image.imageWidth - pixelIndex;
+    __ASSERT(length <= remainingPixels,
+             "Packet of %d pixels exceeds row %d (%d pixels left)",
+             length,
+             _rowIndex,
+             remainingPixels);
+    const uint8_t nbrOfPixels =
+        length <= remainingPixels ? length : static_cast<uint8_t>(remainingPixels);
+    if ((control & 0x80) != 0) {
+      // run of identical pixels
+      const uint32_t color = _image.pPalette[*_pData++];
+      for (uint8_t index = 0; index < nbrOfPixels; index++) {
+        pRow[pixelIndex++] = color;
+      }
+    } else {
+      // literal pixels (the indices beyond the row are skipped)
+      for (uint8_t index = 0; index < nbrOfPixels; index++) {
+        pRow[pixelIndex++] = _image.pPalette[_pData[index]];
+      }
+      _pData += length;
+    }
+  }
+  _rowIndex++;
+  return true;
+}
+
+}  // namespace bike_computer
@@ -0,0 +1,58 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file compressed_image.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Palette indexed RLE images and their streaming decoder
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// std
+#include <cstdint>
+
+namespace bike_computer {
+
+// Image compressed by tools/icon_converter.py: each row is encoded independently
+// as a sequence of packets made of a control byte c followed by
+// - one palette index repeated (c & 0x7F) + 1 times if c & 0x80
+// - c + 1 palette indices otherwise
+struct CompressedImage {
+  const uint32_t* pPalette;
+  const uint8_t* pData;
+  uint8_t imageWidth;
+  uint8_t imageHeight;
+};
+
+// Decode a compressed image row by row into ARGB8888 pixels
+class CompressedImageDecoder {
+ public:
+  explicit CompressedImageDecoder(const CompressedImage& image) : _image(image) {}
+
+  // decode the next row into pRow (imageWidth pixels)
+  // returns false once all rows have been decoded
+  bool decodeRow(uint32_t* pRow);
+
+ private:
+  const CompressedImage& _image;
+  const uint8_t* _pData = _image.pData;
+  uint8_t _rowIndex     = 0;
+};
+
+}  // namespace bike_computer
@@ -0,0 +1,38 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file criticality.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Criticality levels of mixed-criticality tasks
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// std
+#include <cstdint>
+
+namespace bike_computer {
+
+// Criticality level of a task, also used as the mode of a mixed-criticality
+// scheduler: in Lo mode all tasks run, while in Hi mode (entered when a Hi task
+// overruns its Lo budget) Lo tasks are shed or degraded, so that Hi tasks keep
+// their deadlines until the overload is over.
+enum class Criticality : uint8_t { Lo = 0, Hi = 1 };
+
+}  // namespace bike_computer
@@ -0,0 +1,68 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file edge_debouncer.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Debouncing of button edges (ISR safe)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// zephyr
+#include <zephyr/kernel.h>
+
+// std
+#include <chrono>
+
+// zpp_lib
+#include "zpp_include/non_copyable.hpp"
+#include "zpp_include/time.hpp"
+
+namespace bike_computer {
+
+using namespace std::literals;
+
+// Accepts an edge only if no edge was accepted during the debounce time.
+// Meant to be called from the ISR of a single button.
+class EdgeDebouncer : private zpp_lib::NonCopyable<EdgeDebouncer> {
+ public:
+  static constexpr std::chrono::microseconds kDebounceTime = 20000us;
+
+  EdgeDebouncer() = default;
+
+  bool accept() {
+    // 32 bits of usecs wrap after ~71 minutes, unsigned differences handle it
+    const uint32_t now = static_cast<uint32_t>(zpp_lib::Time::getUpTime().count());
+
+    const uint32_t lastEdgeTime = static_cast<uint32_t>(atomic_get(&_lastEdgeTime));
+    if (atomic_test_bit(&_hasEdge, 0) &&
+        now - lastEdgeTime < static_cast<uint32_t>(kDebounceTime.count())) {
+      return false;
+    }
+    atomic_set(&_lastEdgeTime, static_cast<atomic_val_t>(now));
+    atomic_set_bit(&_hasEdge, 0);
+    return true;
+  }
+
+ private:
+  atomic_t _lastEdgeTime = ATOMIC_INIT(0);
+  atomic_t _hasEdge      = ATOMIC_INIT(0);
+};
+
+}  // namespace bike_computer
@@ -0,0 +1,102 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file fixed_point_format.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Formatting of fixed-point numbers without snprintf
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// std
+#include <cstdint>
+
+namespace bike_computer {
+
+namespace fixed_point_format {
+
+// round a floating point value to a fixed-point value with nbrOfDecimals
+// decimals (e.g. 12.345f with 1 decimal gives 123), without double promotion
+constexpr int32_t toFixedPoint(float value, uint8_t nbrOfDecimals) {
+  for (uint8_t decimal = 0; decimal < nbrOfDecimals; decimal++) {
+    value *= 10.0f;
+  }
+  return static_cast<int32_t>(value < 0.0f ? value - 0.5f : value + 0.5f);
+}
+
+// an int32_t has at most 10 digits
+static constexpr uint8_t kMaxNbrOfDecimals = 10;
+
+// format a fixed-point value with nbrOfDecimals decimals into buffer
+// (e.g. 123 with 1 decimal gives "12.3", -5 with 2 decimals gives "-0.05")
+// the text is right-aligned on minWidth characters (padded with spaces)
+// returns the length of the text (without the terminating '\0') or 0 if the
+// buffer is too small or if nbrOfDecimals exceeds kMaxNbrOfDecimals
+constexpr uint8_t format(int32_t value,
+                         uint8_t nbrOfDecimals,
+                         char* buffer,
+                         uint8_t bufferSize,
+                         uint8_t minWidth = 0) {
+  if (nbrOfDecimals > kMaxNbrOfDecimals) {
+    if (bufferSize > 0) {
+      buffer[0] = '\0';
+    }
+    return 0;
+  }
+  // digits are generated from the least significant one, in reverse order
+  char digits[12]       = {0};
+  uint8_t nbrOfDigits   = 0;
+  const bool isNegative = value < 0;
+  uint32_t magnitude =
+      isNegative ? 0U - static_cast<uint32_t>(value) : static_cast<uint32_t>(value);
+  do {
+    digits[nbrOfDigits++] = static_cast<char>('0' + magnitude % 10);
+    magnitude /= 10;
+  } while (magnitude != 0 || nbrOfDigits <= nbrOfDecimals);
+
+  const uint8_t textLength =
+      nbrOfDigits + (nbrOfDecimals > 0 ? 1 : 0) + (isNegative ? 1 : 0);
+  const uint8_t length = textLength > minWidth ? textLength : minWidth;
+  if (length >= bufferSize) {
+    if (bufferSize > 0) {
+      buffer[0] = '\0';
+    }
+    return 0;
+  }
+
+  uint8_t index = 0;
+  while (index < length - textLength) {
+    buffer[index++] = ' ';
+  }
+  if (isNegative) {
+    buffer[index++] = '-';
+  }
+  while (nbrOfDigits > 0) {
+    if (nbrOfDigits == nbrOfDecimals) {
+      buffer[index++] = '.';
+    }
+    buffer[index++] = digits[--nbrOfDigits];
+  }
+  buffer[index] = '\0';
+  return length;
+}
+
+}  // namespace fixed_point_format
+
+}  // namespace bike_computer
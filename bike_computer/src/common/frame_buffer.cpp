@@ -0,0 +1,178 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file frame_buffer.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Off-screen RGB565 frame buffer implementation
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "frame_buffer.hpp"
+
+#if CONFIG_DISPLAY == 1 && CONFIG_BIKE_DISPLAY_FRAMEBUFFER == 1
+
+// zephyr
+#include <zephyr/drivers/display.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+
+// std
+#include <algorithm>
+
+LOG_MODULE_DECLARE(bike_computer, CONFIG_APP_LOG_LEVEL);
+
+namespace bike_computer {
+
+// create the pixel buffer as a global variable (not on stack)
+static uint16_t gPixels[FrameBuffer::kWidth * FrameBuffer::kHeight];
+
+zpp_lib::ZephyrResult FrameBuffer::initialize() {
+  zpp_lib::ZephyrResult res;
+  _pDevice = DEVICE_DT_GET(DT_CHOSEN(zephyr_display));
+  if (!device_is_ready(_pDevice)) {
+    LOG_ERR("Display device not ready");
+    res.assign_error(zpp_lib::ZephyrErrorCode::k_nodev);
+    return res;
+  }
+
+  struct display_capabilities capabilities;
+  display_get_capabilities(_pDevice, &capabilities);
+  if (capabilities.current_pixel_format != PIXEL_FORMAT_RGB_565 &&
+      display_set_pixel_format(_pDevice, PIXEL_FORMAT_RGB_565) != 0) {
+    LOG_WRN("Display does not support RGB565");
+    res.assign_error(zpp_lib::ZephyrErrorCode::k_inval);
+    return res;
+  }
+
+  // the whole screen is sent at the first flush
+  fillRectangle(0x00000000UL, 0, 0, kWidth, kHeight);
+  _nbrOfTransfers = 0;
+  return res;
+}
+
+void FrameBuffer::fillRectangle(
+    uint32_t color, uint32_t xPos, uint32_t yPos, uint32_t width, uint32_t height) {
+  if (!clip(xPos, yPos, width, height)) {
+    return;
+  }
+  const uint16_t pixel = toPixel(color);
+  for (uint32_t y = yPos; y < yPos + height; y++) {
+    uint16_t* pRow = &gPixels[y * kWidth + xPos];
+    std::fill(pRow, pRow + width, pixel);
+  }
+  markDirty(xPos, yPos, width, height);
+}
+
+void FrameBuffer::drawPicture(uint32_t xPos,
+                              uint32_t yPos,
+                              const uint32_t* pImageData,
+                              uint32_t width,
+                              uint32_t height) {
+  const uint32_t imageWidth = width;
+  if (!clip(xPos, yPos, width, height)) {
+    return;
+  }
+  for (uint32_t y = 0; y < height; y++) {
+    const uint32_t* pImageRow = &pImageData[y * imageWidth];
+    uint16_t* pRow            = &gPixels[(yPos + y) * kWidth + xPos];
+    for (uint32_t x = 0; x < width; x++) {
+      pRow[x] = toPixel(pImageRow[x]);
+    }
+  }
+  markDirty(xPos, yPos, width, height);
+}
+
+zpp_lib::ZephyrResult FrameBuffer::flush() {
+  zpp_lib::ZephyrResult res;
+  for (uint32_t tileRow = 0; tileRow < kNbrOfTileRows; tileRow++) {
+    while (_dirtyTiles[tileRow] != 0) {
+      // first run of consecutive dirty tiles in this tile row
+      const uint32_t firstColumn = __builtin_ctz(_dirtyTiles[tileRow]);
+      const uint32_t runLength   = __builtin_ctz(~(_dirtyTiles[tileRow] >> firstColumn));
+      const uint32_t runMask     = getColumnMask(firstColumn, runLength);
+      // extend the run to the following tile rows with the same dirty tiles
+      uint32_t nbrOfTileRows = 0;
+      while (tileRow + nbrOfTileRows < kNbrOfTileRows &&
+             (_dirtyTiles[tileRow + nbrOfTileRows] & runMask) == runMask) {
+        _dirtyTiles[tileRow + nbrOfTileRows] &= ~runMask;
+        nbrOfTileRows++;
+      }
+
+      const uint32_t xPos   = firstColumn * kTileSize;
+      const uint32_t yPos   = tileRow * kTileSize;
+      const uint32_t width  = std::min(runLength * kTileSize, kWidth - xPos);
+      const uint32_t height = std::min(nbrOfTileRows * kTileSize, kHeight - yPos);
+      // the rectangle is sent directly from the frame buffer (pitch is the
+      // frame buffer width)
+      const struct display_buffer_descriptor descriptor = {
+          .buf_size         = ((height - 1) * kWidth + width) * kBytesPerPixel,
+          .width            = static_cast<uint16_t>(width),
+          .height           = static_cast<uint16_t>(height),
+          .pitch            = static_cast<uint16_t>(kWidth),
+          .frame_incomplete = false};
+      int ret = display_write(
+          _pDevice, xPos, yPos, &descriptor, &gPixels[yPos * kWidth + xPos]);
+      _nbrOfTransfers++;
+      if (ret != 0) {
+        LOG_ERR("Display write failed: %d", ret);
+        res.assign_error(zpp_lib::ZephyrErrorCode::k_io);
+      }
+    }
+  }
+  return res;
+}
+
+uint16_t FrameBuffer::toPixel(uint32_t color) {
+  const uint16_t red   = (color >> 19) & 0x1F;
+  const uint16_t green = (color >> 10) & 0x3F;
+  const uint16_t blue  = (color >> 3) & 0x1F;
+  // PIXEL_FORMAT_RGB_565 is stored in big endian byte order
+  return sys_cpu_to_be16((red << 11) | (green << 5) | blue);
+}
+
+bool FrameBuffer::clip(uint32_t xPos, uint32_t yPos, uint32_t& width, uint32_t& height) {
+  if (xPos >= kWidth || yPos >= kHeight) {
+    return false;
+  }
+  width  = std::min(width, kWidth - xPos);
+  height = std::min(height, kHeight - yPos);
+  return width > 0 && height > 0;
+}
+
+uint32_t FrameBuffer::getColumnMask(uint32_t firstColumn, uint32_t nbrOfColumns) {
+  const uint32_t mask =
+      nbrOfColumns >= 32 ? UINT32_MAX : (UINT32_C(1) << nbrOfColumns) - 1;
+  return mask << firstColumn;
+}
+
+void FrameBuffer::markDirty(uint32_t xPos,
+                            uint32_t yPos,
+                            uint32_t width,
+                            uint32_t height) {
+  const uint32_t firstColumn = xPos / kTileSize;
+  const uint32_t lastColumn  = (xPos + width - 1) / kTileSize;
+  const uint32_t columnMask  = getColumnMask(firstColumn, lastColumn - firstColumn + 1);
+  for (uint32_t tileRow = yPos / kTileSize; tileRow <= (yPos + height - 1) / kTileSize;
+       tileRow++) {
+    _dirtyTiles[tileRow] |= columnMask;
+  }
+}
+
+}  // namespace bike_computer
+
+#endif  // CONFIG_DISPLAY == 1 && CONFIG_BIKE_DISPLAY_FRAMEBUFFER == 1
@@ -0,0 +1,95 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file frame_buffer.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Off-screen RGB565 frame buffer with dirty tile tracking
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#if CONFIG_DISPLAY == 1 && CONFIG_BIKE_DISPLAY_FRAMEBUFFER == 1
+
+// zephyr
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+
+// std
+#include <cstdint>
+
+// zpp_lib
+#include "zpp_include/non_copyable.hpp"
+#include "zpp_include/zephyr_result.hpp"
+
+namespace bike_computer {
+
+// All drawing primitives write into a frame buffer in RAM and mark the tiles
+// they modify as dirty. flush() sends the dirty tiles to the display, merging
+// adjacent dirty tiles into rectangles so that each rectangle is sent with a
+// single display_write() call.
+class FrameBuffer : private zpp_lib::NonCopyable<FrameBuffer> {
+ public:
+  // display size from the devicetree
+  static constexpr uint32_t kWidth  = DT_PROP(DT_CHOSEN(zephyr_display), width);
+  static constexpr uint32_t kHeight = DT_PROP(DT_CHOSEN(zephyr_display), height);
+  // changes are tracked per tile of kTileSize x kTileSize pixels
+  static constexpr uint32_t kTileSize         = 16;
+  static constexpr uint32_t kNbrOfTileColumns = (kWidth + kTileSize - 1) / kTileSize;
+  static constexpr uint32_t kNbrOfTileRows    = (kHeight + kTileSize - 1) / kTileSize;
+  // the dirty tiles of one tile row are stored in one 32 bits word
+  static_assert(kNbrOfTileColumns <= 32, "Display too wide for the dirty tile bitmap");
+
+  FrameBuffer() = default;
+
+  // to be called prior to any other method
+  // fails if the display does not support the RGB565 pixel format
+  [[nodiscard]] zpp_lib::ZephyrResult initialize();
+
+  // colors are given in ARGB8888 format (the alpha channel is ignored)
+  void fillRectangle(
+      uint32_t color, uint32_t xPos, uint32_t yPos, uint32_t width, uint32_t height);
+  void drawPicture(uint32_t xPos,
+                   uint32_t yPos,
+                   const uint32_t* pImageData,
+                   uint32_t width,
+                   uint32_t height);
+
+  // send all dirty tiles to the display
+  [[nodiscard]] zpp_lib::ZephyrResult flush();
+
+  // number of display_write() calls issued since initialization
+  uint32_t getNbrOfTransfers() const { return _nbrOfTransfers; }
+
+ private:
+  static constexpr uint32_t kBytesPerPixel = sizeof(uint16_t);
+
+  static uint16_t toPixel(uint32_t color);
+  // clip the rectangle to the display, returns false if it is empty
+  static bool clip(uint32_t xPos, uint32_t yPos, uint32_t& width, uint32_t& height);
+  static uint32_t getColumnMask(uint32_t firstColumn, uint32_t nbrOfColumns);
+  void markDirty(uint32_t xPos, uint32_t yPos, uint32_t width, uint32_t height);
+
+  const struct device* _pDevice        = nullptr;
+  uint32_t _dirtyTiles[kNbrOfTileRows] = {0};
+  uint32_t _nbrOfTransfers             = 0;
+};
+
+}  // namespace bike_computer
+
+#endif  // CONFIG_DISPLAY == 1 && CONFIG_BIKE_DISPLAY_FRAMEBUFFER == 1
@@ -0,0 +1,131 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file glyph_cache.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief LRU cache of glyph cells rendered as 1bpp bitmaps
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// std
+#include <cstdint>
+
+// zpp_lib
+#include "zpp_include/non_copyable.hpp"
+
+// local
+#include "packed_font.hpp"
+
+namespace bike_computer {
+
+// Each entry holds the full character cell (font width x height pixels) of a
+// glyph as a 1bpp bitmap, independent of the colors. A cached cell is expanded
+// to ARGB8888 pixels in a single cell buffer, so that drawing a character is
+// still a single picture transfer while the entries use 32 times less RAM than
+// ARGB8888 cells. When the cache is full, the least recently used entry is
+// replaced.
+template <uint8_t NbrOfEntries, uint32_t MaxCellPixels>
+class GlyphCache : private zpp_lib::NonCopyable<GlyphCache<NbrOfEntries, MaxCellPixels>> {
+ public:
+  GlyphCache() = default;
+
+  // returns the pixels of the character cell or nullptr if the cell of the font
+  // does not fit in a cache entry (the pixels are valid until the next call)
+  const uint32_t* getGlyph(const PackedFont& font,
+                           char character,
+                           uint32_t textColor,
+                           uint32_t backColor) {
+    if (static_cast<uint32_t>(font.width) * font.height > MaxCellPixels) {
+      return nullptr;
+    }
+    _useCounter++;
+    Entry* pVictim = &_entries[0];
+    for (auto& entry : _entries) {
+      if (entry.pFont == &font && entry.character == character) {
+        entry.lastUse = _useCounter;
+        _nbrOfHits++;
+        return expand(font, entry.bits, textColor, backColor);
+      }
+      if (entry.lastUse < pVictim->lastUse) {
+        pVictim = &entry;
+      }
+    }
+
+    _nbrOfMisses++;
+    pVictim->pFont     = &font;
+    pVictim->character = character;
+    pVictim->lastUse   = _useCounter;
+    render(font, font.findGlyph(character), pVictim->bits);
+    return expand(font, pVictim->bits, textColor, backColor);
+  }
+
+  uint32_t getNbrOfHits() const { return _nbrOfHits; }
+  uint32_t getNbrOfMisses() const { return _nbrOfMisses; }
+
+ private:
+  static constexpr uint32_t kCellBytes = (MaxCellPixels + 7) / 8;
+
+  struct Entry {
+    const PackedFont* pFont = nullptr;
+    char character          = 0;
+    uint32_t lastUse        = 0;
+    uint8_t bits[kCellBytes];
+  };
+
+  // characters missing from the font are rendered as blank cells
+  static void render(const PackedFont& font, const PackedGlyph* pGlyph, uint8_t* pBits) {
+    const uint32_t nbrOfPixels = static_cast<uint32_t>(font.width) * font.height;
+    for (uint32_t byteIndex = 0; byteIndex < (nbrOfPixels + 7) / 8; byteIndex++) {
+      pBits[byteIndex] = 0;
+    }
+    if (pGlyph == nullptr) {
+      return;
+    }
+    for (uint8_t y = 0; y < pGlyph->height; y++) {
+      const uint32_t rowIndex = (pGlyph->yOffset + y) * font.width + pGlyph->xOffset;
+      for (uint8_t x = 0; x < pGlyph->width; x++) {
+        if (font.isPixelSet(*pGlyph, x, y)) {
+          const uint32_t pixelIndex = rowIndex + x;
+          pBits[pixelIndex / 8] |= static_cast<uint8_t>(1U << (pixelIndex % 8));
+        }
+      }
+    }
+  }
+
+  const uint32_t* expand(const PackedFont& font,
+                         const uint8_t* pBits,
+                         uint32_t textColor,
+                         uint32_t backColor) {
+    const uint32_t nbrOfPixels = static_cast<uint32_t>(font.width) * font.height;
+    for (uint32_t pixelIndex = 0; pixelIndex < nbrOfPixels; pixelIndex++) {
+      _cellPixels[pixelIndex] =
+          (pBits[pixelIndex / 8] & (1U << (pixelIndex % 8))) != 0 ? textColor : backColor;
+    }
+    return _cellPixels;
+  }
+
+  Entry _entries[NbrOfEntries];
+  uint32_t _cellPixels[MaxCellPixels];
+  uint32_t _useCounter  = 0;
+  uint32_t _nbrOfHits   = 0;
+  uint32_t _nbrOfMisses = 0;
+};
+
+}  // namespace bike_computer
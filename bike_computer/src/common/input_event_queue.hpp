@@ -0,0 +1,92 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file input_event_queue.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Queue of timestamped input events posted from ISRs
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+
+#pragma once
+
+// zephyr
+#include <zephyr/kernel.h>
+
+// std
+#include <chrono>
+
+// local
+#include "spsc_ring.hpp"
+
+// zpp_lib
+#include "zpp_include/non_copyable.hpp"
+#include "zpp_include/time.hpp"
+
+namespace bike_computer {
+
+// input event, timestamped when the ISR posts it
+struct InputEvent {
+  enum class Type : uint8_t {
+    Reset,
+    GearUp,
+    GearDown,
+    PedalSpeedUp,
+    PedalSpeedDown,
+    ButtonPressed
+  };
+  Type type                      = Type::ButtonPressed;
+  std::chrono::microseconds time = std::chrono::microseconds::zero();
+};
+
+// Queue used for handing input events from ISRs over to a single consumer task.
+// Each event keeps its own timestamp, so that bursts of events are delivered
+// without loss and the latency of each event can be computed. Producers are
+// serialized by locking interrupts, so that several ISRs may post to the same
+// queue, while the consumer side is lock-free.
+// Events are dropped (and counted) when the queue is full.
+template <uint16_t Size>
+class InputEventQueue : private zpp_lib::NonCopyable<InputEventQueue<Size>> {
+ public:
+  InputEventQueue() = default;
+
+  // producer side (ISR or thread)
+  bool post(InputEvent::Type type) {
+    InputEvent event;
+    event.type             = type;
+    event.time             = zpp_lib::Time::getUpTime();
+    const unsigned int key = irq_lock();
+    const bool isPosted    = _ring.push(event);
+    irq_unlock(key);
+    return isPosted;
+  }
+
+  // consumer side (single thread)
+  bool get(InputEvent& event) { return _ring.pop(event); }
+
+  uint32_t getSize() const { return _ring.getSize(); }
+  bool isEmpty() const { return _ring.isEmpty(); }
+
+  // number of events dropped because the queue was full
+  uint32_t getNbrOfOverflows() const { return _ring.getNbrOfOverflows(); }
+
+ private:
+  SpscRing<InputEvent, Size> _ring;
+};
+
+}  // namespace bike_computer
@@ -0,0 +1,58 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file member_task.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Task entry calling a member function without type erasure
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// std
+#include <cstddef>
+
+namespace bike_computer {
+
+// Task entry made of an object and one of its member functions, to be used as the
+// task type of TTCE instead of std::function. It is trivially copyable and is never
+// allocated on the heap, so that a schedule table of MemberTask is a packed array
+// of plain data. The method is called through a pointer to member function: this
+// is an indirect call (like a function pointer) that cannot be inlined, but that
+// avoids the type erasure layer of std::function. The method is not a template
+// parameter, so that tasks of different methods fit in the same table.
+template <typename T>
+struct MemberTask {
+  using Method = void (T::*)();
+
+  constexpr MemberTask() = default;
+  constexpr MemberTask(std::nullptr_t) {}  // NOLINT(runtime/explicit)
+  constexpr MemberTask(T* object, Method method) : pObject(object), method(method) {}
+
+  void operator()() const { (pObject->*method)(); }
+
+  constexpr bool operator==(std::nullptr_t) const {
+    return pObject == nullptr || method == nullptr;
+  }
+  constexpr bool operator!=(std::nullptr_t) const { return !(*this == nullptr); }
+
+  T* pObject    = nullptr;
+  Method method = nullptr;
+};
+
+}  // namespace bike_computer
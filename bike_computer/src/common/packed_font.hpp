@@ -0,0 +1,75 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file packed_font.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Packed 1bpp fonts with per glyph metrics
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// std
+#include <cstdint>
+
+namespace bike_computer {
+
+// Glyph cropped to its ink bounding box within the character cell. The rows of
+// the glyph are stored in the font bitmap as a bit stream (msb first) starting
+// at bitOffset, without any padding.
+struct PackedGlyph {
+  char character;
+  uint8_t xOffset;
+  uint8_t yOffset;
+  uint8_t width;
+  uint8_t height;
+  uint16_t bitOffset;
+};
+
+// Monospace font generated by tools/font_converter.py: all characters have a
+// cell of width x height pixels. Glyphs are sorted by character.
+struct PackedFont {
+  const PackedGlyph* pGlyphs;
+  uint8_t nbrOfGlyphs;
+  const uint8_t* pBitmap;
+  uint8_t width;
+  uint8_t height;
+
+  // returns nullptr if the character is not part of the font
+  constexpr const PackedGlyph* findGlyph(char character) const {
+    uint8_t low  = 0;
+    uint8_t high = nbrOfGlyphs;
+    while (low < high) {
+      const uint8_t middle = low + (high - low) / 2;
+      if (pGlyphs[middle].character < character) {
+        low = middle + 1;
+      } else {
+        high = middle;
+      }
+    }
+    return (low < nbrOfGlyphs && pGlyphs[low].character == character) ? &pGlyphs[low]
+                                                                      : nullptr;
+  }
+
+  constexpr bool isPixelSet(const PackedGlyph& glyph, uint8_t x, uint8_t y) const {
+    const uint32_t bitIndex = glyph.bitOffset + y * glyph.width + x;
+    return (pBitmap[bitIndex / 8] & (0x80 >> (bitIndex % 8))) != 0;
+  }
+};
+
+}  // namespace bike_computer
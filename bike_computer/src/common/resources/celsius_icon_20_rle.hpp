@@ -0,0 +1,59 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file celsius_icon_20_rle.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Celsius icon (size 20) as palette indexed RLE data
+ *        (generated by tools/icon_converter.py from celsius_icon_20.hpp)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "common/compressed_image.hpp"
+
+constexpr uint8_t kCelsiusIconHeight = 20;
+constexpr uint8_t kCelsiusIconWidth  = 20;
+
+// compressed size is 190 (raw size is 1600)
+// clang-format off
+const uint32_t celsius_icon_palette[] = {
+    0x000000ff, 0x272727ff, 0x333333ff, 0x3c3c3cff, 0xa0a0a0ff, 0xd9d9d9ff, 0xeeeeeeff,
+    0xfefefeff, 0xffffffff,
+};
+
+const uint8_t celsius_icon_data[] = {
+    0x93, 0x08, 0x93, 0x08, 0x83, 0x08, 0x02, 0x00, 0x03, 0x00, 0x8c, 0x08, 0x85, 0x08,
+    0x02, 0x00, 0x08, 0x08, 0x82, 0x00, 0x00, 0x07, 0x86, 0x08, 0x83, 0x08, 0x09, 0x00,
+    0x00, 0x06, 0x08, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x85, 0x08, 0x86, 0x08, 0x01,
+    0x00, 0x05, 0x83, 0x08, 0x00, 0x00, 0x85, 0x08, 0x86, 0x08, 0x00, 0x00, 0x84, 0x08,
+    0x00, 0x00, 0x85, 0x08, 0x86, 0x08, 0x00, 0x00, 0x84, 0x08, 0x00, 0x00, 0x85, 0x08,
+    0x86, 0x08, 0x00, 0x00, 0x8b, 0x08, 0x86, 0x08, 0x00, 0x00, 0x8b, 0x08, 0x86, 0x08,
+    0x00, 0x00, 0x8b, 0x08, 0x86, 0x08, 0x00, 0x00, 0x8b, 0x08, 0x86, 0x08, 0x00, 0x00,
+    0x8b, 0x08, 0x86, 0x08, 0x00, 0x00, 0x84, 0x08, 0x00, 0x00, 0x85, 0x08, 0x86, 0x08,
+    0x00, 0x00, 0x84, 0x08, 0x00, 0x00, 0x85, 0x08, 0x86, 0x08, 0x00, 0x00, 0x84, 0x08,
+    0x00, 0x00, 0x85, 0x08, 0x86, 0x08, 0x01, 0x01, 0x00, 0x82, 0x08, 0x01, 0x00, 0x00,
+    0x85, 0x08, 0x87, 0x08, 0x00, 0x02, 0x83, 0x00, 0x86, 0x08, 0x93, 0x08, 0x93, 0x08,
+};
+// clang-format on
+
+constexpr bike_computer::CompressedImage celsius_icon = {
+    .pPalette    = celsius_icon_palette,
+    .pData       = celsius_icon_data,
+    .imageWidth  = kCelsiusIconWidth,
+    .imageHeight = kCelsiusIconHeight};
@@ -0,0 +1,93 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file celsius_icon_32_rle.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Celsius icon (size 32) as palette indexed RLE data
+ *        (generated by tools/icon_converter.py from celsius_icon_32.hpp)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "common/compressed_image.hpp"
+
+constexpr uint8_t kCelsiusIconHeight = 32;
+constexpr uint8_t kCelsiusIconWidth  = 32;
+
+// compressed size is 873 (raw size is 4096)
+// clang-format off
+const uint32_t celsius_icon_palette[] = {
+    0x000000ff, 0x010101ff, 0x020202ff, 0x030303ff, 0x040404ff, 0x050505ff, 0x060606ff,
+    0x070707ff, 0x080808ff, 0x0a0a0aff, 0x0d0d0dff, 0x0f0f0fff, 0x101010ff, 0x111111ff,
+    0x141414ff, 0x1a1a1aff, 0x1b1b1bff, 0x1d1d1dff, 0x1e1e1eff, 0x1f1f1fff, 0x202020ff,
+    0x303030ff, 0x313131ff, 0x333333ff, 0x343434ff, 0x3d3d3dff, 0x3e3e3eff, 0x3f3f3fff,
+    0x434343ff, 0x444444ff, 0x454545ff, 0x464646ff, 0x484848ff, 0x494949ff, 0x4a4a4aff,
+    0x4c4c4cff, 0x4e4e4eff, 0x4f4f4fff, 0x505050ff, 0x545454ff, 0x5b5b5bff, 0x5d5d5dff,
+    0x5e5e5eff, 0x5f5f5fff, 0x616161ff, 0x636363ff, 0x646464ff, 0x656565ff, 0x666666ff,
+    0x686868ff, 0x727272ff, 0x737373ff, 0x747474ff, 0x757575ff, 0x777777ff, 0x797979ff,
+    0x868686ff, 0x878787ff, 0x898989ff, 0x919191ff, 0x939393ff, 0x9a9a9aff, 0x9b9b9bff,
+    0xa2a2a2ff, 0xa5a5a5ff, 0xa9a9a9ff, 0xaaaaaaff, 0xb1b1b1ff, 0xb3b3b3ff, 0xb4b4b4ff,
+    0xb5b5b5ff, 0xb6b6b6ff, 0xb7b7b7ff, 0xbababaff, 0xbbbbbbff, 0xbcbcbcff, 0xbebebeff,
+    0xc0c0c0ff, 0xc3c3c3ff, 0xc5c5c5ff, 0xc6c6c6ff, 0xc7c7c7ff, 0xc8c8c8ff, 0xc9c9c9ff,
+    0xcacacaff, 0xcbcbcbff, 0xccccccff, 0xd2d2d2ff, 0xd3d3d3ff, 0xd5d5d5ff, 0xd6d6d6ff,
+    0xdadadaff, 0xdbdbdbff, 0xddddddff, 0xdfdfdfff, 0xe2e2e2ff, 0xe7e7e7ff, 0xe8e8e8ff,
+    0xebebebff, 0xecececff, 0xeeeeeeff, 0xefefefff, 0xf0f0f0ff, 0xf2f2f2ff, 0xf3f3f3ff,
+    0xf6f6f6ff, 0xf8f8f8ff, 0xf9f9f9ff, 0xfafafaff, 0xfbfbfbff, 0xfcfcfcff, 0xfdfdfdff,
+    0xfefefeff, 0xffffffff,
+};
+
+const uint8_t celsius_icon_data[] = {
+    0x9f, 0x71, 0x85, 0x71, 0x05, 0x5b, 0x32, 0x20, 0x29, 0x43, 0x6d, 0x93, 0x71, 0x83,
+    0x71, 0x02, 0x6c, 0x3d, 0x07, 0x82, 0x00, 0x02, 0x02, 0x2d, 0x65, 0x92, 0x71, 0x83,
+    0x71, 0x01, 0x4d, 0x0a, 0x85, 0x00, 0x01, 0x2e, 0x6d, 0x91, 0x71, 0x83, 0x71, 0x09,
+    0x24, 0x00, 0x09, 0x38, 0x62, 0x48, 0x11, 0x00, 0x0f, 0x5b, 0x91, 0x71, 0x83, 0x71,
+    0x09, 0x0c, 0x00, 0x18, 0x68, 0x71, 0x71, 0x3e, 0x00, 0x05, 0x4f, 0x91, 0x71, 0x83,
+    0x71, 0x09, 0x0c, 0x00, 0x17, 0x68, 0x71, 0x71, 0x3d, 0x00, 0x06, 0x4f, 0x91, 0x71,
+    0x83, 0x71, 0x09, 0x25, 0x00, 0x09, 0x38, 0x62, 0x48, 0x11, 0x00, 0x10, 0x5b, 0x91,
+    0x71, 0x83, 0x71, 0x01, 0x4d, 0x0a, 0x85, 0x00, 0x01, 0x2f, 0x6d, 0x91, 0x71, 0x83,
+    0x71, 0x02, 0x6c, 0x3e, 0x08, 0x82, 0x00, 0x02, 0x03, 0x2e, 0x66, 0x83, 0x71, 0x08,
+    0x6b, 0x45, 0x36, 0x26, 0x21, 0x28, 0x39, 0x57, 0x70, 0x85, 0x71, 0x85, 0x71, 0x05,
+    0x5c, 0x33, 0x21, 0x2a, 0x44, 0x6d, 0x82, 0x71, 0x02, 0x60, 0x3b, 0x12, 0x85, 0x00,
+    0x03, 0x03, 0x19, 0x49, 0x69, 0x83, 0x71, 0x8d, 0x71, 0x02, 0x50, 0x15, 0x01, 0x88,
+    0x00, 0x01, 0x09, 0x31, 0x83, 0x71, 0x8b, 0x71, 0x10, 0x6f, 0x4b, 0x0d, 0x00, 0x02,
+    0x14, 0x30, 0x4c, 0x64, 0x70, 0x5f, 0x40, 0x22, 0x0c, 0x00, 0x0e, 0x70, 0x82, 0x71,
+    0x8b, 0x71, 0x06, 0x59, 0x11, 0x00, 0x00, 0x2c, 0x5d, 0x70, 0x84, 0x71, 0x03, 0x6b,
+    0x53, 0x34, 0x47, 0x83, 0x71, 0x8a, 0x71, 0x05, 0x6c, 0x1e, 0x00, 0x06, 0x35, 0x70,
+    0x8e, 0x71, 0x8a, 0x71, 0x04, 0x41, 0x01, 0x00, 0x1d, 0x67, 0x8f, 0x71, 0x89, 0x71,
+    0x04, 0x6a, 0x1a, 0x00, 0x06, 0x55, 0x90, 0x71, 0x89, 0x71, 0x03, 0x5e, 0x14, 0x00,
+    0x21, 0x91, 0x71, 0x89, 0x71, 0x03, 0x56, 0x0a, 0x00, 0x3b, 0x91, 0x71, 0x89, 0x71,
+    0x03, 0x4e, 0x04, 0x00, 0x47, 0x91, 0x71, 0x89, 0x71, 0x03, 0x4e, 0x04, 0x00, 0x46,
+    0x91, 0x71, 0x89, 0x71, 0x03, 0x56, 0x0a, 0x00, 0x3b, 0x91, 0x71, 0x89, 0x71, 0x04,
+    0x5e, 0x14, 0x00, 0x20, 0x70, 0x90, 0x71, 0x89, 0x71, 0x04, 0x6a, 0x1b, 0x00, 0x06,
+    0x54, 0x90, 0x71, 0x8a, 0x71, 0x04, 0x42, 0x01, 0x00, 0x1c, 0x67, 0x8f, 0x71, 0x8a,
+    0x71, 0x05, 0x6c, 0x1f, 0x00, 0x05, 0x34, 0x70, 0x8e, 0x71, 0x8b, 0x71, 0x06, 0x5a,
+    0x11, 0x00, 0x00, 0x2b, 0x5d, 0x70, 0x84, 0x71, 0x03, 0x6a, 0x52, 0x33, 0x46, 0x83,
+    0x71, 0x8b, 0x71, 0x10, 0x6f, 0x4b, 0x0d, 0x00, 0x02, 0x14, 0x2f, 0x4b, 0x63, 0x6e,
+    0x5e, 0x3f, 0x20, 0x0b, 0x00, 0x0e, 0x70, 0x82, 0x71, 0x8d, 0x71, 0x02, 0x51, 0x16,
+    0x01, 0x88, 0x00, 0x01, 0x09, 0x31, 0x83, 0x71, 0x8e, 0x71, 0x02, 0x61, 0x3c, 0x13,
+    0x85, 0x00, 0x03, 0x03, 0x1b, 0x4a, 0x69, 0x83, 0x71, 0x90, 0x71, 0x08, 0x6c, 0x47,
+    0x37, 0x27, 0x23, 0x2a, 0x3a, 0x58, 0x70, 0x85, 0x71, 0x9f, 0x71,
+};
+// clang-format on
+
+constexpr bike_computer::CompressedImage celsius_icon = {
+    .pPalette    = celsius_icon_palette,
+    .pData       = celsius_icon_data,
+    .imageWidth  = kCelsiusIconWidth,
+    .imageHeight = kCelsiusIconHeight};
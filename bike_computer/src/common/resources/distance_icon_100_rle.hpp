@@ -0,0 +1,226 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file distance_icon_100_rle.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Distance icon (size 100) as palette indexed RLE data
+ *        (generated by tools/icon_converter.py from distance_icon_100.hpp)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "common/compressed_image.hpp"
+
+constexpr uint8_t kDistanceIconHeight = 100;
+constexpr uint8_t kDistanceIconWidth  = 100;
+
+// compressed size is 2960 (raw size is 40000)
+// clang-format off
+const uint32_t distance_icon_palette[] = {
+    0x000000ff, 0x010101ff, 0x020202ff, 0x030303ff, 0x040404ff, 0x050505ff, 0x060606ff,
+    0x070707ff, 0x080808ff, 0x090909ff, 0x0a0a0aff, 0x0b0b0bff, 0x0c0c0cff, 0x0d0d0dff,
+    0x0f0f0fff, 0x101010ff, 0x111111ff, 0x121212ff, 0x131313ff, 0x151515ff, 0x161616ff,
+    0x171717ff, 0x181818ff, 0x191919ff, 0x1a1a1aff, 0x1b1b1bff, 0x1c1c1cff, 0x1d1d1dff,
+    0x1e1e1eff, 0x1f1f1fff, 0x202020ff, 0x212121ff, 0x222222ff, 0x232323ff, 0x242424ff,
+    0x252525ff, 0x262626ff, 0x272727ff, 0x282828ff, 0x292929ff, 0x2a2a2aff, 0x2c2c2cff,
+    0x2d2d2dff, 0x2e2e2eff, 0x2f2f2fff, 0x303030ff, 0x313131ff, 0x323232ff, 0x333333ff,
+    0x343434ff, 0x353535ff, 0x363636ff, 0x373737ff, 0x383838ff, 0x3b3b3bff, 0x3c3c3cff,
+    0x3d3d3dff, 0x3e3e3eff, 0x3f3f3fff, 0x404040ff, 0x414141ff, 0x424242ff, 0x434343ff,
+    0x444444ff, 0x454545ff, 0x464646ff, 0x474747ff, 0x4a4a4aff, 0x4b4b4bff, 0x4c4c4cff,
+    0x4d4d4dff, 0x4e4e4eff, 0x4f4f4fff, 0x525252ff, 0x535353ff, 0x545454ff, 0x555555ff,
+    0x565656ff, 0x585858ff, 0x595959ff, 0x5a5a5aff, 0x5b5b5bff, 0x5c5c5cff, 0x5d5d5dff,
+    0x5e5e5eff, 0x616161ff, 0x626262ff, 0x636363ff, 0x646464ff, 0x656565ff, 0x666666ff,
+    0x676767ff, 0x686868ff, 0x696969ff, 0x6a6a6aff, 0x6b6b6bff, 0x6d6d6dff, 0x6e6e6eff,
+    0x707070ff, 0x717171ff, 0x727272ff, 0x747474ff, 0x757575ff, 0x767676ff, 0x777777ff,
+    0x787878ff, 0x797979ff, 0x7a7a7aff, 0x7b7b7bff, 0x7c7c7cff, 0x7d7d7dff, 0x7f7f7fff,
+    0x838383ff, 0x848484ff, 0x858585ff, 0x868686ff, 0x878787ff, 0x888888ff, 0x898989ff,
+    0x8a8a8aff, 0x8b8b8bff, 0x8c8c8cff, 0x8d8d8dff, 0x8f8f8fff, 0x909090ff, 0x919191ff,
+    0x939393ff, 0x949494ff, 0x959595ff, 0x969696ff, 0x989898ff, 0x999999ff, 0x9a9a9aff,
+    0x9c9c9cff, 0x9d9d9dff, 0x9e9e9eff, 0x9f9f9fff, 0xa0a0a0ff, 0xa1a1a1ff, 0xa2a2a2ff,
+    0xa3a3a3ff, 0xa4a4a4ff, 0xa5a5a5ff, 0xa6a6a6ff, 0xa7a7a7ff, 0xa9a9a9ff, 0xaaaaaaff,
+    0xabababff, 0xacacacff, 0xadadadff, 0xaeaeaeff, 0xb0b0b0ff, 0xb1b1b1ff, 0xb2b2b2ff,
+    0xb3b3b3ff, 0xb4b4b4ff, 0xb5b5b5ff, 0xb6b6b6ff, 0xb7b7b7ff, 0xb8b8b8ff, 0xbababaff,
+    0xbcbcbcff, 0xbdbdbdff, 0xbebebeff, 0xbfbfbfff, 0xc0c0c0ff, 0xc1c1c1ff, 0xc2c2c2ff,
+    0xc3c3c3ff, 0xc4c4c4ff, 0xc5c5c5ff, 0xc6c6c6ff, 0xc7c7c7ff, 0xc9c9c9ff, 0xcacacaff,
+    0xcbcbcbff, 0xccccccff, 0xcdcdcdff, 0xcececeff, 0xcfcfcfff, 0xd0d0d0ff, 0xd1d1d1ff,
+    0xd2d2d2ff, 0xd3d3d3ff, 0xd4d4d4ff, 0xd5d5d5ff, 0xd6d6d6ff, 0xd7d7d7ff, 0xd8d8d8ff,
+    0xd9d9d9ff, 0xdadadaff, 0xdbdbdbff, 0xdcdcdcff, 0xddddddff, 0xdededeff, 0xdfdfdfff,
+    0xe0e0e0ff, 0xe1e1e1ff, 0xe2e2e2ff, 0xe3e3e3ff, 0xe4e4e4ff, 0xe5e5e5ff, 0xe6e6e6ff,
+    0xe7e7e7ff, 0xe8e8e8ff, 0xe9e9e9ff, 0xeaeaeaff, 0xebebebff, 0xecececff, 0xedededff,
+    0xeeeeeeff, 0xefefefff, 0xf0f0f0ff, 0xf1f1f1ff, 0xf2f2f2ff, 0xf3f3f3ff, 0xf4f4f4ff,
+    0xf5f5f5ff, 0xf6f6f6ff, 0xf7f7f7ff, 0xf8f8f8ff, 0xf9f9f9ff, 0xfafafaff, 0xfbfbfbff,
+    0xfcfcfcff, 0xfdfdfdff, 0xfefefeff, 0xffffffff,
+};
+
+const uint8_t distance_icon_data[] = {
+    0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3,
+    0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3,
+    0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xa1, 0xe3, 0x07, 0xbb, 0x5c, 0x48,
+    0x3b, 0x2f, 0x20, 0x11, 0x0b, 0x82, 0x00, 0x0b, 0x0d, 0x10, 0x10, 0x1c, 0x2e, 0x42,
+    0x51, 0x61, 0x71, 0x90, 0xae, 0xd1, 0xaa, 0xe3, 0xa0, 0xe3, 0x01, 0xde, 0x19, 0x95,
+    0x00, 0x04, 0x17, 0x45, 0x6f, 0x9b, 0xd7, 0xa5, 0xe3, 0xa0, 0xe3, 0x00, 0xc7, 0x9a,
+    0x00, 0x03, 0x06, 0x3d, 0x76, 0xc1, 0xa2, 0xe3, 0xa1, 0xe3, 0x00, 0x42, 0x9c, 0x00,
+    0x03, 0x01, 0x3d, 0x8d, 0xda, 0x9f, 0xe3, 0xa1, 0xe3, 0x03, 0xde, 0x95, 0x50, 0x0b,
+    0x84, 0x00, 0x01, 0x03, 0x84, 0x82, 0xc1, 0x08, 0xb5, 0xa4, 0x96, 0x86, 0x79, 0x64,
+    0x48, 0x29, 0x08, 0x89, 0x00, 0x02, 0x16, 0x80, 0xde, 0x9d, 0xe3, 0xa4, 0xe3, 0x02,
+    0xd3, 0x78, 0x12, 0x83, 0x00, 0x01, 0x08, 0x9a, 0x89, 0xe3, 0x04, 0xdf, 0xb5, 0x86,
+    0x5c, 0x22, 0x87, 0x00, 0x01, 0x20, 0x95, 0x9c, 0xe3, 0xa6, 0xe3, 0x01, 0xd3, 0x5e,
+    0x83, 0x00, 0x08, 0x08, 0xaf, 0xe3, 0xe3, 0xd5, 0x21, 0x32, 0x80, 0xd3, 0x86, 0xe3,
+    0x02, 0xc1, 0x80, 0x36, 0x86, 0x00, 0x01, 0x5b, 0xdb, 0x9a, 0xe3, 0xa8, 0xe3, 0x01,
+    0x94, 0x0c, 0x82, 0x00, 0x09, 0x25, 0xdc, 0xe3, 0xd5, 0x1d, 0x00, 0x00, 0x11, 0x7e,
+    0xdf, 0x87, 0xe3, 0x02, 0xbb, 0x65, 0x0d, 0x84, 0x00, 0x01, 0x2c, 0xc1, 0x99, 0xe3,
+    0xa9, 0xe3, 0x01, 0x9b, 0x03, 0x82, 0x00, 0x08, 0x7b, 0xe3, 0xe3, 0xdc, 0x91, 0x3d,
+    0x00, 0x00, 0x76, 0x89, 0xe3, 0x01, 0xcf, 0x47, 0x84, 0x00, 0x01, 0x19, 0xbd, 0x98,
+    0xe3, 0xaa, 0xe3, 0x00, 0x72, 0x82, 0x00, 0x01, 0x1f, 0xe2, 0x83, 0xe3, 0x02, 0x9a,
+    0x46, 0xab, 0x88, 0xe3, 0x04, 0xd8, 0x65, 0x04, 0x00, 0x04, 0x83, 0x00, 0x01, 0x20,
+    0xd0, 0x97, 0xe3, 0xaa, 0xe3, 0x01, 0xdb, 0x12, 0x82, 0x00, 0x00, 0xb2, 0x86, 0xe3,
+    0x01, 0xcc, 0xa8, 0x85, 0xe3, 0x06, 0xd0, 0x20, 0x00, 0x03, 0x61, 0xce, 0x4f, 0x83,
+    0x00, 0x00, 0x43, 0x97, 0xe3, 0xab, 0xe3, 0x00, 0x53, 0x82, 0x00, 0x00, 0x83, 0x86,
+    0xe3, 0x02, 0x47, 0x00, 0x8c, 0x84, 0xe3, 0x07, 0xc5, 0x0b, 0x30, 0xaf, 0xe3, 0xe3,
+    0xe1, 0x52, 0x83, 0x00, 0x00, 0x8d, 0x96, 0xe3, 0xab, 0xe3, 0x00, 0x72, 0x82, 0x00,
+    0x00, 0x6b, 0x86, 0xe3, 0x03, 0x8a, 0x00, 0x0c, 0xca, 0x84, 0xe3, 0x00, 0xda, 0x83,
+    0xe3, 0x01, 0xe1, 0x64, 0x83, 0x00, 0x01, 0x20, 0xde, 0x95, 0xe3, 0xab, 0xe3, 0x00,
+    0x76, 0x82, 0x00, 0x00, 0x68, 0x87, 0xe3, 0x02, 0x4a, 0x00, 0x62, 0x88, 0xe3, 0x04,
+    0xdb, 0x4c, 0x00, 0x06, 0x06, 0x82, 0x00, 0x00, 0x93, 0x95, 0xe3, 0xab, 0xe3, 0x00,
+    0x49, 0x82, 0x00, 0x00, 0x75, 0x87, 0xe3, 0x03, 0xb4, 0x00, 0x13, 0xdf, 0x86, 0xe3,
+    0x05, 0xd0, 0x36, 0x00, 0x0e, 0xa1, 0x5e, 0x82, 0x00, 0x00, 0x4c, 0x95, 0xe3, 0xaa,
+    0xe3, 0x01, 0xac, 0x03, 0x82, 0x00, 0x00, 0xa2, 0x88, 0xe3, 0x02, 0x24, 0x00, 0xb0,
+    0x85, 0xe3, 0x06, 0xc0, 0x24, 0x00, 0x1c, 0xb7, 0xe3, 0xb4, 0x82, 0x00, 0x01, 0x0b,
+    0xdb, 0x94, 0xe3, 0xa9, 0xe3, 0x01, 0xce, 0x22, 0x82, 0x00, 0x01, 0x1a, 0xe0, 0x88,
+    0xe3, 0x02, 0x5b, 0x00, 0x9c, 0x84, 0xe3, 0x04, 0xdc, 0x17, 0x00, 0x2e, 0xc9, 0x82,
+    0xe3, 0x00, 0x1f, 0x82, 0x00, 0x00, 0xb5, 0x94, 0xe3, 0xa8, 0xe3, 0x01, 0xd4, 0x31,
+    0x83, 0x00, 0x00, 0x86, 0x89, 0xe3, 0x02, 0xd6, 0xa1, 0xe2, 0x84, 0xe3, 0x03, 0xe0,
+    0x3f, 0x4d, 0xd7, 0x82, 0xe3, 0x01, 0xdf, 0x36, 0x82, 0x00, 0x00, 0x91, 0x94, 0xe3,
+    0xa7, 0xe3, 0x01, 0xc6, 0x2a, 0x83, 0x00, 0x01, 0x44, 0xe2, 0x97, 0xe3, 0x01, 0xc4,
+    0x36, 0x83, 0x00, 0x00, 0x7e, 0x94, 0xe3, 0xa6, 0xe3, 0x01, 0xa9, 0x19, 0x83, 0x00,
+    0x01, 0x35, 0xd7, 0x97, 0xe3, 0x01, 0x93, 0x10, 0x84, 0x00, 0x00, 0x81, 0x94, 0xe3,
+    0xa4, 0xe3, 0x02, 0xe0, 0x70, 0x04, 0x83, 0x00, 0x01, 0x2f, 0xd2, 0x96, 0xe3, 0x05,
+    0xd9, 0x5a, 0x00, 0x00, 0x48, 0x42, 0x82, 0x00, 0x00, 0x88, 0x94, 0xe3, 0xa3, 0xe3,
+    0x01, 0xbd, 0x37, 0x84, 0x00, 0x01, 0x48, 0xd7, 0x8c, 0xe3, 0x02, 0x91, 0x32, 0xc1,
+    0x86, 0xe3, 0x06, 0xb6, 0x28, 0x00, 0x08, 0x7f, 0xe2, 0x29, 0x82, 0x00, 0x00, 0xab,
+    0x94, 0xe3, 0xa1, 0xe3, 0x02, 0xe0, 0x78, 0x09, 0x83, 0x00, 0x02, 0x01, 0x68, 0xe1,
+    0x8d, 0xe3, 0x02, 0x4b, 0x00, 0x96, 0x85, 0xe3, 0x0b, 0xe2, 0x12, 0x00, 0x28, 0xb6,
+    0xe3, 0xc0, 0x01, 0x00, 0x00, 0x03, 0xd4, 0x94, 0xe3, 0xa0, 0xe3, 0x01, 0xaa, 0x2d,
+    0x84, 0x00, 0x01, 0x15, 0x9f, 0x8f, 0xe3, 0x02, 0x2b, 0x00, 0xae, 0x86, 0xe3, 0x05,
+    0x69, 0x66, 0xda, 0xe3, 0xe3, 0x73, 0x82, 0x00, 0x00, 0x36, 0x95, 0xe3, 0x9e, 0xe3,
+    0x02, 0xce, 0x55, 0x01, 0x84, 0x00, 0x01, 0x46, 0xcc, 0x8f, 0xe3, 0x03, 0xb1, 0x00,
+    0x15, 0xde, 0x8a, 0xe3, 0x01, 0xe1, 0x25, 0x82, 0x00, 0x00, 0x77, 0x95, 0xe3, 0x9c,
+    0xe3, 0x02, 0xe0, 0x80, 0x10, 0x84, 0x00, 0x01, 0x12, 0x8d, 0x90, 0xe3, 0x03, 0xdc,
+    0x2d, 0x00, 0x6d, 0x8b, 0xe3, 0x00, 0x91, 0x82, 0x00, 0x01, 0x06, 0xcc, 0x95, 0xe3,
+    0x9b, 0xe3, 0x01, 0xab, 0x30, 0x84, 0x00, 0x02, 0x01, 0x52, 0xcc, 0x90, 0xe3, 0x04,
+    0xda, 0x43, 0x00, 0x28, 0xda, 0x8a, 0xe3, 0x01, 0xe2, 0x2a, 0x82, 0x00, 0x00, 0x50,
+    0x96, 0xe3, 0x99, 0xe3, 0x02, 0xc9, 0x53, 0x01, 0x84, 0x00, 0x01, 0x29, 0xa5, 0x92,
+    0xe3, 0x03, 0x4e, 0x00, 0x16, 0xba, 0x87, 0xe3, 0x04, 0xe1, 0xb1, 0x74, 0x3c, 0x07,
+    0x82, 0x00, 0x01, 0x03, 0xbb, 0x96, 0xe3, 0x97, 0xe3, 0x02, 0xdc, 0x73, 0x0c, 0x84,
+    0x00, 0x02, 0x0d, 0x7a, 0xde, 0x93, 0xe3, 0x02, 0x5c, 0x26, 0xbc, 0x87, 0xe3, 0x01,
+    0xde, 0x26, 0x86, 0x00, 0x00, 0x55, 0x97, 0xe3, 0x96, 0xe3, 0x01, 0x97, 0x21, 0x85,
+    0x00, 0x01, 0x4e, 0xc9, 0xa0, 0xe3, 0x04, 0xdf, 0x28, 0x1e, 0x59, 0x40, 0x82, 0x00,
+    0x01, 0x07, 0xc3, 0x97, 0xe3, 0x94, 0xe3, 0x01, 0xc0, 0x42, 0x85, 0x00, 0x01, 0x2c,
+    0xa5, 0xa5, 0xe3, 0x01, 0xd0, 0x0f, 0x82, 0x00, 0x00, 0x61, 0x98, 0xe3, 0x92, 0xe3,
+    0x02, 0xdd, 0x71, 0x09, 0x84, 0x00, 0x02, 0x12, 0x81, 0xe0, 0x94, 0xe3, 0x01, 0xae,
+    0xbf, 0x8f, 0xe3, 0x00, 0x61, 0x82, 0x00, 0x01, 0x10, 0xd0, 0x98, 0xe3, 0x91, 0xe3,
+    0x01, 0xa6, 0x28, 0x84, 0x00, 0x02, 0x04, 0x60, 0xd1, 0x95, 0xe3, 0x02, 0x70, 0x01,
+    0x2f, 0x8e, 0xe3, 0x01, 0xbe, 0x05, 0x82, 0x00, 0x00, 0x7a, 0x99, 0xe3, 0x8f, 0xe3,
+    0x02, 0xd0, 0x55, 0x01, 0x84, 0x00, 0x01, 0x3c, 0xb7, 0x95, 0xe3, 0x04, 0xde, 0x57,
+    0x00, 0x03, 0x87, 0x8e, 0xe3, 0x00, 0x54, 0x82, 0x00, 0x01, 0x22, 0xdd, 0x99, 0xe3,
+    0x8e, 0xe3, 0x01, 0x97, 0x14, 0x84, 0x00, 0x02, 0x14, 0x8b, 0xe2, 0x95, 0xe3, 0x04,
+    0xd5, 0x41, 0x00, 0x0b, 0x98, 0x8e, 0xe3, 0x01, 0xc2, 0x04, 0x82, 0x00, 0x00, 0x89,
+    0x9a, 0xe3, 0x8c, 0xe3, 0x01, 0xd5, 0x56, 0x84, 0x00, 0x02, 0x01, 0x59, 0xd1, 0x96,
+    0xe3, 0x04, 0xc8, 0x2c, 0x00, 0x15, 0xae, 0x8f, 0xe3, 0x00, 0x68, 0x82, 0x00, 0x01,
+    0x1c, 0xde, 0x9a, 0xe3, 0x8b, 0xe3, 0x01, 0xb9, 0x24, 0x84, 0x00, 0x01, 0x29, 0xa9,
+    0x97, 0xe3, 0x04, 0xc0, 0x1a, 0x00, 0x27, 0xc3, 0x8f, 0xe3, 0x01, 0xdf, 0x15, 0x82,
+    0x00, 0x00, 0x7d, 0x9b, 0xe3, 0x8a, 0xe3, 0x01, 0x92, 0x0c, 0x83, 0x00, 0x02, 0x05,
+    0x70, 0xde, 0x98, 0xe3, 0x03, 0x82, 0x00, 0x3a, 0xd2, 0x90, 0xe3, 0x00, 0xa2, 0x82,
+    0x00, 0x01, 0x0f, 0xd9, 0x9b, 0xe3, 0x89, 0xe3, 0x01, 0x7e, 0x01, 0x83, 0x00, 0x01,
+    0x26, 0xb0, 0x9a, 0xe3, 0x02, 0xdf, 0xa7, 0xde, 0x91, 0xe3, 0x00, 0x62, 0x82, 0x00,
+    0x00, 0x55, 0x9c, 0xe3, 0x88, 0xe3, 0x00, 0x75, 0x84, 0x00, 0x01, 0x53, 0xda, 0xb0,
+    0xe3, 0x00, 0x33, 0x82, 0x00, 0x00, 0x97, 0x9c, 0xe3, 0x87, 0xe3, 0x00, 0x8d, 0x83,
+    0x00, 0x01, 0x04, 0x7d, 0x99, 0xe3, 0x00, 0xdf, 0x96, 0xe3, 0x01, 0xdf, 0x09, 0x82,
+    0x00, 0x00, 0xcd, 0x9c, 0xe3, 0x86, 0xe3, 0x01, 0xb4, 0x0a, 0x82, 0x00, 0x01, 0x08,
+    0x9a, 0x98, 0xe3, 0x03, 0xbe, 0x37, 0x14, 0xd1, 0x95, 0xe3, 0x00, 0xc8, 0x82, 0x00,
+    0x00, 0x14, 0x9d, 0xe3, 0x85, 0xe3, 0x01, 0xe0, 0x2c, 0x82, 0x00, 0x01, 0x09, 0xa3,
+    0x98, 0xe3, 0x04, 0x93, 0x0a, 0x00, 0x20, 0xd5, 0x95, 0xe3, 0x00, 0xb7, 0x82, 0x00,
+    0x00, 0x29, 0x9d, 0xe3, 0x85, 0xe3, 0x00, 0x84, 0x83, 0x00, 0x00, 0x8b, 0x98, 0xe3,
+    0x04, 0x89, 0x03, 0x00, 0x54, 0xd3, 0x96, 0xe3, 0x00, 0xae, 0x82, 0x00, 0x00, 0x31,
+    0x9d, 0xe3, 0x84, 0xe3, 0x01, 0xd6, 0x15, 0x82, 0x00, 0x00, 0x53, 0x98, 0xe3, 0x03,
+    0xa7, 0x05, 0x00, 0x73, 0x98, 0xe3, 0x00, 0xbe, 0x82, 0x00, 0x00, 0x23, 0x9d, 0xe3,
+    0x84, 0xe3, 0x00, 0x7f, 0x82, 0x00, 0x01, 0x0a, 0xc7, 0x97, 0xe3, 0x03, 0xd2, 0x16,
+    0x00, 0x6a, 0x99, 0xe3, 0x00, 0xd0, 0x82, 0x00, 0x01, 0x0b, 0xe0, 0x9c, 0xe3, 0x84,
+    0xe3, 0x00, 0x2c, 0x82, 0x00, 0x00, 0x6e, 0x98, 0xe3, 0x03, 0x61, 0x00, 0x3b, 0xe0,
+    0x9a, 0xe3, 0x00, 0x17, 0x82, 0x00, 0x00, 0xb3, 0x9c, 0xe3, 0x83, 0xe3, 0x00, 0xaf,
+    0x82, 0x00, 0x01, 0x05, 0xcb, 0x97, 0xe3, 0x03, 0xce, 0x04, 0x04, 0xb8, 0x9b, 0xe3,
+    0x00, 0x48, 0x82, 0x00, 0x00, 0x79, 0x9c, 0xe3, 0x83, 0xe3, 0x00, 0x71, 0x82, 0x00,
+    0x03, 0x45, 0x7f, 0x17, 0x73, 0x95, 0xe3, 0x02, 0xde, 0x51, 0x7c, 0x97, 0xe3, 0x05,
+    0xa1, 0x1a, 0x65, 0xe3, 0xe3, 0x79, 0x82, 0x00, 0x00, 0x29, 0x9c, 0xe3, 0x83, 0xe3,
+    0x00, 0x3f, 0x82, 0x00, 0x03, 0x09, 0x00, 0x00, 0x70, 0xb0, 0xe3, 0x06, 0x67, 0x00,
+    0x19, 0xe3, 0xe3, 0xc8, 0x03, 0x82, 0x00, 0x00, 0xa6, 0x9b, 0xe3, 0x83, 0xe3, 0x00,
+    0x0c, 0x83, 0x00, 0x01, 0x1d, 0x97, 0xb1, 0xe3, 0x02, 0xcf, 0x6c, 0xa5, 0x82, 0xe3,
+    0x00, 0x41, 0x82, 0x00, 0x00, 0x39, 0x9b, 0xe3, 0x82, 0xe3, 0x00, 0xcf, 0x82, 0x00,
+    0x02, 0x05, 0x6b, 0xd9, 0xb8, 0xe3, 0x00, 0x9e, 0x83, 0x00, 0x00, 0x99, 0x9a, 0xe3,
+    0x82, 0xe3, 0x00, 0xb2, 0x82, 0x00, 0x00, 0x31, 0xbb, 0xe3, 0x00, 0x38, 0x82, 0x00,
+    0x01, 0x18, 0xd3, 0x99, 0xe3, 0x82, 0xe3, 0x00, 0xa5, 0x82, 0x00, 0x03, 0x38, 0xe3,
+    0xd5, 0xc5, 0xb8, 0xe3, 0x01, 0xa5, 0x01, 0x82, 0x00, 0x00, 0x5a, 0x99, 0xe3, 0x82,
+    0xe3, 0x00, 0xa7, 0x82, 0x00, 0x04, 0x3b, 0x79, 0x11, 0x06, 0xcc, 0x97, 0xe3, 0x00,
+    0xde, 0x9f, 0xe3, 0x00, 0x57, 0x83, 0x00, 0x00, 0x8f, 0x98, 0xe3, 0x82, 0xe3, 0x00,
+    0xaa, 0x85, 0x00, 0x01, 0x45, 0xdd, 0x96, 0xe3, 0x02, 0x79, 0x08, 0xaf, 0x98, 0xe3,
+    0x02, 0xad, 0x27, 0x68, 0x82, 0xe3, 0x01, 0xd3, 0x18, 0x82, 0x00, 0x01, 0x0c, 0xb7,
+    0x97, 0xe3, 0x82, 0xe3, 0x00, 0xc2, 0x83, 0x00, 0x01, 0x2c, 0x9f, 0x98, 0xe3, 0x02,
+    0x6b, 0x00, 0x6c, 0x98, 0xe3, 0x02, 0x6e, 0x00, 0x0e, 0x83, 0xe3, 0x01, 0xa4, 0x04,
+    0x82, 0x00, 0x01, 0x1c, 0xca, 0x96, 0xe3, 0x82, 0xe3, 0x05, 0xde, 0x03, 0x00, 0x00,
+    0x02, 0xd7, 0x99, 0xe3, 0x02, 0x98, 0x00, 0x3f, 0x8e, 0xe3, 0x02, 0xe2, 0x8d, 0xa6,
+    0x86, 0xe3, 0x02, 0xce, 0x62, 0x99, 0x84, 0xe3, 0x00, 0x74, 0x83, 0x00, 0x01, 0x2f,
+    0xd3, 0x95, 0xe3, 0x83, 0xe3, 0x00, 0x27, 0x82, 0x00, 0x05, 0xa6, 0xe3, 0xe3, 0xaa,
+    0x6b, 0xda, 0x94, 0xe3, 0x03, 0xcb, 0x01, 0x0b, 0xd5, 0x8d, 0xe3, 0x03, 0x9a, 0x00,
+    0x03, 0xca, 0x8d, 0xe3, 0x01, 0xe2, 0x50, 0x83, 0x00, 0x01, 0x30, 0xd2, 0x94, 0xe3,
+    0x83, 0xe3, 0x00, 0x56, 0x82, 0x00, 0x05, 0x6d, 0xe3, 0x7b, 0x04, 0x00, 0xa5, 0x95,
+    0xe3, 0x02, 0x3d, 0x00, 0x83, 0x8d, 0xe3, 0x03, 0xbd, 0x10, 0x26, 0xda, 0x8e, 0xe3,
+    0x01, 0xdd, 0x3c, 0x83, 0x00, 0x01, 0x2e, 0xd0, 0x93, 0xe3, 0x83, 0xe3, 0x00, 0x8a,
+    0x82, 0x00, 0x05, 0x26, 0x4e, 0x00, 0x01, 0x69, 0xe2, 0x95, 0xe3, 0x03, 0x8e, 0x00,
+    0x2c, 0xe1, 0x8d, 0xe3, 0x01, 0xde, 0xe1, 0x90, 0xe3, 0x01, 0xd4, 0x35, 0x83, 0x00,
+    0x01, 0x2c, 0xcf, 0x92, 0xe3, 0x83, 0xe3, 0x01, 0xd1, 0x05, 0x83, 0x00, 0x01, 0x0d,
+    0x95, 0x97, 0xe3, 0x03, 0xdb, 0x1c, 0x00, 0x8a, 0xa1, 0xe3, 0x01, 0xd6, 0x37, 0x83,
+    0x00, 0x01, 0x25, 0xbe, 0x91, 0xe3, 0x84, 0xe3, 0x00, 0x44, 0x82, 0x00, 0x01, 0x16,
+    0xbb, 0x99, 0xe3, 0x03, 0x8c, 0x00, 0x1b, 0xd5, 0xa1, 0xe3, 0x01, 0xd8, 0x3c, 0x83,
+    0x00, 0x01, 0x12, 0xa5, 0x90, 0xe3, 0x84, 0xe3, 0x00, 0xa0, 0x82, 0x00, 0x06, 0x06,
+    0xc1, 0xe3, 0xe3, 0xb3, 0x3e, 0x4c, 0x94, 0xe3, 0x03, 0xe1, 0x34, 0x00, 0x54, 0xa2,
+    0xe3, 0x01, 0xda, 0x42, 0x83, 0x00, 0x01, 0x06, 0x86, 0x8f, 0xe3, 0x84, 0xe3, 0x01,
+    0xe2, 0x2a, 0x82, 0x00, 0x05, 0x53, 0xd4, 0x61, 0x03, 0x00, 0x2d, 0x95, 0xe3, 0x03,
+    0xbd, 0x0b, 0x00, 0x94, 0xa2, 0xe3, 0x01, 0xdd, 0x55, 0x84, 0x00, 0x01, 0x58, 0xda,
+    0x8d, 0xe3, 0x85, 0xe3, 0x00, 0x8b, 0x82, 0x00, 0x05, 0x02, 0x14, 0x00, 0x04, 0x63,
+    0xd5, 0x96, 0xe3, 0x02, 0x85, 0x00, 0x63, 0xa4, 0xe3, 0x01, 0x79, 0x03, 0x83, 0x00,
+    0x01, 0x2c, 0xbd, 0x8c, 0xe3, 0x85, 0xe3, 0x01, 0xe1, 0x33, 0x83, 0x00, 0x01, 0x37,
+    0xb5, 0x99, 0xe3, 0x01, 0xb6, 0xdc, 0xa5, 0xe3, 0x01, 0x9f, 0x13, 0x83, 0x00, 0x02,
+    0x0b, 0x7f, 0xe2, 0x8a, 0xe3, 0x86, 0xe3, 0x01, 0xb0, 0x02, 0x82, 0x00, 0x00, 0x5e,
+    0xc3, 0xe3, 0x01, 0xc8, 0x37, 0x84, 0x00, 0x01, 0x36, 0xbf, 0x89, 0xe3, 0x83, 0xe3,
+    0x02, 0xc9, 0x37, 0x03, 0x89, 0x00, 0x01, 0x1e, 0x9d, 0xbc, 0xe3, 0x01, 0x9c, 0x1e,
+    0x89, 0x00, 0x02, 0x03, 0x37, 0xc9, 0x84, 0xe3, 0x83, 0xe3, 0x00, 0x5d, 0x8c, 0x00,
+    0x00, 0x19, 0xbc, 0xe3, 0x00, 0x1b, 0x8c, 0x00, 0x00, 0x5f, 0x84, 0xe3, 0x83, 0xe3,
+    0x00, 0x5e, 0x8c, 0x00, 0x00, 0x19, 0xbc, 0xe3, 0x00, 0x1b, 0x8c, 0x00, 0x00, 0x5f,
+    0x84, 0xe3, 0x83, 0xe3, 0x02, 0xc9, 0x38, 0x03, 0x89, 0x00, 0x01, 0x1f, 0x9e, 0xbc,
+    0xe3, 0x01, 0x9d, 0x1f, 0x89, 0x00, 0x02, 0x03, 0x39, 0xc9, 0x84, 0xe3, 0xe3, 0xe3,
+    0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3,
+    0xe3, 0xe3, 0xe3, 0xe3,
+};
+// clang-format on
+
+constexpr bike_computer::CompressedImage distance_icon = {
+    .pPalette    = distance_icon_palette,
+    .pData       = distance_icon_data,
+    .imageWidth  = kDistanceIconWidth,
+    .imageHeight = kDistanceIconHeight};
@@ -0,0 +1,112 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file distance_icon_50_rle.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Distance icon (size 50) as palette indexed RLE data
+ *        (generated by tools/icon_converter.py from distance_icon_50.hpp)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "common/compressed_image.hpp"
+
+constexpr uint8_t kDistanceIconHeight = 50;
+constexpr uint8_t kDistanceIconWidth  = 50;
+
+// compressed size is 1037 (raw size is 10000)
+// clang-format off
+const uint32_t distance_icon_palette[] = {
+    0x000000ff, 0x010101ff, 0x020202ff, 0x030303ff, 0x050505ff, 0x060606ff, 0x080808ff,
+    0x090909ff, 0x0a0a0aff, 0x0b0b0bff, 0x0c0c0cff, 0x0d0d0dff, 0x101010ff, 0x111111ff,
+    0x131313ff, 0x161616ff, 0x1e1e1eff, 0x2b2b2bff, 0x323232ff, 0x343434ff, 0x373737ff,
+    0x3a3a3aff, 0x424242ff, 0x4a4a4aff, 0x4f4f4fff, 0x515151ff, 0x5d5d5dff, 0x5e5e5eff,
+    0x676767ff, 0x696969ff, 0x6a6a6aff, 0x6b6b6bff, 0x6e6e6eff, 0x717171ff, 0x7c7c7cff,
+    0x7f7f7fff, 0x848484ff, 0x8c8c8cff, 0xa4a4a4ff, 0xa5a5a5ff, 0xa8a8a8ff, 0xafafafff,
+    0xb1b1b1ff, 0xb4b4b4ff, 0xc6c6c6ff, 0xccccccff, 0xd2d2d2ff, 0xdbdbdbff, 0xe6e6e6ff,
+    0xedededff, 0xf0f0f0ff, 0xf1f1f1ff, 0xf3f3f3ff, 0xf6f6f6ff, 0xf7f7f7ff, 0xf9f9f9ff,
+    0xfcfcfcff, 0xfdfdfdff, 0xfefefeff, 0xffffffff,
+};
+
+const uint8_t distance_icon_data[] = {
+    0x83, 0x3b, 0x00, 0x2e, 0x84, 0x00, 0xa7, 0x3b, 0x82, 0x3b, 0x87, 0x00, 0x00, 0x03,
+    0xa5, 0x3b, 0x01, 0x3b, 0x3b, 0x82, 0x00, 0x00, 0x39, 0x82, 0x3b, 0x00, 0x09, 0x82,
+    0x00, 0xa4, 0x3b, 0x00, 0x3b, 0x82, 0x00, 0x86, 0x3b, 0x02, 0x00, 0x00, 0x1e, 0xa3,
+    0x3b, 0x02, 0x2e, 0x00, 0x00, 0x82, 0x3b, 0x02, 0x00, 0x00, 0x0f, 0x82, 0x3b, 0x01,
+    0x00, 0x00, 0xa3, 0x3b, 0x04, 0x00, 0x00, 0x39, 0x3b, 0x3b, 0x84, 0x00, 0x04, 0x3b,
+    0x3b, 0x00, 0x00, 0x39, 0xa2, 0x3b, 0x03, 0x00, 0x00, 0x3b, 0x3b, 0x82, 0x00, 0x07,
+    0x3b, 0x00, 0x00, 0x3b, 0x3b, 0x11, 0x00, 0x10, 0xa2, 0x3b, 0x0e, 0x00, 0x00, 0x3b,
+    0x3b, 0x00, 0x00, 0x3b, 0x3b, 0x00, 0x00, 0x3b, 0x3b, 0x23, 0x00, 0x00, 0xa2, 0x3b,
+    0x04, 0x00, 0x00, 0x3b, 0x3b, 0x0f, 0x84, 0x00, 0x04, 0x3b, 0x3b, 0x00, 0x00, 0x34,
+    0xa2, 0x3b, 0x04, 0x15, 0x00, 0x00, 0x3b, 0x3b, 0x83, 0x00, 0x04, 0x24, 0x3b, 0x3b,
+    0x00, 0x00, 0xa3, 0x3b, 0x02, 0x3b, 0x00, 0x00, 0x87, 0x3b, 0x02, 0x26, 0x00, 0x00,
+    0xa3, 0x3b, 0x03, 0x3b, 0x00, 0x00, 0x13, 0x86, 0x3b, 0x01, 0x00, 0x00, 0xa4, 0x3b,
+    0x03, 0x3b, 0x3b, 0x00, 0x00, 0x85, 0x3b, 0x02, 0x26, 0x00, 0x00, 0xa4, 0x3b, 0x04,
+    0x3b, 0x3b, 0x00, 0x00, 0x07, 0x84, 0x3b, 0x02, 0x00, 0x00, 0x39, 0xa4, 0x3b, 0x82,
+    0x3b, 0x01, 0x00, 0x00, 0x83, 0x3b, 0x02, 0x0e, 0x00, 0x00, 0xa5, 0x3b, 0x82, 0x3b,
+    0x82, 0x00, 0x82, 0x3b, 0x01, 0x00, 0x00, 0xa6, 0x3b, 0x83, 0x3b, 0x03, 0x00, 0x00,
+    0x3b, 0x3b, 0x82, 0x00, 0xa6, 0x3b, 0x83, 0x3b, 0x05, 0x2c, 0x00, 0x00, 0x2f, 0x00,
+    0x00, 0xa7, 0x3b, 0x84, 0x3b, 0x83, 0x00, 0x00, 0x31, 0xa7, 0x3b, 0x85, 0x3b, 0x82,
+    0x00, 0x01, 0x3b, 0x11, 0x83, 0x00, 0xa2, 0x3b, 0x85, 0x3b, 0x01, 0x29, 0x00, 0x82,
+    0x3b, 0x83, 0x00, 0x03, 0x3b, 0x3b, 0x32, 0x00, 0x9e, 0x3b, 0x90, 0x3b, 0x03, 0x05,
+    0x00, 0x00, 0x0c, 0x8f, 0x3b, 0x00, 0x02, 0x85, 0x00, 0x85, 0x3b, 0x91, 0x3b, 0x03,
+    0x27, 0x00, 0x00, 0x08, 0x8c, 0x3b, 0x00, 0x02, 0x89, 0x00, 0x83, 0x3b, 0x93, 0x3b,
+    0x02, 0x00, 0x00, 0x3a, 0x8a, 0x3b, 0x82, 0x00, 0x00, 0x04, 0x84, 0x3b, 0x00, 0x1a,
+    0x82, 0x00, 0x82, 0x3b, 0x93, 0x3b, 0x01, 0x25, 0x00, 0x8a, 0x3b, 0x82, 0x00, 0x88,
+    0x3b, 0x82, 0x00, 0x01, 0x3b, 0x3b, 0x9f, 0x3b, 0x02, 0x2b, 0x00, 0x00, 0x82, 0x3b,
+    0x00, 0x19, 0x83, 0x00, 0x82, 0x3b, 0x82, 0x00, 0x00, 0x3b, 0x9f, 0x3b, 0x04, 0x00,
+    0x00, 0x38, 0x3b, 0x3b, 0x86, 0x00, 0x82, 0x3b, 0x02, 0x00, 0x00, 0x3b, 0x95, 0x3b,
+    0x01, 0x00, 0x00, 0x87, 0x3b, 0x03, 0x00, 0x00, 0x3b, 0x3b, 0x82, 0x00, 0x82, 0x3b,
+    0x82, 0x00, 0x04, 0x3b, 0x3b, 0x07, 0x00, 0x09, 0x95, 0x3b, 0x01, 0x00, 0x00, 0x86,
+    0x3b, 0x06, 0x00, 0x00, 0x17, 0x3b, 0x3b, 0x00, 0x00, 0x84, 0x3b, 0x06, 0x00, 0x00,
+    0x16, 0x3b, 0x3b, 0x00, 0x00, 0x95, 0x3b, 0x01, 0x00, 0x00, 0x86, 0x3b, 0x06, 0x00,
+    0x00, 0x3b, 0x3b, 0x14, 0x00, 0x0d, 0x85, 0x3b, 0x05, 0x00, 0x00, 0x3b, 0x3b, 0x00,
+    0x00, 0x95, 0x3b, 0x01, 0x00, 0x00, 0x86, 0x3b, 0x06, 0x00, 0x00, 0x3b, 0x3b, 0x00,
+    0x00, 0x1b, 0x85, 0x3b, 0x05, 0x00, 0x00, 0x3b, 0x3b, 0x00, 0x00, 0x95, 0x3b, 0x02,
+    0x0a, 0x00, 0x23, 0x85, 0x3b, 0x06, 0x00, 0x00, 0x21, 0x3b, 0x3b, 0x00, 0x00, 0x84,
+    0x3b, 0x06, 0x12, 0x00, 0x00, 0x3b, 0x3b, 0x00, 0x00, 0x96, 0x3b, 0x00, 0x00, 0x87,
+    0x3b, 0x06, 0x00, 0x00, 0x3b, 0x3b, 0x00, 0x00, 0x22, 0x83, 0x3b, 0x06, 0x00, 0x00,
+    0x3b, 0x3b, 0x16, 0x00, 0x01, 0x9f, 0x3b, 0x04, 0x00, 0x00, 0x3b, 0x3b, 0x30, 0x86,
+    0x00, 0x05, 0x02, 0x3b, 0x3b, 0x00, 0x00, 0x3b, 0x9f, 0x3b, 0x05, 0x00, 0x00, 0x28,
+    0x3b, 0x3b, 0x36, 0x84, 0x00, 0x00, 0x13, 0x82, 0x3b, 0x02, 0x00, 0x00, 0x3b, 0x96,
+    0x3b, 0x01, 0x00, 0x00, 0x87, 0x3b, 0x01, 0x00, 0x00, 0x8a, 0x3b, 0x03, 0x00, 0x00,
+    0x07, 0x3b, 0x96, 0x3b, 0x01, 0x00, 0x00, 0x87, 0x3b, 0x01, 0x00, 0x00, 0x8a, 0x3b,
+    0x03, 0x00, 0x00, 0x3b, 0x3b, 0x96, 0x3b, 0x01, 0x00, 0x00, 0x87, 0x3b, 0x02, 0x20,
+    0x00, 0x00, 0x88, 0x3b, 0x04, 0x1f, 0x00, 0x00, 0x3b, 0x3b, 0x96, 0x3b, 0x01, 0x00,
+    0x00, 0x88, 0x3b, 0x01, 0x00, 0x00, 0x88, 0x3b, 0x04, 0x00, 0x00, 0x3a, 0x3b, 0x3b,
+    0x96, 0x3b, 0x01, 0x00, 0x00, 0x88, 0x3b, 0x02, 0x0b, 0x00, 0x00, 0x86, 0x3b, 0x02,
+    0x2d, 0x00, 0x00, 0x82, 0x3b, 0x96, 0x3b, 0x01, 0x00, 0x00, 0x89, 0x3b, 0x01, 0x00,
+    0x00, 0x86, 0x3b, 0x02, 0x00, 0x00, 0x39, 0x82, 0x3b, 0xa2, 0x3b, 0x82, 0x00, 0x84,
+    0x3b, 0x02, 0x27, 0x00, 0x00, 0x83, 0x3b, 0xa3, 0x3b, 0x01, 0x00, 0x00, 0x84, 0x3b,
+    0x02, 0x00, 0x00, 0x39, 0x83, 0x3b, 0x98, 0x3b, 0x01, 0x00, 0x1d, 0x88, 0x3b, 0x02,
+    0x01, 0x00, 0x00, 0x82, 0x3b, 0x02, 0x18, 0x00, 0x00, 0x84, 0x3b, 0x98, 0x3b, 0x01,
+    0x00, 0x00, 0x89, 0x3b, 0x06, 0x00, 0x00, 0x3a, 0x3b, 0x3b, 0x00, 0x00, 0x85, 0x3b,
+    0x98, 0x3b, 0x82, 0x00, 0x88, 0x3b, 0x06, 0x1c, 0x00, 0x00, 0x3b, 0x06, 0x00, 0x00,
+    0x85, 0x3b, 0x99, 0x3b, 0x82, 0x00, 0x88, 0x3b, 0x04, 0x00, 0x00, 0x33, 0x00, 0x00,
+    0x86, 0x3b, 0x9a, 0x3b, 0x05, 0x00, 0x00, 0x2a, 0x3b, 0x3b, 0x38, 0x84, 0x3b, 0x00,
+    0x35, 0x83, 0x00, 0x86, 0x3b, 0x9e, 0x3b, 0x85, 0x00, 0x01, 0x37, 0x3b, 0x82, 0x00,
+    0x87, 0x3b, 0x9f, 0x3b, 0x84, 0x00, 0x82, 0x3b, 0x01, 0x00, 0x1d, 0x87, 0x3b,
+};
+// clang-format on
+
+constexpr bike_computer::CompressedImage distance_icon = {
+    .pPalette    = distance_icon_palette,
+    .pData       = distance_icon_data,
+    .imageWidth  = kDistanceIconWidth,
+    .imageHeight = kDistanceIconHeight};
@@ -0,0 +1,81 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file font16_packed.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Packed font (size 16) restricted to the characters used by BikeDisplay
+ *        (generated by tools/font_converter.py from fonts16.cpp)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "common/packed_font.hpp"
+
+// clang-format off
+// 168 bytes
+const uint8_t kFont16Bitmap[] = {
+    0xfc, 0xc4, 0xb1, 0x86, 0x18, 0x61, 0x87, 0x14, 0x8c, 0x6e, 0x66, 0x66, 0x66, 0x66,
+    0xf7, 0x26, 0x0c, 0x30, 0x82, 0x10, 0x00, 0x00, 0xfd, 0xc9, 0x82, 0x08, 0x47, 0x87,
+    0x0c, 0x20, 0xbc, 0x04, 0x18, 0x50, 0x22, 0x48, 0x81, 0x7f, 0x04, 0x08, 0x11, 0xe8,
+    0x21, 0xc0, 0xc1, 0x02, 0x08, 0x01, 0x70, 0x19, 0x8c, 0x21, 0xf6, 0x70, 0xc3, 0x0a,
+    0x67, 0x7f, 0x08, 0x21, 0x04, 0x10, 0x82, 0x08, 0x41, 0x0f, 0x67, 0x0e, 0x2d, 0x18,
+    0xb4, 0x70, 0xe2, 0xf3, 0x99, 0x43, 0x0c, 0x39, 0xbe, 0x10, 0xc6, 0x61, 0xfe, 0x10,
+    0xc4, 0x11, 0x04, 0x43, 0x1f, 0x84, 0x31, 0x06, 0x41, 0x90, 0xdf, 0xe0, 0xf1, 0x87,
+    0x81, 0xc0, 0x40, 0x20, 0x10, 0x0c, 0x06, 0x01, 0x84, 0x7c, 0x72, 0x2f, 0xe0, 0x83,
+    0x07, 0x10, 0x01, 0x64, 0x92, 0xec, 0x1c, 0x0c, 0x0c, 0x0c, 0xed, 0x0e, 0x0e, 0x0d,
+    0x0c, 0x9e, 0xed, 0x9d, 0xcc, 0x4c, 0x44, 0xc4, 0x4c, 0x44, 0xc4, 0x5e, 0xee, 0xf6,
+    0x70, 0xc3, 0x0e, 0x6f, 0x2e, 0xe6, 0x85, 0x0b, 0x16, 0x6f, 0x90, 0x30, 0x7f, 0x18,
+    0xc6, 0x33, 0xcd, 0xec, 0xcc, 0xcc, 0x7d, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xe6, 0xc0,
+};
+
+// character, x offset, y offset, width, height, bit offset
+const bike_computer::PackedGlyph kFont16Glyphs[] = {
+    {' ', 0, 0, 0, 0, 0},
+    {'-', 6, 11, 4, 1, 0},
+    {'.', 6, 14, 2, 1, 4},
+    {'0', 4, 4, 6, 11, 6},
+    {'1', 5, 4, 4, 11, 72},
+    {'2', 4, 4, 6, 11, 116},
+    {'3', 4, 4, 6, 11, 182},
+    {'4', 3, 4, 7, 11, 248},
+    {'5', 4, 4, 6, 11, 325},
+    {'6', 4, 4, 6, 11, 391},
+    {'7', 4, 4, 6, 11, 457},
+    {'8', 4, 4, 6, 11, 523},
+    {'9', 4, 4, 6, 11, 589},
+    {'B', 2, 4, 10, 11, 655},
+    {'C', 3, 4, 9, 11, 765},
+    {'e', 5, 8, 6, 7, 864},
+    {'i', 6, 4, 3, 11, 906},
+    {'k', 3, 4, 8, 11, 939},
+    {'m', 1, 8, 12, 7, 1027},
+    {'o', 4, 8, 6, 7, 1111},
+    {'p', 3, 7, 7, 9, 1153},
+    {'r', 4, 8, 5, 7, 1216},
+    {'t', 5, 7, 4, 8, 1251},
+    {'u', 3, 8, 8, 7, 1283},
+};
+// clang-format on
+
+constexpr bike_computer::PackedFont kFont16 = {
+    .pGlyphs     = kFont16Glyphs,
+    .nbrOfGlyphs = sizeof(kFont16Glyphs) / sizeof(kFont16Glyphs[0]),
+    .pBitmap     = kFont16Bitmap,
+    .width       = 15,
+    .height      = 16};
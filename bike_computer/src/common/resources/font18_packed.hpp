@@ -0,0 +1,98 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file font18_packed.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Packed font (size 18) restricted to the characters used by BikeDisplay
+ *        (generated by tools/font_converter.py from fonts18.cpp)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "common/packed_font.hpp"
+
+// clang-format off
+// 397 bytes
+const uint8_t kFont18Bitmap[] = {
+    0xff, 0xff, 0x1e, 0x0c, 0xc6, 0x19, 0x82, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0,
+    0x3c, 0x0f, 0x03, 0x61, 0x98, 0x63, 0x30, 0x78, 0x33, 0xc3, 0x0c, 0x30, 0xc3, 0x0c,
+    0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x3f, 0x3e, 0x1f, 0xc4, 0x3a, 0x06, 0x81, 0x80, 0x60,
+    0x10, 0x04, 0x02, 0x01, 0x80, 0x40, 0x20, 0x10, 0x08, 0x37, 0xfb, 0xfe, 0x3c, 0x3f,
+    0x21, 0xc0, 0x60, 0x30, 0x10, 0x30, 0x3e, 0x07, 0x01, 0xc0, 0x60, 0x30, 0x18, 0x0b,
+    0x09, 0xf8, 0x03, 0x00, 0xc0, 0x70, 0x1c, 0x0b, 0x04, 0xc1, 0x30, 0x8c, 0x23, 0x10,
+    0xc8, 0x33, 0xff, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x1f, 0x8f, 0x88, 0x04, 0x07, 0x83,
+    0xf0, 0x3c, 0x06, 0x01, 0x80, 0xc0, 0x60, 0x10, 0x10, 0x0b, 0x08, 0xf8, 0x01, 0xc1,
+    0x81, 0x80, 0xc0, 0x20, 0x18, 0x05, 0xf3, 0x8e, 0xc1, 0xf0, 0x3c, 0x0f, 0x03, 0x40,
+    0xd8, 0x23, 0x10, 0x78, 0x7f, 0xdf, 0xec, 0x0a, 0x04, 0x01, 0x00, 0x40, 0x20, 0x08,
+    0x02, 0x01, 0x00, 0x40, 0x10, 0x08, 0x02, 0x00, 0x80, 0x40, 0x3f, 0x18, 0x6c, 0x0f,
+    0x03, 0xe0, 0xdc, 0x63, 0xa0, 0x78, 0x1f, 0x18, 0xe4, 0x1f, 0x03, 0xc0, 0xf0, 0x36,
+    0x18, 0xfc, 0x1e, 0x08, 0xc4, 0x1b, 0x02, 0xc0, 0xf0, 0x3c, 0x0f, 0x83, 0x71, 0xcf,
+    0xa0, 0x18, 0x04, 0x03, 0x01, 0x81, 0x83, 0x80, 0xff, 0xc0, 0xc1, 0xc3, 0x03, 0x8c,
+    0x06, 0x30, 0x18, 0xc0, 0x63, 0x03, 0x0f, 0xf8, 0x30, 0x78, 0xc0, 0x63, 0x00, 0xcc,
+    0x03, 0x30, 0x0c, 0xc0, 0x63, 0x03, 0xbf, 0xf8, 0x07, 0xe4, 0x60, 0xf3, 0x00, 0xd8,
+    0x03, 0x60, 0x07, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x18,
+    0x00, 0x60, 0x04, 0xc0, 0x21, 0x83, 0x01, 0xf0, 0x1e, 0x31, 0x90, 0x78, 0x3f, 0xfe,
+    0x03, 0x01, 0xc1, 0x71, 0x3f, 0x87, 0x06, 0x18, 0x00, 0x00, 0x00, 0x67, 0x86, 0x18,
+    0x61, 0x86, 0x18, 0x61, 0x9f, 0x98, 0x07, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+    0x18, 0xf1, 0x84, 0x18, 0x81, 0x90, 0x1a, 0x01, 0xe0, 0x1b, 0x01, 0x98, 0x18, 0xc1,
+    0x86, 0x7e, 0xf9, 0x9c, 0x73, 0xf7, 0xcc, 0x61, 0x86, 0x30, 0xc3, 0x18, 0x61, 0x8c,
+    0x30, 0xc6, 0x18, 0x63, 0x0c, 0x31, 0x86, 0x18, 0xc3, 0x0d, 0xf3, 0xcf, 0x1e, 0x08,
+    0xe4, 0x1b, 0x03, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0x60, 0x9c, 0x41, 0xe0, 0xde, 0x7c,
+    0x63, 0x0e, 0x60, 0xcc, 0x19, 0x83, 0x30, 0x66, 0x0c, 0xc3, 0x1c, 0x63, 0x70, 0x60,
+    0x0c, 0x01, 0x80, 0x30, 0x1f, 0x80, 0xdf, 0xec, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc3, 0xf0, 0x40, 0x83, 0x06, 0x3f, 0x98, 0x30, 0x60, 0xc1, 0x83, 0x06, 0x0c,
+    0x19, 0x1d, 0xe7, 0x86, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x18,
+    0x61, 0x86, 0x3e, 0x3d, 0x80,
+};
+
+// character, x offset, y offset, width, height, bit offset
+const bike_computer::PackedGlyph kFont18Glyphs[] = {
+    {' ', 0, 0, 0, 0, 0},
+    {'-', 8, 10, 6, 2, 0},
+    {'.', 10, 15, 2, 2, 12},
+    {'0', 6, 1, 10, 16, 16},
+    {'1', 8, 1, 6, 16, 176},
+    {'2', 6, 1, 10, 16, 272},
+    {'3', 6, 1, 9, 16, 432},
+    {'4', 6, 1, 10, 16, 576},
+    {'5', 6, 1, 9, 16, 736},
+    {'6', 6, 1, 10, 16, 880},
+    {'7', 6, 1, 10, 16, 1040},
+    {'8', 6, 1, 10, 16, 1200},
+    {'9', 6, 1, 10, 16, 1360},
+    {'B', 4, 1, 14, 16, 1520},
+    {'C', 4, 1, 14, 16, 1744},
+    {'e', 7, 6, 9, 11, 1968},
+    {'i', 9, 0, 6, 17, 2067},
+    {'k', 5, 0, 12, 17, 2169},
+    {'m', 2, 6, 17, 11, 2373},
+    {'o', 6, 6, 10, 11, 2560},
+    {'p', 5, 6, 11, 16, 2670},
+    {'r', 7, 6, 8, 11, 2846},
+    {'t', 8, 2, 7, 15, 2934},
+    {'u', 5, 6, 12, 11, 3039},
+};
+// clang-format on
+
+constexpr bike_computer::PackedFont kFont18 = {
+    .pGlyphs     = kFont18Glyphs,
+    .nbrOfGlyphs = sizeof(kFont18Glyphs) / sizeof(kFont18Glyphs[0]),
+    .pBitmap     = kFont18Bitmap,
+    .width       = 22,
+    .height      = 23};
@@ -0,0 +1,136 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file font26b_packed.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Packed font (size 26b) restricted to the characters used by BikeDisplay
+ *        (generated by tools/font_converter.py from fonts26b.cpp)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "common/packed_font.hpp"
+
+// clang-format off
+// 935 bytes
+const uint8_t kFont26bBitmap[] = {
+    0xff, 0xff, 0xff, 0xfd, 0xdf, 0xff, 0xdc, 0x0f, 0x80, 0x31, 0x80, 0xe1, 0x83, 0x83,
+    0x8f, 0x07, 0x9e, 0x0f, 0x3c, 0x1e, 0xf8, 0x3f, 0xf0, 0x7f, 0xe0, 0xff, 0xc1, 0xff,
+    0x83, 0xff, 0x07, 0xfe, 0x0f, 0xfc, 0x1f, 0xf8, 0x3f, 0xf0, 0x7d, 0xe0, 0xf3, 0xc1,
+    0xe7, 0x83, 0xc7, 0x07, 0x07, 0x0c, 0x06, 0x30, 0x07, 0xc0, 0x03, 0x00, 0xf0, 0x3f,
+    0x0f, 0xf1, 0xbf, 0x01, 0xf0, 0x1f, 0x01, 0xf0, 0x1f, 0x01, 0xf0, 0x1f, 0x01, 0xf0,
+    0x1f, 0x01, 0xf0, 0x1f, 0x01, 0xf0, 0x1f, 0x01, 0xf0, 0x1f, 0x01, 0xf0, 0x1f, 0x01,
+    0xf0, 0x3f, 0x9f, 0xfe, 0x0f, 0xc0, 0x1f, 0xf0, 0x7f, 0xf8, 0x7f, 0xf8, 0xe1, 0xfc,
+    0x80, 0xfc, 0x80, 0x7c, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0x78, 0x00, 0x78, 0x00, 0xf0,
+    0x00, 0xe0, 0x01, 0xc0, 0x01, 0x80, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x02, 0x0c, 0x06,
+    0x1f, 0xfe, 0x3f, 0xfc, 0x7f, 0xfc, 0xff, 0xfd, 0xff, 0xfc, 0x07, 0xe0, 0x1f, 0xf8,
+    0x61, 0xf8, 0xc0, 0xfc, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0x78, 0x00, 0xe0, 0x00, 0x80,
+    0x03, 0xe0, 0x0f, 0xf8, 0x07, 0xfc, 0x01, 0xfe, 0x00, 0xfe, 0x00, 0x7e, 0x00, 0x7e,
+    0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3c, 0xc0, 0x3d, 0xf0, 0x79, 0xf8, 0x70, 0xff, 0xe0,
+    0x7f, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x78, 0x00, 0xf8, 0x01, 0xf8, 0x02, 0xf8,
+    0x02, 0xf8, 0x04, 0xf8, 0x08, 0xf8, 0x10, 0xf8, 0x10, 0xf8, 0x20, 0xf8, 0x40, 0xf8,
+    0x80, 0xf9, 0x00, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xf8,
+    0x00, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x1f, 0xfc, 0x7f, 0xf0, 0xff, 0xe1,
+    0xff, 0xc7, 0xff, 0x08, 0x00, 0x10, 0x00, 0x7e, 0x00, 0xff, 0x81, 0xff, 0x87, 0xff,
+    0xcf, 0xff, 0xc0, 0x7f, 0x80, 0x1f, 0x80, 0x1f, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x18,
+    0x00, 0x37, 0x00, 0x7f, 0x00, 0xbf, 0x03, 0x3f, 0x8c, 0x3f, 0xe0, 0x00, 0x1e, 0x00,
+    0xf8, 0x03, 0xc0, 0x0f, 0x80, 0x1f, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x78, 0x00, 0xf8,
+    0x00, 0xf8, 0x00, 0xff, 0xe1, 0xf0, 0xf9, 0xf0, 0x7d, 0xf0, 0x7d, 0xf0, 0x3f, 0xf0,
+    0x3f, 0xf0, 0x3f, 0xf0, 0x3e, 0xf0, 0x3e, 0xf8, 0x3c, 0x78, 0x3c, 0x78, 0x38, 0x1c,
+    0x70, 0x0f, 0xc0, 0x7f, 0xfd, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xcf, 0xff, 0x98, 0x03,
+    0x60, 0x0c, 0x80, 0x18, 0x00, 0x30, 0x00, 0xc0, 0x01, 0x80, 0x06, 0x00, 0x0c, 0x00,
+    0x18, 0x00, 0x60, 0x00, 0xc0, 0x01, 0x80, 0x06, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x60,
+    0x00, 0xc0, 0x01, 0x80, 0x06, 0x00, 0x1f, 0xc0, 0xf0, 0xe3, 0xc1, 0xe7, 0x81, 0xff,
+    0x03, 0xfe, 0x07, 0xfe, 0x0f, 0xfe, 0x1c, 0xfe, 0x79, 0xff, 0xe1, 0xff, 0x01, 0xff,
+    0x01, 0xff, 0x07, 0xff, 0x3c, 0x7e, 0x70, 0x7f, 0xe0, 0xff, 0xc0, 0xff, 0x81, 0xff,
+    0x03, 0xfe, 0x07, 0x9e, 0x0e, 0x1e, 0x38, 0x0f, 0xc0, 0x0f, 0x80, 0x38, 0xe0, 0x70,
+    0x70, 0xf0, 0x78, 0xf0, 0x7d, 0xf0, 0x3d, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0,
+    0x3e, 0xf8, 0x3e, 0xf8, 0x3e, 0x7c, 0x3e, 0x1f, 0xfc, 0x00, 0x7c, 0x00, 0x7c, 0x00,
+    0x78, 0x00, 0xf8, 0x01, 0xf0, 0x03, 0xe0, 0x07, 0xc0, 0x0f, 0x00, 0x7c, 0x01, 0xe0,
+    0x01, 0xff, 0xfe, 0x03, 0xf0, 0xfc, 0x0f, 0x81, 0xf0, 0x7c, 0x0f, 0x83, 0xe0, 0x3e,
+    0x1f, 0x01, 0xf0, 0xf8, 0x0f, 0x87, 0xc0, 0x7c, 0x3e, 0x07, 0xc1, 0xf0, 0x3e, 0x0f,
+    0x87, 0xc0, 0x7f, 0xfc, 0x03, 0xe1, 0xf8, 0x1f, 0x03, 0xe0, 0xf8, 0x1f, 0x87, 0xc0,
+    0x7e, 0x3e, 0x03, 0xf1, 0xf0, 0x1f, 0x8f, 0x80, 0xfc, 0x7c, 0x07, 0xe3, 0xe0, 0x7e,
+    0x1f, 0x03, 0xe1, 0xf8, 0x7e, 0x3f, 0xff, 0xc0, 0x00, 0xfe, 0x08, 0x0f, 0x06, 0x60,
+    0xf0, 0x07, 0x87, 0x80, 0x0e, 0x3e, 0x00, 0x19, 0xf0, 0x00, 0x67, 0xc0, 0x00, 0xbe,
+    0x00, 0x02, 0xf8, 0x00, 0x07, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x00, 0x01, 0xf8,
+    0x00, 0x07, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x00, 0x00, 0xf8, 0x00, 0x03, 0xf0,
+    0x00, 0x07, 0xc0, 0x00, 0x1f, 0x80, 0x04, 0x3e, 0x00, 0x30, 0x7c, 0x01, 0x80, 0x7c,
+    0x1c, 0x00, 0x7f, 0x80, 0x0f, 0x80, 0xe7, 0x87, 0x0f, 0x3c, 0x3c, 0xf0, 0xff, 0xc3,
+    0xff, 0xff, 0xfc, 0x01, 0xf0, 0x07, 0xc0, 0x1f, 0x80, 0x3e, 0x02, 0xfc, 0x11, 0xf8,
+    0x83, 0xfc, 0x07, 0xe0, 0x38, 0x3e, 0x1f, 0x0f, 0x83, 0x80, 0x00, 0x00, 0x01, 0xfc,
+    0x3e, 0x1f, 0x0f, 0x87, 0xc3, 0xe1, 0xf0, 0xf8, 0x7c, 0x3e, 0x1f, 0x0f, 0x87, 0xc3,
+    0xe1, 0xf3, 0xff, 0xfc, 0x00, 0x0f, 0x80, 0x01, 0xf0, 0x00, 0x3e, 0x00, 0x07, 0xc0,
+    0x00, 0xf8, 0x00, 0x1f, 0x00, 0x03, 0xe0, 0x00, 0x7c, 0x3f, 0x0f, 0x83, 0x81, 0xf0,
+    0x60, 0x3e, 0x08, 0x07, 0xc2, 0x00, 0xf8, 0xc0, 0x1f, 0x3c, 0x03, 0xef, 0x80, 0x7f,
+    0xf8, 0x0f, 0x9f, 0x01, 0xf3, 0xf0, 0x3e, 0x3f, 0x07, 0xc3, 0xe0, 0xf8, 0x7e, 0x1f,
+    0x07, 0xef, 0xf9, 0xff, 0xfc, 0xf8, 0x3c, 0x0f, 0xbf, 0x9f, 0xc1, 0xf8, 0xfc, 0x7c,
+    0x3e, 0x1f, 0x0f, 0x87, 0xc3, 0xe1, 0xf0, 0xf8, 0x7c, 0x3e, 0x1f, 0x0f, 0x87, 0xc3,
+    0xe1, 0xf0, 0xf8, 0x7c, 0x3e, 0x1f, 0x0f, 0x87, 0xc3, 0xe1, 0xf0, 0xf8, 0x7c, 0x3e,
+    0x1f, 0x0f, 0x87, 0xc3, 0xe1, 0xf0, 0xf8, 0x7c, 0x3e, 0x1f, 0x0f, 0x87, 0xcf, 0xf3,
+    0xf9, 0xfe, 0x0f, 0xc0, 0x38, 0x70, 0x78, 0x78, 0xf0, 0x3c, 0xf0, 0x3d, 0xf0, 0x3f,
+    0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x3e, 0xf0, 0x3c, 0xf0, 0x3c,
+    0x78, 0x78, 0x38, 0x70, 0x0f, 0xc1, 0xfd, 0xf0, 0x3f, 0xfe, 0x1f, 0x8f, 0x8f, 0x87,
+    0xc7, 0xc1, 0xe3, 0xe0, 0xf9, 0xf0, 0x7c, 0xf8, 0x3e, 0x7c, 0x1f, 0x3e, 0x0f, 0x9f,
+    0x07, 0xcf, 0x83, 0xc7, 0xc1, 0xe3, 0xe1, 0xf1, 0xf8, 0xf0, 0xfb, 0xe0, 0x7c, 0x00,
+    0x3e, 0x00, 0x1f, 0x00, 0x0f, 0x80, 0x07, 0xc0, 0x03, 0xe0, 0x07, 0xfc, 0x03, 0xf8,
+    0xe3, 0xe7, 0xcf, 0xaf, 0x3f, 0x3c, 0xfc, 0x63, 0xe0, 0x0f, 0x80, 0x3e, 0x00, 0xf8,
+    0x03, 0xe0, 0x0f, 0x80, 0x3e, 0x00, 0xf8, 0x03, 0xe0, 0x0f, 0x80, 0xff, 0x80, 0x08,
+    0x01, 0x00, 0x60, 0x1c, 0x07, 0x81, 0xf0, 0x7f, 0xff, 0xfc, 0xf8, 0x1f, 0x03, 0xe0,
+    0x7c, 0x0f, 0x81, 0xf0, 0x3e, 0x07, 0xc0, 0xf8, 0x1f, 0x03, 0xe4, 0x7d, 0x87, 0xe0,
+    0x78, 0xfe, 0x3f, 0x87, 0xc1, 0xf0, 0xf8, 0x3e, 0x1f, 0x07, 0xc3, 0xe0, 0xf8, 0x7c,
+    0x1f, 0x0f, 0x83, 0xe1, 0xf0, 0x7c, 0x3e, 0x0f, 0x87, 0xc1, 0xf0, 0xf8, 0x3e, 0x1f,
+    0x07, 0xc3, 0xe1, 0xf8, 0x3e, 0x7f, 0x07, 0xfb, 0xe0, 0x3e, 0x7f,
+};
+
+// character, x offset, y offset, width, height, bit offset
+const bike_computer::PackedGlyph kFont26bGlyphs[] = {
+    {' ', 0, 0, 0, 0, 0},
+    {'-', 13, 16, 10, 3, 0},
+    {'.', 14, 20, 5, 5, 30},
+    {'0', 10, 1, 15, 24, 55},
+    {'1', 11, 1, 12, 24, 415},
+    {'2', 9, 1, 16, 24, 703},
+    {'3', 9, 1, 16, 24, 1087},
+    {'4', 10, 1, 16, 24, 1471},
+    {'5', 10, 1, 15, 24, 1855},
+    {'6', 10, 1, 16, 24, 2215},
+    {'7', 10, 1, 15, 24, 2599},
+    {'8', 10, 1, 15, 24, 2959},
+    {'9', 10, 1, 16, 24, 3319},
+    {'B', 8, 1, 21, 24, 3703},
+    {'C', 7, 1, 22, 24, 4207},
+    {'e', 11, 9, 14, 16, 4735},
+    {'i', 13, 1, 9, 24, 4959},
+    {'k', 9, 1, 19, 24, 5175},
+    {'m', 4, 9, 27, 16, 5631},
+    {'o', 10, 9, 16, 16, 6063},
+    {'p', 9, 9, 17, 23, 6319},
+    {'r', 11, 9, 14, 16, 6710},
+    {'t', 13, 3, 11, 22, 6934},
+    {'u', 8, 9, 19, 16, 7176},
+};
+// clang-format on
+
+constexpr bike_computer::PackedFont kFont26b = {
+    .pGlyphs     = kFont26bGlyphs,
+    .nbrOfGlyphs = sizeof(kFont26bGlyphs) / sizeof(kFont26bGlyphs[0]),
+    .pBitmap     = kFont26bBitmap,
+    .width       = 35,
+    .height      = 33};
@@ -0,0 +1,192 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file font36b_packed.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Packed font (size 36b) restricted to the characters used by BikeDisplay
+ *        (generated by tools/font_converter.py from fonts36b.cpp)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "common/packed_font.hpp"
+
+// clang-format off
+// 1714 bytes
+const uint8_t kFont36bBitmap[] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x3f, 0x7f, 0xff, 0xff, 0xff,
+    0xbf, 0x1e, 0x00, 0x7c, 0x00, 0x0f, 0xf8, 0x01, 0xf1, 0xf0, 0x1f, 0x07, 0xc0, 0xf8,
+    0x1e, 0x0f, 0x80, 0xf8, 0x7c, 0x07, 0xc7, 0xe0, 0x3f, 0x3f, 0x01, 0xf9, 0xf8, 0x0f,
+    0xcf, 0xc0, 0x7e, 0xfe, 0x03, 0xff, 0xf0, 0x1f, 0xff, 0x80, 0xff, 0xfc, 0x07, 0xff,
+    0xe0, 0x3f, 0xff, 0x01, 0xff, 0xf8, 0x0f, 0xff, 0xc0, 0x7f, 0xfe, 0x03, 0xff, 0xf0,
+    0x1f, 0xdf, 0x80, 0xfc, 0xfc, 0x07, 0xe7, 0xe0, 0x3f, 0x3f, 0x01, 0xf8, 0xf8, 0x0f,
+    0x87, 0xc0, 0x7c, 0x1f, 0x03, 0xc0, 0x78, 0x3e, 0x03, 0xe3, 0xe0, 0x07, 0xfc, 0x00,
+    0x0f, 0x80, 0x00, 0x18, 0x00, 0x3c, 0x00, 0x7e, 0x01, 0xff, 0x03, 0xff, 0x83, 0x3f,
+    0xc0, 0x0f, 0xe0, 0x07, 0xf0, 0x03, 0xf8, 0x01, 0xfc, 0x00, 0xfe, 0x00, 0x7f, 0x00,
+    0x3f, 0x80, 0x1f, 0xc0, 0x0f, 0xe0, 0x07, 0xf0, 0x03, 0xf8, 0x01, 0xfc, 0x00, 0xfe,
+    0x00, 0x7f, 0x00, 0x3f, 0x80, 0x1f, 0xc0, 0x0f, 0xe0, 0x07, 0xf0, 0x03, 0xf8, 0x01,
+    0xfc, 0x00, 0xfe, 0x00, 0x7f, 0x00, 0x3f, 0x80, 0x1f, 0xc0, 0x1f, 0xf0, 0xff, 0xff,
+    0x80, 0xfc, 0x00, 0x1f, 0xf8, 0x01, 0xff, 0xf0, 0x1f, 0xff, 0x81, 0xff, 0xfe, 0x0f,
+    0xff, 0xf8, 0xf0, 0xff, 0xc6, 0x03, 0xfe, 0x20, 0x0f, 0xf0, 0x00, 0x3f, 0x80, 0x01,
+    0xfc, 0x00, 0x0f, 0xc0, 0x00, 0x7e, 0x00, 0x03, 0xf0, 0x00, 0x1f, 0x00, 0x01, 0xf0,
+    0x00, 0x0f, 0x80, 0x00, 0xf8, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00,
+    0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x81, 0xc0, 0x0c, 0x1c, 0x00, 0xc1, 0xff,
+    0xfe, 0x1f, 0xff, 0xf1, 0xff, 0xff, 0x8f, 0xff, 0xf8, 0xff, 0xff, 0xcf, 0xff, 0xfe,
+    0x00, 0x7f, 0x00, 0x1f, 0xfc, 0x01, 0xff, 0xf8, 0x18, 0x7f, 0xc1, 0x80, 0xff, 0x18,
+    0x07, 0xf8, 0x00, 0x1f, 0xc0, 0x00, 0xfe, 0x00, 0x07, 0xe0, 0x00, 0x3e, 0x00, 0x03,
+    0xe0, 0x00, 0x1c, 0x00, 0x01, 0xf8, 0x00, 0x3f, 0xf0, 0x07, 0xff, 0xc0, 0x0f, 0xff,
+    0x00, 0x1f, 0xf8, 0x00, 0x7f, 0xe0, 0x01, 0xff, 0x00, 0x07, 0xf8, 0x00, 0x3f, 0xc0,
+    0x00, 0xfe, 0x00, 0x07, 0xf0, 0x00, 0x3f, 0x00, 0x01, 0xf9, 0xc0, 0x0f, 0xdf, 0x00,
+    0x7c, 0xfc, 0x07, 0xc7, 0xf8, 0x7c, 0x3f, 0xff, 0xc0, 0xff, 0xf8, 0x01, 0xff, 0x00,
+    0x00, 0x00, 0xe0, 0x00, 0x0f, 0x00, 0x00, 0xf8, 0x00, 0x0f, 0xc0, 0x00, 0x7e, 0x00,
+    0x07, 0xf0, 0x00, 0x7f, 0x80, 0x07, 0xfc, 0x00, 0x3f, 0xe0, 0x03, 0x7f, 0x00, 0x33,
+    0xf8, 0x03, 0x1f, 0xc0, 0x18, 0xfe, 0x01, 0x87, 0xf0, 0x18, 0x3f, 0x81, 0x81, 0xfc,
+    0x0c, 0x0f, 0xe0, 0xc0, 0x7f, 0x0c, 0x03, 0xf8, 0xc0, 0x1f, 0xc7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0x00, 0x03,
+    0xf8, 0x00, 0x1f, 0xc0, 0x00, 0xfe, 0x00, 0x07, 0xf0, 0x00, 0x3f, 0x80, 0x01, 0xfc,
+    0x01, 0xff, 0xfc, 0x1f, 0xff, 0xe0, 0xff, 0xfe, 0x07, 0xff, 0xf0, 0x7f, 0xff, 0x83,
+    0xff, 0xf8, 0x18, 0x00, 0x01, 0x80, 0x00, 0x0c, 0x00, 0x00, 0xfe, 0x00, 0x07, 0xff,
+    0x00, 0x3f, 0xfe, 0x03, 0xff, 0xfc, 0x1f, 0xff, 0xf0, 0xff, 0xff, 0xcf, 0xff, 0xff,
+    0x00, 0x7f, 0xf8, 0x00, 0x7f, 0xc0, 0x00, 0xff, 0x00, 0x01, 0xf8, 0x00, 0x07, 0xc0,
+    0x00, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0x03, 0x80, 0x00, 0x1d, 0xe0, 0x00, 0xdf, 0x80,
+    0x06, 0xff, 0x00, 0x67, 0xfc, 0x03, 0x1f, 0xf8, 0x70, 0x7f, 0xfe, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0x7c, 0x00, 0x1f, 0x80, 0x03, 0xe0, 0x00, 0x7c, 0x00, 0x07, 0xc0, 0x00,
+    0xf8, 0x00, 0x0f, 0x80, 0x00, 0xfc, 0x00, 0x07, 0xc0, 0x00, 0x7e, 0x00, 0x07, 0xe0,
+    0x00, 0x3f, 0x00, 0x01, 0xf3, 0xf0, 0x1f, 0xff, 0xe0, 0xfe, 0x3f, 0xc7, 0xe0, 0xfe,
+    0x7f, 0x03, 0xfb, 0xf8, 0x1f, 0xdf, 0xc0, 0x7f, 0xfe, 0x03, 0xff, 0xf0, 0x1f, 0xff,
+    0x80, 0xff, 0xfc, 0x07, 0xff, 0xe0, 0x3f, 0xbf, 0x01, 0xfd, 0xfc, 0x0f, 0xc7, 0xe0,
+    0x7e, 0x3f, 0x03, 0xe0, 0xfc, 0x3f, 0x03, 0xf1, 0xf0, 0x0f, 0xfe, 0x00, 0x0f, 0xc0,
+    0x1f, 0xff, 0xf9, 0xff, 0xff, 0x9f, 0xff, 0xfb, 0xff, 0xff, 0x3f, 0xff, 0xf3, 0xff,
+    0xff, 0x3c, 0x00, 0xe3, 0x00, 0x0e, 0x60, 0x00, 0xe4, 0x00, 0x1c, 0x00, 0x01, 0xc0,
+    0x00, 0x1c, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x07,
+    0x00, 0x00, 0x70, 0x00, 0x0e, 0x00, 0x00, 0xe0, 0x00, 0x0e, 0x00, 0x01, 0xc0, 0x00,
+    0x1c, 0x00, 0x01, 0xc0, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x07, 0x00,
+    0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x0e, 0x00, 0x00, 0xff, 0x00, 0x1f,
+    0xfe, 0x03, 0xf8, 0xf8, 0x1f, 0x83, 0xe1, 0xf8, 0x0f, 0x1f, 0xc0, 0x7c, 0xfe, 0x03,
+    0xe7, 0xf0, 0x1f, 0x3f, 0xc0, 0xf9, 0xff, 0x07, 0xcf, 0xfc, 0x7c, 0x3f, 0xf3, 0xc1,
+    0xff, 0xfc, 0x07, 0xff, 0xc0, 0x1f, 0xfe, 0x00, 0x3f, 0xf8, 0x00, 0xff, 0xe0, 0x0f,
+    0xff, 0x81, 0xe7, 0xfe, 0x3e, 0x1f, 0xf3, 0xe0, 0x7f, 0xde, 0x01, 0xff, 0xf0, 0x0f,
+    0xff, 0x80, 0x3f, 0xfc, 0x01, 0xff, 0xe0, 0x0f, 0xff, 0x00, 0x7e, 0x7c, 0x03, 0xf3,
+    0xe0, 0x3f, 0x0f, 0xc3, 0xf0, 0x1f, 0xff, 0x00, 0x3f, 0xc0, 0x00, 0xfc, 0x00, 0x1f,
+    0xf8, 0x03, 0xe3, 0xf0, 0x3f, 0x0f, 0xc1, 0xf0, 0x3f, 0x1f, 0x81, 0xf8, 0xfc, 0x0f,
+    0xef, 0xe0, 0x3f, 0x7f, 0x01, 0xfb, 0xf8, 0x0f, 0xff, 0xc0, 0x7f, 0xfe, 0x03, 0xff,
+    0xf0, 0x1f, 0xff, 0x80, 0xfe, 0xfe, 0x07, 0xf7, 0xf0, 0x3f, 0x9f, 0xc1, 0xfc, 0xff,
+    0x1f, 0xc1, 0xff, 0xfe, 0x03, 0xf3, 0xf0, 0x00, 0x3f, 0x00, 0x01, 0xf8, 0x00, 0x1f,
+    0x80, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0x7c, 0x00, 0x07, 0xc0, 0x00, 0xfc, 0x00,
+    0x0f, 0x80, 0x01, 0xf8, 0x00, 0x7e, 0x00, 0x0f, 0x80, 0x00, 0x7f, 0xff, 0xfe, 0x00,
+    0x7f, 0xff, 0xfc, 0x01, 0xfe, 0x1f, 0xf8, 0x0f, 0xf0, 0x3f, 0xc0, 0x7f, 0x80, 0xff,
+    0x03, 0xfc, 0x03, 0xfc, 0x1f, 0xe0, 0x1f, 0xe0, 0xff, 0x00, 0xff, 0x07, 0xf8, 0x07,
+    0xf8, 0x3f, 0xc0, 0x3f, 0xc1, 0xfe, 0x01, 0xfc, 0x0f, 0xf0, 0x1f, 0xe0, 0x7f, 0x81,
+    0xfe, 0x03, 0xfc, 0x3f, 0xc0, 0x1f, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xe0, 0x07, 0xf8,
+    0x7f, 0xc0, 0x3f, 0xc0, 0xff, 0x81, 0xfe, 0x03, 0xfe, 0x0f, 0xf0, 0x0f, 0xf0, 0x7f,
+    0x80, 0x7f, 0xc3, 0xfc, 0x03, 0xfe, 0x1f, 0xe0, 0x1f, 0xf0, 0xff, 0x00, 0xff, 0x87,
+    0xf8, 0x07, 0xfc, 0x3f, 0xc0, 0x3f, 0xe1, 0xfe, 0x03, 0xfe, 0x0f, 0xf0, 0x1f, 0xf0,
+    0x7f, 0x81, 0xff, 0x03, 0xfe, 0x1f, 0xf0, 0x3f, 0xff, 0xfe, 0x0f, 0xff, 0xff, 0x80,
+    0x00, 0x01, 0xfe, 0x01, 0x00, 0x1f, 0xff, 0xc6, 0x00, 0xff, 0x03, 0xfc, 0x07, 0xf8,
+    0x01, 0xf8, 0x1f, 0xc0, 0x01, 0xf0, 0x7f, 0x00, 0x01, 0xe1, 0xfc, 0x00, 0x01, 0xc7,
+    0xf8, 0x00, 0x01, 0x8f, 0xe0, 0x00, 0x03, 0x3f, 0xc0, 0x00, 0x02, 0x7f, 0x80, 0x00,
+    0x05, 0xff, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x1f, 0xf0,
+    0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0xff, 0x80, 0x00, 0x01,
+    0xff, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x0f, 0xf8, 0x00,
+    0x00, 0x0f, 0xf8, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x3f,
+    0xc0, 0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x10, 0x7f, 0x80, 0x00,
+    0x60, 0x7f, 0x80, 0x01, 0x80, 0x7f, 0x80, 0x0e, 0x00, 0x3f, 0xc0, 0x78, 0x00, 0x1f,
+    0xff, 0xc0, 0x00, 0x07, 0xfc, 0x00, 0x03, 0xf0, 0x01, 0xff, 0x80, 0x7c, 0xf8, 0x1f,
+    0x1f, 0x87, 0xc1, 0xf1, 0xf8, 0x3f, 0x3f, 0x07, 0xe7, 0xe0, 0xff, 0xfc, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xc0, 0x03, 0xf8, 0x00, 0x7f, 0x80, 0x0f,
+    0xf0, 0x00, 0xfe, 0x00, 0x5f, 0xe0, 0x19, 0xfe, 0x06, 0x3f, 0xe1, 0x83, 0xff, 0xe0,
+    0x3f, 0xf8, 0x01, 0xfc, 0x00, 0xe0, 0x3e, 0x0f, 0xe1, 0xfc, 0x3f, 0x83, 0xe0, 0x38,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x8f, 0xf0, 0xfe, 0x1f, 0xc3, 0xf8,
+    0x7f, 0x0f, 0xe1, 0xfc, 0x3f, 0x87, 0xf0, 0xfe, 0x1f, 0xc3, 0xf8, 0x7f, 0x0f, 0xe1,
+    0xfc, 0x3f, 0x87, 0xf0, 0xfe, 0x3f, 0xef, 0xff, 0xff, 0x00, 0x00, 0x3f, 0xc0, 0x00,
+    0x07, 0xf0, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x07,
+    0xf0, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x07, 0xf0,
+    0x00, 0x01, 0xfc, 0x1f, 0xf8, 0x7f, 0x01, 0xf8, 0x1f, 0xc0, 0x38, 0x07, 0xf0, 0x0c,
+    0x01, 0xfc, 0x06, 0x00, 0x7f, 0x03, 0x00, 0x1f, 0xc1, 0x80, 0x07, 0xf0, 0xe0, 0x01,
+    0xfc, 0xfc, 0x00, 0x7f, 0x7f, 0x80, 0x1f, 0xff, 0xe0, 0x07, 0xfb, 0xfc, 0x01, 0xfc,
+    0xff, 0x80, 0x7f, 0x1f, 0xe0, 0x1f, 0xc3, 0xfc, 0x07, 0xf0, 0xff, 0x81, 0xfc, 0x1f,
+    0xe0, 0x7f, 0x03, 0xfc, 0x1f, 0xc0, 0xff, 0x8f, 0xf8, 0x1f, 0xf7, 0xff, 0x1f, 0xfe,
+    0x00, 0x0f, 0xc0, 0x7e, 0x0f, 0xf9, 0xff, 0x0f, 0xf8, 0x3f, 0xdf, 0xfc, 0xff, 0xe0,
+    0xff, 0x8f, 0xec, 0x7f, 0x07, 0xf8, 0x3f, 0xc1, 0xfc, 0x3f, 0x81, 0xfc, 0x0f, 0xe1,
+    0xfc, 0x0f, 0xe0, 0x7f, 0x0f, 0xe0, 0x7f, 0x03, 0xf8, 0x7f, 0x03, 0xf8, 0x1f, 0xc3,
+    0xf8, 0x1f, 0xc0, 0xfe, 0x1f, 0xc0, 0xfe, 0x07, 0xf0, 0xfe, 0x07, 0xf0, 0x3f, 0x87,
+    0xf0, 0x3f, 0x81, 0xfc, 0x3f, 0x81, 0xfc, 0x0f, 0xe1, 0xfc, 0x0f, 0xe0, 0x7f, 0x0f,
+    0xe0, 0x7f, 0x03, 0xf8, 0x7f, 0x03, 0xf8, 0x1f, 0xc3, 0xf8, 0x1f, 0xc0, 0xfe, 0x1f,
+    0xc0, 0xfe, 0x07, 0xf0, 0xfe, 0x07, 0xf0, 0x3f, 0x8f, 0xf8, 0x7f, 0xc3, 0xfe, 0xff,
+    0xe7, 0xff, 0x3f, 0xf8, 0x0f, 0xc0, 0x03, 0xff, 0x00, 0x7c, 0xfc, 0x0f, 0x87, 0xc1,
+    0xf8, 0x3e, 0x3f, 0x03, 0xf3, 0xf0, 0x3f, 0x3f, 0x03, 0xf7, 0xf0, 0x3f, 0xff, 0x03,
+    0xff, 0xf0, 0x3f, 0xff, 0x03, 0xff, 0xf0, 0x3f, 0xff, 0x03, 0xff, 0xf0, 0x3f, 0xbf,
+    0x03, 0xf3, 0xf0, 0x3f, 0x3f, 0x03, 0xf1, 0xf0, 0x3e, 0x0f, 0x87, 0xe0, 0xfc, 0xfc,
+    0x03, 0xff, 0x00, 0x0f, 0xc0, 0x00, 0x03, 0xc0, 0xff, 0x9f, 0xe0, 0xff, 0x7f, 0xe0,
+    0xff, 0x8f, 0xe1, 0xfe, 0x0f, 0xe3, 0xf8, 0x1f, 0xc7, 0xf0, 0x1f, 0x8f, 0xe0, 0x3f,
+    0x9f, 0xc0, 0x7f, 0x3f, 0x80, 0xfe, 0x7f, 0x01, 0xfc, 0xfe, 0x03, 0xf9, 0xfc, 0x07,
+    0xf3, 0xf8, 0x0f, 0xe7, 0xf0, 0x1f, 0xcf, 0xe0, 0x3f, 0x9f, 0xc0, 0x7e, 0x3f, 0x80,
+    0xfc, 0x7f, 0x03, 0xf0, 0xff, 0x07, 0xe1, 0xff, 0x1f, 0x83, 0xfb, 0xfe, 0x07, 0xf1,
+    0xf0, 0x0f, 0xe0, 0x00, 0x1f, 0xc0, 0x00, 0x3f, 0x80, 0x00, 0x7f, 0x00, 0x00, 0xfe,
+    0x00, 0x01, 0xfc, 0x00, 0x03, 0xf8, 0x00, 0x0f, 0xf8, 0x00, 0x3f, 0xf8, 0x00, 0x00,
+    0x01, 0xef, 0xf8, 0x7e, 0xff, 0x1f, 0xcf, 0xe7, 0xf9, 0xfd, 0x1f, 0x3f, 0xc3, 0xe7,
+    0xf8, 0x38, 0xff, 0x00, 0x1f, 0xc0, 0x03, 0xf8, 0x00, 0x7f, 0x00, 0x0f, 0xe0, 0x01,
+    0xfc, 0x00, 0x3f, 0x80, 0x07, 0xf0, 0x00, 0xfe, 0x00, 0x1f, 0xc0, 0x03, 0xf8, 0x00,
+    0x7f, 0x00, 0x0f, 0xe0, 0x03, 0xfe, 0x00, 0xff, 0xe0, 0x00, 0x08, 0x00, 0x30, 0x00,
+    0xe0, 0x01, 0xc0, 0x07, 0x80, 0x1f, 0x00, 0x7e, 0x03, 0xfc, 0x0f, 0xff, 0xff, 0xff,
+    0x8f, 0xe0, 0x1f, 0xc0, 0x3f, 0x80, 0x7f, 0x00, 0xfe, 0x01, 0xfc, 0x03, 0xf8, 0x07,
+    0xf0, 0x0f, 0xe0, 0x1f, 0xc0, 0x3f, 0x80, 0x7f, 0x00, 0xfe, 0x01, 0xfc, 0x03, 0xf8,
+    0x07, 0xf1, 0x0f, 0xe6, 0x0f, 0xf8, 0x0f, 0xe0, 0x0f, 0x87, 0xfc, 0x3f, 0xe3, 0xfc,
+    0x1f, 0xe1, 0xfc, 0x0f, 0xe1, 0xfc, 0x0f, 0xe1, 0xfc, 0x0f, 0xe1, 0xfc, 0x0f, 0xe1,
+    0xfc, 0x0f, 0xe1, 0xfc, 0x0f, 0xe1, 0xfc, 0x0f, 0xe1, 0xfc, 0x0f, 0xe1, 0xfc, 0x0f,
+    0xe1, 0xfc, 0x0f, 0xe1, 0xfc, 0x0f, 0xe1, 0xfc, 0x0f, 0xe1, 0xfc, 0x0f, 0xe1, 0xfc,
+    0x0f, 0xe1, 0xfc, 0x0f, 0xe1, 0xfc, 0x1f, 0xe0, 0xfe, 0x3f, 0xe0, 0xff, 0xef, 0xf0,
+    0x7f, 0x8f, 0xf8, 0x1f, 0x00, 0x00,
+};
+
+// character, x offset, y offset, width, height, bit offset
+const bike_computer::PackedGlyph kFont36bGlyphs[] = {
+    {' ', 0, 0, 0, 0, 0},
+    {'-', 17, 19, 13, 5, 0},
+    {'.', 20, 26, 8, 8, 65},
+    {'0', 13, 1, 21, 32, 129},
+    {'1', 16, 1, 17, 32, 801},
+    {'2', 13, 1, 21, 32, 1345},
+    {'3', 13, 1, 21, 32, 2017},
+    {'4', 13, 1, 21, 32, 2689},
+    {'5', 13, 1, 21, 32, 3361},
+    {'6', 13, 1, 21, 32, 4033},
+    {'7', 14, 1, 20, 32, 4705},
+    {'8', 13, 1, 21, 32, 5345},
+    {'9', 13, 1, 21, 32, 6017},
+    {'B', 10, 1, 29, 32, 6689},
+    {'C', 9, 0, 31, 34, 7617},
+    {'e', 15, 11, 19, 23, 8671},
+    {'i', 19, 0, 11, 33, 9108},
+    {'k', 12, 1, 26, 32, 9471},
+    {'m', 5, 11, 37, 22, 10303},
+    {'o', 14, 11, 20, 23, 11117},
+    {'p', 12, 11, 23, 32, 11577},
+    {'r', 16, 11, 19, 22, 12313},
+    {'t', 17, 4, 15, 30, 12731},
+    {'u', 12, 12, 24, 22, 13181},
+};
+// clang-format on
+
+constexpr bike_computer::PackedFont kFont36b = {
+    .pGlyphs     = kFont36bGlyphs,
+    .nbrOfGlyphs = sizeof(kFont36bGlyphs) / sizeof(kFont36bGlyphs[0]),
+    .pBitmap     = kFont36bBitmap,
+    .width       = 46,
+    .height      = 44};
@@ -0,0 +1,463 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file gear_icon_100_rle.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Gear icon (size 100) as palette indexed RLE data
+ *        (generated by tools/icon_converter.py from gear_icon_100.hpp)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "common/compressed_image.hpp"
+
+constexpr uint8_t kGearIconHeight = 100;
+constexpr uint8_t kGearIconWidth  = 100;
+
+// compressed size is 6342 (raw size is 40000)
+// clang-format off
+const uint32_t gear_icon_palette[] = {
+    0x000000ff, 0x020202ff, 0x030303ff, 0x040404ff, 0x050505ff, 0x060606ff, 0x070707ff,
+    0x080808ff, 0x090909ff, 0x0a0a0aff, 0x0b0b0bff, 0x0c0c0cff, 0x0d0d0dff, 0x0e0e0eff,
+    0x0f0f0fff, 0x101010ff, 0x111111ff, 0x121212ff, 0x131313ff, 0x141414ff, 0x151515ff,
+    0x161616ff, 0x171717ff, 0x181818ff, 0x191919ff, 0x1a1a1aff, 0x1b1b1bff, 0x1d1d1dff,
+    0x1e1e1eff, 0x1f1f1fff, 0x202020ff, 0x212121ff, 0x222222ff, 0x232323ff, 0x242424ff,
+    0x252525ff, 0x262626ff, 0x272727ff, 0x282828ff, 0x292929ff, 0x2a2a2aff, 0x2b2b2bff,
+    0x2c2c2cff, 0x2d2d2dff, 0x2e2e2eff, 0x2f2f2fff, 0x303030ff, 0x313131ff, 0x323232ff,
+    0x333333ff, 0x343434ff, 0x353535ff, 0x363636ff, 0x373737ff, 0x383838ff, 0x393939ff,
+    0x3a3a3aff, 0x3b3b3bff, 0x3c3c3cff, 0x3d3d3dff, 0x3e3e3eff, 0x3f3f3fff, 0x404040ff,
+    0x414141ff, 0x424242ff, 0x434343ff, 0x444444ff, 0x454545ff, 0x464646ff, 0x474747ff,
+    0x484848ff, 0x494949ff, 0x4a4a4aff, 0x4b4b4bff, 0x4c4c4cff, 0x4d4d4dff, 0x4e4e4eff,
+    0x4f4f4fff, 0x505050ff, 0x515151ff, 0x525252ff, 0x535353ff, 0x545454ff, 0x555555ff,
+    0x565656ff, 0x575757ff, 0x585858ff, 0x595959ff, 0x5a5a5aff, 0x5b5b5bff, 0x5c5c5cff,
+    0x5d5d5dff, 0x5e5e5eff, 0x5f5f5fff, 0x606060ff, 0x616161ff, 0x626262ff, 0x636363ff,
+    0x646464ff, 0x656565ff, 0x666666ff, 0x676767ff, 0x686868ff, 0x696969ff, 0x6a6a6aff,
+    0x6b6b6bff, 0x6c6c6cff, 0x6d6d6dff, 0x6e6e6eff, 0x6f6f6fff, 0x707070ff, 0x717171ff,
+    0x727272ff, 0x737373ff, 0x747474ff, 0x757575ff, 0x767676ff, 0x777777ff, 0x787878ff,
+    0x797979ff, 0x7a7a7aff, 0x7b7b7bff, 0x7c7c7cff, 0x7d7d7dff, 0x7e7e7eff, 0x7f7f7fff,
+    0x808080ff, 0x818181ff, 0x828282ff, 0x838383ff, 0x848484ff, 0x858585ff, 0x868686ff,
+    0x878787ff, 0x888888ff, 0x898989ff, 0x8a8a8aff, 0x8b8b8bff, 0x8c8c8cff, 0x8d8d8dff,
+    0x8e8e8eff, 0x8f8f8fff, 0x909090ff, 0x919191ff, 0x929292ff, 0x939393ff, 0x949494ff,
+    0x969696ff, 0x979797ff, 0x999999ff, 0x9a9a9aff, 0x9b9b9bff, 0x9c9c9cff, 0x9d9d9dff,
+    0x9e9e9eff, 0x9f9f9fff, 0xa0a0a0ff, 0xa1a1a1ff, 0xa2a2a2ff, 0xa3a3a3ff, 0xa4a4a4ff,
+    0xa5a5a5ff, 0xa6a6a6ff, 0xa7a7a7ff, 0xa8a8a8ff, 0xa9a9a9ff, 0xaaaaaaff, 0xabababff,
+    0xacacacff, 0xadadadff, 0xaeaeaeff, 0xafafafff, 0xb0b0b0ff, 0xb1b1b1ff, 0xb2b2b2ff,
+    0xb3b3b3ff, 0xb4b4b4ff, 0xb5b5b5ff, 0xb6b6b6ff, 0xb7b7b7ff, 0xb8b8b8ff, 0xb9b9b9ff,
+    0xbababaff, 0xbbbbbbff, 0xbcbcbcff, 0xbdbdbdff, 0xbebebeff, 0xbfbfbfff, 0xc0c0c0ff,
+    0xc1c1c1ff, 0xc2c2c2ff, 0xc3c3c3ff, 0xc4c4c4ff, 0xc5c5c5ff, 0xc6c6c6ff, 0xc7c7c7ff,
+    0xc8c8c8ff, 0xc9c9c9ff, 0xcacacaff, 0xcbcbcbff, 0xccccccff, 0xcdcdcdff, 0xcececeff,
+    0xcfcfcfff, 0xd0d0d0ff, 0xd1d1d1ff, 0xd2d2d2ff, 0xd3d3d3ff, 0xd4d4d4ff, 0xd5d5d5ff,
+    0xd6d6d6ff, 0xd7d7d7ff, 0xd8d8d8ff, 0xd9d9d9ff, 0xdadadaff, 0xdbdbdbff, 0xdcdcdcff,
+    0xddddddff, 0xdededeff, 0xdfdfdfff, 0xe0e0e0ff, 0xe1e1e1ff, 0xe2e2e2ff, 0xe3e3e3ff,
+    0xe4e4e4ff, 0xe5e5e5ff, 0xe6e6e6ff, 0xe7e7e7ff, 0xe8e8e8ff, 0xe9e9e9ff, 0xeaeaeaff,
+    0xebebebff, 0xecececff, 0xedededff, 0xeeeeeeff, 0xefefefff, 0xf0f0f0ff, 0xf1f1f1ff,
+    0xf2f2f2ff, 0xf3f3f3ff, 0xf4f4f4ff, 0xf5f5f5ff, 0xf6f6f6ff, 0xf7f7f7ff, 0xf8f8f8ff,
+    0xf9f9f9ff, 0xfafafaff, 0xfbfbfbff, 0xfcfcfcff, 0xfdfdfdff, 0xfefefeff, 0xffffffff,
+};
+
+const uint8_t gear_icon_data[] = {
+    0xe3, 0xfb, 0xe3, 0xfb, 0xe3, 0xfb, 0xe3, 0xfb, 0xe3, 0xfb, 0xe3, 0xfb, 0xe3, 0xfb,
+    0xad, 0xfb, 0x07, 0xd3, 0xa4, 0x85, 0x7e, 0x7e, 0x85, 0xa4, 0xd4, 0xad, 0xfb, 0xab,
+    0xfb, 0x0b, 0xf9, 0xeb, 0x8b, 0x37, 0x09, 0x00, 0x00, 0x09, 0x37, 0x8b, 0xeb, 0xf9,
+    0xab, 0xfb, 0xab, 0xfb, 0x0b, 0xf4, 0xbd, 0x36, 0x05, 0x0f, 0x19, 0x19, 0x0f, 0x05,
+    0x36, 0xbe, 0xf4, 0xab, 0xfb, 0xab, 0xfb, 0x0b, 0xed, 0x85, 0x22, 0x33, 0x8e, 0xe1,
+    0xe1, 0x8e, 0x33, 0x22, 0x84, 0xed, 0xab, 0xfb, 0x9c, 0xfb, 0x04, 0xf8, 0xdf, 0xd7,
+    0xe7, 0xfa, 0x89, 0xfb, 0x0b, 0xe8, 0x55, 0x14, 0x52, 0xbf, 0xfb, 0xfb, 0xbf, 0x53,
+    0x13, 0x54, 0xe8, 0x89, 0xfb, 0x04, 0xfa, 0xe6, 0xd6, 0xdf, 0xf8, 0x9c, 0xfb, 0x9a,
+    0xfb, 0x08, 0xf0, 0xcf, 0x97, 0x6d, 0x64, 0x7c, 0xb1, 0xf2, 0xfa, 0x85, 0xfb, 0x0f,
+    0xf6, 0xe9, 0xc2, 0x2b, 0x09, 0x6d, 0xe1, 0xfb, 0xfb, 0xe2, 0x6d, 0x09, 0x2b, 0xc2,
+    0xe9, 0xf6, 0x85, 0xfb, 0x08, 0xfa, 0xf2, 0xb1, 0x7c, 0x63, 0x6d, 0x97, 0xcf, 0xf0,
+    0x9a, 0xfb, 0x99, 0xfb, 0x2f, 0xe7, 0xb7, 0x74, 0x29, 0x09, 0x07, 0x16, 0x4e, 0xb6,
+    0xef, 0xf9, 0xf9, 0xef, 0xdd, 0xca, 0xbd, 0xac, 0x95, 0x6f, 0x0d, 0x11, 0x87, 0xf7,
+    0xfb, 0xfb, 0xf7, 0x87, 0x11, 0x0d, 0x6f, 0x95, 0xad, 0xbd, 0xcb, 0xdd, 0xf0, 0xf9,
+    0xfa, 0xef, 0xb7, 0x4e, 0x16, 0x07, 0x09, 0x29, 0x74, 0xb7, 0xe7, 0x99, 0xfb, 0x99,
+    0xfb, 0x15, 0xad, 0x47, 0x05, 0x0d, 0x24, 0x2d, 0x1a, 0x0f, 0x3c, 0xc5, 0xe4, 0xdf,
+    0xbf, 0x89, 0x51, 0x29, 0x0f, 0x04, 0x07, 0x0a, 0x37, 0xa1, 0x83, 0xfb, 0x15, 0xa2,
+    0x37, 0x0a, 0x07, 0x04, 0x0f, 0x2a, 0x52, 0x89, 0xc0, 0xdf, 0xe4, 0xc6, 0x3d, 0x0f,
+    0x1a, 0x2d, 0x24, 0x0d, 0x05, 0x48, 0xad, 0x99, 0xfb, 0x98, 0xfb, 0x16, 0xf7, 0x5c,
+    0x0d, 0x1c, 0x6b, 0xc7, 0xd0, 0x79, 0x19, 0x0b, 0x3d, 0x57, 0x3e, 0x1a, 0x0f, 0x08,
+    0x04, 0x0f, 0x27, 0x47, 0x62, 0x96, 0xd4, 0x83, 0xfb, 0x16, 0xd4, 0x96, 0x62, 0x46,
+    0x26, 0x0f, 0x04, 0x09, 0x0f, 0x1a, 0x3f, 0x58, 0x3e, 0x0b, 0x18, 0x78, 0xd0, 0xc7,
+    0x6b, 0x1c, 0x0e, 0x5d, 0xf7, 0x98, 0xfb, 0x97, 0xfb, 0x17, 0xfa, 0xf1, 0x4a, 0x05,
+    0x42, 0xd0, 0xf1, 0xf4, 0xcd, 0x7c, 0x16, 0x0f, 0x14, 0x11, 0x19, 0x40, 0x6c, 0x91,
+    0xaa, 0xbc, 0xc7, 0xd0, 0xe0, 0xf1, 0x83, 0xfb, 0x17, 0xf1, 0xe0, 0xd0, 0xc6, 0xbc,
+    0xaa, 0x90, 0x68, 0x37, 0x12, 0x0e, 0x15, 0x0f, 0x15, 0x7c, 0xcd, 0xf4, 0xf1, 0xd0,
+    0x42, 0x05, 0x4a, 0xf1, 0xfa, 0x97, 0xfb, 0x97, 0xfb, 0x12, 0xfa, 0xf5, 0x58, 0x0c,
+    0x44, 0xdc, 0xf7, 0xfb, 0xf4, 0xcb, 0x75, 0x2c, 0x40, 0x65, 0x8b, 0xab, 0xca, 0xe5,
+    0xf5, 0x8d, 0xfb, 0x12, 0xf4, 0xe4, 0xc7, 0xa4, 0x83, 0x5f, 0x3d, 0x2b, 0x74, 0xcb,
+    0xf4, 0xfb, 0xf8, 0xdc, 0x44, 0x0c, 0x58, 0xf5, 0xfa, 0x97, 0xfb, 0x99, 0xfb, 0x0c,
+    0x78, 0x1e, 0x31, 0xae, 0xf2, 0xfb, 0xfb, 0xf4, 0xda, 0x88, 0xa4, 0xd4, 0xf5, 0x83,
+    0xfb, 0x0c, 0xf2, 0xde, 0xdc, 0xf2, 0xfb, 0xec, 0xc7, 0xc5, 0xea, 0xe1, 0xce, 0xe1,
+    0xf8, 0x84, 0xfb, 0x0c, 0xf1, 0xcf, 0xa1, 0x88, 0xd9, 0xf4, 0xfb, 0xfb, 0xf2, 0xaf,
+    0x31, 0x1e, 0x78, 0x99, 0xfb, 0x99, 0xfb, 0x04, 0x9d, 0x3b, 0x1f, 0x7b, 0xec, 0x86,
+    0xfb, 0x16, 0xf9, 0xf3, 0xef, 0xf7, 0xfb, 0xdb, 0x92, 0x8a, 0xd8, 0xfb, 0xc7, 0x51,
+    0x4b, 0xc1, 0x9f, 0x62, 0x9f, 0xf1, 0xf9, 0xee, 0xe7, 0xf1, 0xfa, 0x87, 0xfb, 0x04,
+    0xec, 0x7c, 0x20, 0x3b, 0x9d, 0x99, 0xfb, 0x99, 0xfb, 0x04, 0xb9, 0x4e, 0x0f, 0x47,
+    0xe6, 0x86, 0xfb, 0x16, 0xe6, 0xb2, 0x90, 0xd8, 0xfb, 0xbf, 0x33, 0x27, 0xba, 0xfb,
+    0xc5, 0x4b, 0x51, 0xbc, 0x81, 0x2f, 0x79, 0xec, 0xeb, 0x8a, 0x4d, 0x9e, 0xf1, 0x87,
+    0xfb, 0x04, 0xe7, 0x48, 0x0f, 0x4e, 0xb9, 0x99, 0xfb, 0x97, 0xfb, 0x07, 0xf6, 0xd3,
+    0x68, 0x1d, 0x0f, 0x48, 0xe5, 0xfa, 0x82, 0xfb, 0x28, 0xf8, 0xfa, 0xfb, 0xce, 0x62,
+    0x2e, 0xb6, 0xf8, 0xe1, 0xa3, 0xa2, 0xe0, 0xfb, 0xeb, 0xc5, 0xc7, 0xe8, 0xce, 0xb2,
+    0xd1, 0xf6, 0xea, 0x84, 0x46, 0x9f, 0xf1, 0xed, 0xc3, 0xb8, 0xf3, 0xfa, 0xfb, 0xfb,
+    0xfa, 0xe5, 0x49, 0x0f, 0x1d, 0x68, 0xd3, 0xf6, 0x97, 0xfb, 0x96, 0xfb, 0x17, 0xee,
+    0xc3, 0x6c, 0x21, 0x19, 0x4b, 0x9f, 0xef, 0xfb, 0xfb, 0xf1, 0xd0, 0x8b, 0xbf, 0xeb,
+    0xdd, 0x93, 0x71, 0xcc, 0xf9, 0xf6, 0xea, 0xec, 0xf6, 0x84, 0xfb, 0x0d, 0xf6, 0xf4,
+    0xfb, 0xfb, 0xf3, 0xc0, 0xa2, 0xcf, 0xf6, 0xcb, 0x7a, 0x67, 0xd0, 0xf6, 0x82, 0xfb,
+    0x07, 0xef, 0x9f, 0x4b, 0x19, 0x21, 0x6c, 0xc4, 0xee, 0x96, 0xfb, 0x95, 0xfb, 0x07,
+    0xee, 0xbf, 0x67, 0x0f, 0x1a, 0x56, 0xa8, 0xf7, 0x82, 0xfb, 0x08, 0xe8, 0xaa, 0x24,
+    0x8c, 0xdc, 0xf6, 0xea, 0xe2, 0xf3, 0x83, 0xfb, 0x01, 0xf6, 0xf8, 0x83, 0xfb, 0x01,
+    0xf8, 0xf6, 0x86, 0xfb, 0x10, 0xc5, 0x72, 0x5f, 0xc6, 0xf5, 0xe7, 0xe4, 0xee, 0xfb,
+    0xf7, 0xa8, 0x56, 0x1a, 0x0f, 0x68, 0xbf, 0xee, 0x95, 0xfb, 0x8f, 0xfb, 0x01, 0xfa,
+    0xfa, 0x82, 0xfb, 0x10, 0xf6, 0xc3, 0x67, 0x01, 0x0d, 0x62, 0xbf, 0xfa, 0xfa, 0xf2,
+    0xeb, 0xf2, 0xec, 0xbb, 0x4a, 0xa0, 0xe4, 0x82, 0xfb, 0x06, 0xf8, 0xf3, 0xed, 0xe8,
+    0xe4, 0xd3, 0xe4, 0x83, 0xfb, 0x1a, 0xe4, 0xd3, 0xe4, 0xe8, 0xed, 0xf3, 0xf8, 0xfb,
+    0xfb, 0xf7, 0xd8, 0xcc, 0xf9, 0xfa, 0xae, 0x9e, 0xc6, 0xfb, 0xfb, 0xfa, 0xbf, 0x62,
+    0x0d, 0x02, 0x68, 0xc4, 0xf6, 0x82, 0xfb, 0x01, 0xfa, 0xfa, 0x8f, 0xfb, 0x8e, 0xfb,
+    0x02, 0xf7, 0xf1, 0xf5, 0x82, 0xfb, 0x10, 0xd3, 0x6c, 0x0f, 0x0d, 0x78, 0xce, 0xf4,
+    0xfb, 0xf2, 0xa7, 0x74, 0xaa, 0xf6, 0xf4, 0xe7, 0xf1, 0xf8, 0x82, 0xfb, 0x06, 0xe4,
+    0xb6, 0x82, 0x55, 0x30, 0x1c, 0x89, 0x83, 0xfb, 0x06, 0x89, 0x1c, 0x30, 0x56, 0x83,
+    0xb7, 0xe4, 0x82, 0xfb, 0x06, 0xf7, 0xf6, 0xfa, 0xf6, 0x58, 0x2e, 0x7f, 0x82, 0xfb,
+    0x06, 0xf4, 0xce, 0x78, 0x0d, 0x0f, 0x6c, 0xd3, 0x82, 0xfb, 0x02, 0xf5, 0xf1, 0xf7,
+    0x8e, 0xfb, 0x8c, 0xfb, 0x14, 0xe7, 0xad, 0x5c, 0x4a, 0x58, 0x78, 0x9d, 0xb9, 0x68,
+    0x21, 0x1a, 0x62, 0xce, 0xf2, 0xfb, 0xfb, 0xec, 0x7c, 0x3a, 0x8d, 0xf6, 0x83, 0xfb,
+    0x09, 0xe9, 0xb8, 0x7d, 0x50, 0x34, 0x22, 0x13, 0x07, 0x01, 0x7e, 0x83, 0xfb, 0x09,
+    0x7e, 0x01, 0x07, 0x14, 0x22, 0x34, 0x50, 0x7e, 0xb9, 0xe9, 0x82, 0xfb, 0x03, 0xf9,
+    0xa7, 0x97, 0xc2, 0x83, 0xfb, 0x0d, 0xf2, 0xce, 0x62, 0x1a, 0x21, 0x68, 0xb9, 0x9d,
+    0x79, 0x58, 0x4a, 0x5c, 0xad, 0xe7, 0x8c, 0xfb, 0x8b, 0xfb, 0x23, 0xf0, 0xb7, 0x47,
+    0x0d, 0x04, 0x0c, 0x1e, 0x3b, 0x4e, 0x1d, 0x19, 0x56, 0xbf, 0xf4, 0xfb, 0xf7, 0xf6,
+    0xf3, 0xb1, 0x8e, 0xbc, 0xf9, 0xfb, 0xfb, 0xe6, 0xb8, 0x82, 0x4e, 0x22, 0x09, 0x10,
+    0x2a, 0x3e, 0x06, 0x00, 0x7e, 0x83, 0xfb, 0x23, 0x7e, 0x00, 0x06, 0x3e, 0x2a, 0x10,
+    0x09, 0x23, 0x4e, 0x82, 0xb9, 0xe7, 0xfb, 0xfb, 0xe5, 0xe3, 0xef, 0xf1, 0xa7, 0xa6,
+    0xd2, 0xfb, 0xf4, 0xbf, 0x56, 0x19, 0x1d, 0x4e, 0x3b, 0x1f, 0x0c, 0x04, 0x0d, 0x48,
+    0xb7, 0xf0, 0x8b, 0xfb, 0x8b, 0xfb, 0x23, 0xcf, 0x74, 0x05, 0x1c, 0x41, 0x43, 0x31,
+    0x20, 0x0f, 0x0f, 0x4b, 0xa8, 0xfa, 0xfb, 0xde, 0xbd, 0xbf, 0xf5, 0xf7, 0xf5, 0xf7,
+    0xfa, 0xf5, 0xd4, 0x9b, 0x54, 0x19, 0x06, 0x1f, 0x3b, 0x5f, 0x88, 0x9b, 0x11, 0x00,
+    0x7e, 0x83, 0xfb, 0x0d, 0x7e, 0x00, 0x11, 0x9b, 0x88, 0x5f, 0x3b, 0x1f, 0x06, 0x19,
+    0x55, 0x9d, 0xd5, 0xf5, 0x82, 0xfb, 0x12, 0xe8, 0x52, 0x54, 0xab, 0xfb, 0xfb, 0xfa,
+    0xa8, 0x4b, 0x0f, 0x0f, 0x1f, 0x31, 0x43, 0x41, 0x1c, 0x05, 0x74, 0xcf, 0x8b, 0xfb,
+    0x8a, 0xfb, 0x24, 0xf8, 0x98, 0x29, 0x0d, 0x6b, 0xd0, 0xdc, 0xae, 0x7c, 0x49, 0x48,
+    0x9e, 0xf6, 0xfb, 0xfb, 0x9e, 0x46, 0x54, 0xe8, 0xf9, 0xfb, 0xfa, 0xf2, 0xd4, 0x6f,
+    0x1d, 0x05, 0x11, 0x2c, 0x7a, 0xc9, 0xf1, 0xfb, 0xe1, 0x19, 0x00, 0x7e, 0x83, 0xfb,
+    0x14, 0x7e, 0x00, 0x19, 0xe1, 0xfb, 0xf1, 0xc8, 0x79, 0x2c, 0x11, 0x05, 0x1e, 0x71,
+    0xd6, 0xf2, 0xfa, 0xfb, 0xe9, 0x60, 0x68, 0xb6, 0x82, 0xfb, 0x0c, 0xf6, 0x9e, 0x47,
+    0x48, 0x7b, 0xae, 0xdc, 0xd0, 0x6b, 0x0d, 0x29, 0x97, 0xf8, 0x8a, 0xfb, 0x8a, 0xfb,
+    0x24, 0xe0, 0x6e, 0x09, 0x24, 0xc7, 0xf1, 0xf7, 0xf2, 0xec, 0xe7, 0xe5, 0xf0, 0xfa,
+    0xfb, 0xfb, 0xb6, 0x6e, 0x77, 0xf2, 0xfa, 0xfb, 0xf1, 0xb8, 0x45, 0x11, 0x03, 0x2b,
+    0x7d, 0xd4, 0xea, 0xf5, 0xfa, 0xfb, 0xe1, 0x19, 0x00, 0x7e, 0x83, 0xfb, 0x14, 0x7e,
+    0x00, 0x19, 0xe1, 0xfb, 0xfa, 0xf5, 0xea, 0xd4, 0x7d, 0x2b, 0x03, 0x12, 0x47, 0xba,
+    0xf2, 0xfb, 0xf9, 0xe9, 0xea, 0xf3, 0x82, 0xfb, 0x0c, 0xfa, 0xef, 0xe5, 0xe7, 0xec,
+    0xf2, 0xf7, 0xf1, 0xc7, 0x23, 0x09, 0x6e, 0xe1, 0x8a, 0xfb, 0x8a, 0xfb, 0x05, 0xd8,
+    0x64, 0x07, 0x2d, 0xd0, 0xf4, 0x88, 0xfb, 0x0e, 0xe7, 0xd1, 0xd4, 0xf9, 0xfb, 0xee,
+    0xa4, 0x48, 0x10, 0x0d, 0x58, 0xa2, 0xd9, 0xf6, 0xfa, 0x82, 0xfb, 0x03, 0xe1, 0x19,
+    0x00, 0x7e, 0x83, 0xfb, 0x03, 0x7e, 0x00, 0x19, 0xe1, 0x82, 0xfb, 0x09, 0xfa, 0xf6,
+    0xd9, 0xa2, 0x58, 0x0d, 0x11, 0x4a, 0xa5, 0xef, 0x82, 0xfb, 0x06, 0xe9, 0xb4, 0x6f,
+    0xc6, 0xef, 0xfb, 0xfa, 0x83, 0xfb, 0x05, 0xf4, 0xd0, 0x2d, 0x07, 0x65, 0xd8, 0x8a,
+    0xfb, 0x8a, 0xfb, 0x06, 0xe7, 0x7d, 0x17, 0x1a, 0x78, 0xcd, 0xf4, 0x83, 0xfb, 0x0f,
+    0xf9, 0xda, 0x99, 0xb9, 0xe8, 0xfb, 0xfb, 0xfa, 0xf5, 0xa6, 0x4d, 0x11, 0x17, 0x69,
+    0xb6, 0xe7, 0x85, 0xfb, 0x03, 0xe1, 0x19, 0x00, 0x7e, 0x83, 0xfb, 0x03, 0x7e, 0x00,
+    0x19, 0xe1, 0x85, 0xfb, 0x0e, 0xe7, 0xb6, 0x68, 0x17, 0x12, 0x4e, 0xa8, 0xf5, 0xfa,
+    0xfb, 0xdf, 0x90, 0x28, 0xaa, 0xe8, 0x84, 0xfb, 0x06, 0xf4, 0xcd, 0x78, 0x1a, 0x17,
+    0x7d, 0xe7, 0x8a, 0xfb, 0x8a, 0xfb, 0x07, 0xfa, 0xb1, 0x4f, 0x0f, 0x18, 0x7c, 0xcb,
+    0xf4, 0x82, 0xfb, 0x0e, 0xf7, 0xb7, 0x35, 0x76, 0xd5, 0xfb, 0xfb, 0xf4, 0xc1, 0x4d,
+    0x10, 0x1a, 0x60, 0xd0, 0xf3, 0x86, 0xfb, 0x03, 0xe1, 0x19, 0x00, 0x7e, 0x83, 0xfb,
+    0x03, 0x7e, 0x00, 0x19, 0xe1, 0x86, 0xfb, 0x0d, 0xf2, 0xd0, 0x60, 0x1a, 0x11, 0x4e,
+    0xc1, 0xf4, 0xfb, 0xe6, 0xab, 0x61, 0xbf, 0xec, 0x83, 0xfb, 0x07, 0xf4, 0xcb, 0x7c,
+    0x18, 0x0f, 0x4f, 0xb1, 0xfa, 0x8a, 0xfb, 0x8b, 0xfb, 0x06, 0xf2, 0xb7, 0x3d, 0x0b,
+    0x16, 0x75, 0xda, 0x82, 0xfb, 0x0e, 0xf5, 0xb7, 0x3e, 0x7f, 0xd8, 0xfb, 0xfa, 0xe5,
+    0x5a, 0x15, 0x03, 0x3e, 0xc5, 0xee, 0xf9, 0x86, 0xfb, 0x03, 0xe1, 0x19, 0x00, 0x7e,
+    0x83, 0xfb, 0x03, 0x7e, 0x00, 0x19, 0xe1, 0x86, 0xfb, 0x18, 0xf9, 0xee, 0xc5, 0x3e,
+    0x03, 0x15, 0x5a, 0xe5, 0xfa, 0xfb, 0xfa, 0xf9, 0xfa, 0xf3, 0xf5, 0xfa, 0xfb, 0xfb,
+    0xda, 0x75, 0x16, 0x0b, 0x3c, 0xb6, 0xf2, 0x8b, 0xfb, 0x8b, 0xfb, 0x06, 0xfa, 0xef,
+    0xc6, 0x3e, 0x0f, 0x2b, 0x88, 0x82, 0xfb, 0x0e, 0xfa, 0xf3, 0xe5, 0xed, 0xf7, 0xfb,
+    0xf6, 0xdc, 0x61, 0x18, 0x00, 0x10, 0x42, 0xaa, 0xe7, 0x86, 0xfb, 0x03, 0xe1, 0x19,
+    0x00, 0x7e, 0x83, 0xfb, 0x03, 0x7e, 0x00, 0x19, 0xe1, 0x86, 0xfb, 0x18, 0xe7, 0xaa,
+    0x42, 0x10, 0x00, 0x18, 0x61, 0xdc, 0xf6, 0xfb, 0xfb, 0xfa, 0xf2, 0xb4, 0xc2, 0xf0,
+    0xfb, 0xfb, 0x88, 0x2b, 0x0f, 0x3d, 0xc5, 0xef, 0xfa, 0x8b, 0xfb, 0x8c, 0xfb, 0x0a,
+    0xfa, 0xe4, 0x57, 0x14, 0x3f, 0xa4, 0xfb, 0xfb, 0xe0, 0xd8, 0xe5, 0x83, 0xfb, 0x0a,
+    0xf9, 0xf1, 0xcc, 0x96, 0x4f, 0x17, 0x0e, 0x30, 0x69, 0xaf, 0xe9, 0x84, 0xfb, 0x03,
+    0xe1, 0x19, 0x00, 0x7e, 0x83, 0xfb, 0x03, 0x7e, 0x00, 0x19, 0xe1, 0x84, 0xfb, 0x19,
+    0xe9, 0xaf, 0x69, 0x30, 0x0e, 0x17, 0x4f, 0x96, 0xcc, 0xf1, 0xf9, 0xfb, 0xfb, 0xf5,
+    0xc6, 0x58, 0x68, 0xbf, 0xfb, 0xfb, 0xa1, 0x3d, 0x14, 0x56, 0xe4, 0xf9, 0x8c, 0xfb,
+    0x8c, 0xfb, 0x0a, 0xf9, 0xdf, 0x3e, 0x10, 0x65, 0xd4, 0xfb, 0xfb, 0x93, 0x73, 0xa3,
+    0x86, 0xfb, 0x10, 0xe4, 0xb4, 0x7a, 0x3f, 0x0d, 0x1b, 0x49, 0x85, 0xbe, 0xef, 0xf9,
+    0xfb, 0xfb, 0xe1, 0x19, 0x00, 0x7e, 0x83, 0xfb, 0x10, 0x7e, 0x00, 0x19, 0xe1, 0xfb,
+    0xfb, 0xf9, 0xef, 0xbe, 0x85, 0x49, 0x1b, 0x0d, 0x3f, 0x7a, 0xb4, 0xe4, 0x84, 0xfb,
+    0x0c, 0xf7, 0xd6, 0x76, 0x84, 0xcd, 0xfb, 0xfb, 0xcf, 0x5f, 0x0d, 0x3e, 0xdf, 0xf9,
+    0x8c, 0xfb, 0x8c, 0xfb, 0x0f, 0xef, 0xbf, 0x19, 0x19, 0x8b, 0xf5, 0xfb, 0xfa, 0x74,
+    0x49, 0x8b, 0xfb, 0xfb, 0xf6, 0xf5, 0xf8, 0x82, 0xfb, 0x0f, 0xfa, 0xe1, 0xa3, 0x59,
+    0x2b, 0x10, 0x1b, 0x5b, 0xa4, 0xd1, 0xea, 0xe7, 0xb6, 0x14, 0x00, 0x7e, 0x83, 0xfb,
+    0x0f, 0x7e, 0x00, 0x14, 0xb6, 0xe7, 0xea, 0xd1, 0xa4, 0x5b, 0x1b, 0x11, 0x2b, 0x59,
+    0xa4, 0xe2, 0xfa, 0x82, 0xfb, 0x0f, 0xf8, 0xf5, 0xf6, 0xfb, 0xf9, 0xcb, 0xd4, 0xf3,
+    0xfb, 0xfb, 0xf1, 0x83, 0x12, 0x1a, 0xc0, 0xf0, 0x8c, 0xfb, 0x8c, 0xfb, 0x04, 0xdd,
+    0x89, 0x0f, 0x40, 0xab, 0x82, 0xfb, 0x09, 0xc4, 0xb7, 0xd3, 0xfb, 0xfb, 0xe1, 0xd5,
+    0xdd, 0xf2, 0xfa, 0x82, 0xfb, 0x0d, 0xf9, 0xe9, 0x93, 0x42, 0x10, 0x06, 0x15, 0x6d,
+    0xae, 0xa6, 0x4b, 0x09, 0x08, 0x84, 0x83, 0xfb, 0x0d, 0x84, 0x08, 0x09, 0x4b, 0xa6,
+    0xae, 0x6d, 0x15, 0x06, 0x10, 0x43, 0x94, 0xe9, 0xf9, 0x82, 0xfb, 0x04, 0xfa, 0xf2,
+    0xdd, 0xd5, 0xe1, 0x82, 0xfb, 0x09, 0xf5, 0xee, 0xef, 0xfa, 0xfb, 0xa4, 0x37, 0x0f,
+    0x89, 0xdd, 0x8c, 0xfb, 0x8c, 0xfb, 0x04, 0xca, 0x51, 0x08, 0x6c, 0xca, 0x82, 0xfb,
+    0x0a, 0xf5, 0xf3, 0xf6, 0xfb, 0xfb, 0x9f, 0x52, 0x4f, 0xab, 0xf0, 0xfa, 0x82, 0xfb,
+    0x0c, 0xf9, 0xef, 0xce, 0x8b, 0x2a, 0x06, 0x0c, 0x15, 0x15, 0x09, 0x10, 0x50, 0xb2,
+    0x83, 0xfb, 0x0c, 0xb2, 0x50, 0x0f, 0x09, 0x15, 0x15, 0x0c, 0x06, 0x2a, 0x8c, 0xce,
+    0xef, 0xf9, 0x82, 0xfb, 0x05, 0xfa, 0xf0, 0xab, 0x4f, 0x52, 0x9f, 0x82, 0xfb, 0x09,
+    0xc4, 0x8b, 0x8f, 0xef, 0xfb, 0xc8, 0x68, 0x09, 0x52, 0xcb, 0x8c, 0xfb, 0x8c, 0xfb,
+    0x13, 0xbd, 0x29, 0x04, 0x91, 0xe5, 0xf9, 0xeb, 0xa7, 0xca, 0xec, 0xfb, 0xfb, 0xfa,
+    0x6e, 0x1b, 0x12, 0x34, 0x68, 0xb4, 0xe7, 0x83, 0xfb, 0x0a, 0xf3, 0xdd, 0xb5, 0x74,
+    0x2a, 0x08, 0x17, 0x54, 0xa2, 0xc7, 0xe7, 0x83, 0xfb, 0x0a, 0xe7, 0xc7, 0xa2, 0x54,
+    0x17, 0x08, 0x2a, 0x75, 0xb5, 0xdd, 0xf3, 0x83, 0xfb, 0x13, 0xe7, 0xb4, 0x68, 0x34,
+    0x12, 0x1b, 0x6f, 0xfa, 0xfb, 0xfb, 0xa2, 0x47, 0x53, 0xe8, 0xfb, 0xe4, 0x90, 0x04,
+    0x2a, 0xbd, 0x8c, 0xfb, 0x8b, 0xfb, 0x17, 0xf6, 0xac, 0x0f, 0x0f, 0xab, 0xf5, 0xf2,
+    0xcd, 0x4c, 0x82, 0xcd, 0xfb, 0xf8, 0xe0, 0x4a, 0x09, 0x09, 0x0e, 0x18, 0x4b, 0x87,
+    0xbf, 0xf0, 0xfa, 0x82, 0xfb, 0x07, 0xf5, 0xcf, 0x96, 0x6f, 0x76, 0xb9, 0xef, 0xf9,
+    0x85, 0xfb, 0x07, 0xf9, 0xef, 0xb8, 0x76, 0x6f, 0x96, 0xcf, 0xf5, 0x82, 0xfb, 0x17,
+    0xfa, 0xf0, 0xbf, 0x87, 0x4b, 0x18, 0x0e, 0x09, 0x09, 0x4b, 0xe0, 0xf8, 0xfb, 0xc4,
+    0x8f, 0x97, 0xf0, 0xfb, 0xf4, 0xaa, 0x0f, 0x10, 0xad, 0xf6, 0x8b, 0xfb, 0x8b, 0xfb,
+    0x19, 0xe9, 0x95, 0x04, 0x28, 0xbc, 0xfb, 0xf1, 0xc9, 0x49, 0x7b, 0xc8, 0xfb, 0xf3,
+    0xb5, 0x33, 0x11, 0x33, 0x55, 0x29, 0x0c, 0x20, 0x5d, 0xa6, 0xd2, 0xef, 0xfa, 0x82,
+    0xfb, 0x02, 0xf4, 0xde, 0xda, 0x8b, 0xfb, 0x02, 0xda, 0xde, 0xf4, 0x82, 0xfb, 0x19,
+    0xfa, 0xef, 0xd2, 0xa6, 0x5d, 0x20, 0x0c, 0x29, 0x55, 0x33, 0x11, 0x34, 0xb7, 0xf3,
+    0xfb, 0xf5, 0xf1, 0xf4, 0xfa, 0xfb, 0xfb, 0xbc, 0x26, 0x04, 0x96, 0xe9, 0x8b, 0xfb,
+    0x87, 0xfb, 0x1e, 0xf9, 0xf4, 0xed, 0xe8, 0xc2, 0x70, 0x07, 0x47, 0xc7, 0xfb, 0xfb,
+    0xf5, 0xca, 0xe5, 0xf7, 0xfb, 0xee, 0x8b, 0x24, 0x2b, 0x87, 0xe6, 0x92, 0x3c, 0x12,
+    0x08, 0x16, 0x6e, 0xc0, 0xe9, 0xf6, 0x95, 0xfb, 0x1e, 0xf6, 0xe9, 0xc0, 0x6e, 0x16,
+    0x08, 0x12, 0x3c, 0x92, 0xe6, 0x86, 0x2b, 0x25, 0x8c, 0xee, 0xfb, 0xfb, 0xf5, 0xe9,
+    0xef, 0xf8, 0xfb, 0xc6, 0x46, 0x07, 0x70, 0xc2, 0xe8, 0xed, 0xf4, 0xf9, 0x87, 0xfb,
+    0x87, 0xfb, 0x1e, 0xeb, 0xbd, 0x84, 0x55, 0x2b, 0x0d, 0x0a, 0x62, 0xd0, 0xfb, 0xfb,
+    0xfa, 0xf5, 0xf8, 0xfb, 0xfb, 0xea, 0x65, 0x19, 0x44, 0xab, 0xf9, 0xef, 0xd1, 0x87,
+    0x31, 0x02, 0x0c, 0x2b, 0x79, 0xcc, 0x95, 0xfb, 0x1e, 0xcc, 0x79, 0x2b, 0x0c, 0x02,
+    0x31, 0x87, 0xd1, 0xef, 0xf9, 0xa9, 0x43, 0x19, 0x66, 0xea, 0xfb, 0xfa, 0xc8, 0x5f,
+    0x90, 0xdc, 0xfb, 0xd0, 0x62, 0x0a, 0x0d, 0x2b, 0x55, 0x84, 0xbd, 0xeb, 0x87, 0xfb,
+    0x86, 0xfb, 0x22, 0xd3, 0x8b, 0x36, 0x22, 0x13, 0x09, 0x11, 0x37, 0x97, 0xe1, 0xfb,
+    0xe8, 0xb9, 0xaa, 0xe2, 0xfb, 0xfb, 0xe7, 0x49, 0x0f, 0x59, 0xc8, 0xfb, 0xfb, 0xf4,
+    0xdc, 0xb1, 0x76, 0x26, 0x10, 0x1f, 0x4a, 0x89, 0xd9, 0xf4, 0x8f, 0xfb, 0x22, 0xf4,
+    0xd9, 0x89, 0x4a, 0x1f, 0x10, 0x26, 0x76, 0xb1, 0xdc, 0xf4, 0xfb, 0xfb, 0xc7, 0x58,
+    0x10, 0x4a, 0xe7, 0xfb, 0xf6, 0xb3, 0x2d, 0x6b, 0xd2, 0xfb, 0xe1, 0x97, 0x37, 0x10,
+    0x09, 0x13, 0x22, 0x36, 0x8b, 0xd4, 0x86, 0xfb, 0x86, 0xfb, 0x15, 0xa4, 0x37, 0x05,
+    0x33, 0x53, 0x6d, 0x87, 0xa1, 0xd4, 0xf1, 0xfb, 0xcf, 0x68, 0x4e, 0xc5, 0xfb, 0xfb,
+    0xe4, 0x33, 0x08, 0x66, 0xdb, 0x83, 0xfb, 0x08, 0xf1, 0xd1, 0x96, 0x5c, 0x26, 0x0f,
+    0x32, 0xaa, 0xe7, 0x8f, 0xfb, 0x08, 0xe7, 0xaa, 0x32, 0x0f, 0x26, 0x5c, 0x96, 0xd1,
+    0xf1, 0x83, 0xfb, 0x15, 0xda, 0x66, 0x09, 0x35, 0xe4, 0xfb, 0xf8, 0xd2, 0x8a, 0xac,
+    0xe5, 0xfb, 0xf1, 0xd4, 0xa1, 0x87, 0x6d, 0x53, 0x33, 0x05, 0x38, 0xa5, 0x86, 0xfb,
+    0x86, 0xfb, 0x06, 0x85, 0x09, 0x0f, 0x8e, 0xbf, 0xe2, 0xf7, 0x83, 0xfb, 0x0a, 0xcf,
+    0x67, 0x52, 0xc6, 0xfb, 0xfb, 0xe2, 0x24, 0x03, 0x70, 0xe8, 0x85, 0xfb, 0x06, 0xf8,
+    0xc4, 0x67, 0x15, 0x10, 0x92, 0xe0, 0x8f, 0xfb, 0x06, 0xe0, 0x92, 0x10, 0x15, 0x67,
+    0xc4, 0xf8, 0x85, 0xfb, 0x09, 0xe7, 0x6f, 0x04, 0x25, 0xe3, 0xfb, 0xfb, 0xf9, 0xf5,
+    0xfa, 0x84, 0xfb, 0x06, 0xf7, 0xe2, 0xbf, 0x8e, 0x0f, 0x0a, 0x85, 0x86, 0xfb, 0x86,
+    0xfb, 0x03, 0x7e, 0x00, 0x19, 0xe1, 0x86, 0xfb, 0x0a, 0xf4, 0xe4, 0xe3, 0xf4, 0xfb,
+    0xfb, 0xe2, 0x1d, 0x01, 0x78, 0xf3, 0x87, 0xfb, 0x04, 0x9f, 0x30, 0x12, 0xa1, 0xe6,
+    0x8f, 0xfb, 0x04, 0xe6, 0xa1, 0x12, 0x30, 0x9f, 0x87, 0xfb, 0x0a, 0xf3, 0x77, 0x01,
+    0x1d, 0xe2, 0xfb, 0xfb, 0xf6, 0xeb, 0xec, 0xf6, 0x86, 0xfb, 0x03, 0xe1, 0x19, 0x00,
+    0x7e, 0x86, 0xfb, 0x86, 0xfb, 0x03, 0x7e, 0x00, 0x19, 0xe1, 0x86, 0xfb, 0x0a, 0xfa,
+    0xf8, 0xf8, 0xfa, 0xfb, 0xfb, 0xe2, 0x1d, 0x01, 0x78, 0xf3, 0x87, 0xfb, 0x04, 0x9f,
+    0x30, 0x12, 0xa1, 0xe6, 0x8f, 0xfb, 0x04, 0xe6, 0xa1, 0x12, 0x30, 0x9f, 0x87, 0xfb,
+    0x0a, 0xf3, 0x77, 0x01, 0x1d, 0xe2, 0xfb, 0xfb, 0xd1, 0x73, 0x77, 0xd3, 0x86, 0xfb,
+    0x03, 0xe1, 0x19, 0x00, 0x7e, 0x86, 0xfb, 0x86, 0xfb, 0x06, 0x85, 0x09, 0x0f, 0x8e,
+    0xbf, 0xe2, 0xf7, 0x83, 0xfb, 0x0a, 0xe9, 0xbd, 0xa5, 0xe0, 0xfb, 0xfb, 0xe2, 0x24,
+    0x03, 0x70, 0xe8, 0x85, 0xfb, 0x06, 0xf8, 0xc4, 0x67, 0x15, 0x10, 0x92, 0xe0, 0x8f,
+    0xfb, 0x06, 0xe0, 0x92, 0x10, 0x15, 0x67, 0xc4, 0xf8, 0x85, 0xfb, 0x0a, 0xe7, 0x6f,
+    0x04, 0x25, 0xe3, 0xfb, 0xfb, 0xc2, 0x42, 0x4d, 0xc6, 0x83, 0xfb, 0x06, 0xf7, 0xe1,
+    0xbf, 0x8e, 0x0f, 0x0a, 0x85, 0x86, 0xfb, 0x86, 0xfb, 0x15, 0xa4, 0x37, 0x05, 0x33,
+    0x53, 0x6d, 0x87, 0xa1, 0xd4, 0xf1, 0xfb, 0xd2, 0x70, 0x49, 0xc2, 0xfa, 0xfb, 0xe4,
+    0x33, 0x08, 0x66, 0xdb, 0x83, 0xfb, 0x08, 0xf1, 0xd1, 0x96, 0x5c, 0x26, 0x0f, 0x32,
+    0xaa, 0xe7, 0x8f, 0xfb, 0x08, 0xe7, 0xaa, 0x32, 0x0f, 0x26, 0x5c, 0x96, 0xd1, 0xf1,
+    0x83, 0xfb, 0x15, 0xda, 0x66, 0x09, 0x35, 0xe4, 0xfb, 0xfb, 0xdb, 0x94, 0x9c, 0xdf,
+    0xfb, 0xf1, 0xd4, 0xa1, 0x86, 0x6d, 0x52, 0x33, 0x05, 0x38, 0xa5, 0x86, 0xfb, 0x86,
+    0xfb, 0x22, 0xd3, 0x8b, 0x36, 0x22, 0x14, 0x09, 0x10, 0x37, 0x97, 0xe1, 0xfb, 0xd2,
+    0x6f, 0x4e, 0xc3, 0xfa, 0xfb, 0xe7, 0x49, 0x10, 0x59, 0xc8, 0xfb, 0xfb, 0xf4, 0xdc,
+    0xb1, 0x76, 0x26, 0x10, 0x1f, 0x4a, 0x89, 0xd9, 0xf4, 0x8f, 0xfb, 0x22, 0xf4, 0xd9,
+    0x89, 0x4a, 0x1f, 0x10, 0x26, 0x76, 0xb1, 0xdc, 0xf4, 0xfb, 0xfb, 0xc7, 0x58, 0x10,
+    0x4a, 0xe7, 0xfb, 0xfb, 0xfa, 0xf6, 0xf9, 0xfb, 0xfb, 0xe0, 0x96, 0x36, 0x10, 0x09,
+    0x14, 0x23, 0x36, 0x8c, 0xd4, 0x86, 0xfb, 0x87, 0xfb, 0x1e, 0xeb, 0xbe, 0x85, 0x55,
+    0x2b, 0x0d, 0x0a, 0x63, 0xd0, 0xfb, 0xf5, 0xe7, 0xe2, 0xf3, 0xfb, 0xfb, 0xea, 0x66,
+    0x19, 0x44, 0xab, 0xf9, 0xef, 0xd1, 0x87, 0x31, 0x02, 0x0c, 0x2b, 0x79, 0xcc, 0x95,
+    0xfb, 0x1e, 0xcc, 0x79, 0x2b, 0x0c, 0x02, 0x31, 0x87, 0xd1, 0xef, 0xf9, 0xa9, 0x43,
+    0x19, 0x66, 0xea, 0xfb, 0xf8, 0xf0, 0xe7, 0xf4, 0xfa, 0xfb, 0xcf, 0x61, 0x0a, 0x0d,
+    0x2b, 0x55, 0x85, 0xbe, 0xeb, 0x87, 0xfb, 0x87, 0xfb, 0x1e, 0xf9, 0xf4, 0xed, 0xe8,
+    0xc2, 0x6f, 0x07, 0x47, 0xc7, 0xfb, 0xfa, 0xf9, 0xf8, 0xfa, 0xfb, 0xfb, 0xee, 0x8b,
+    0x25, 0x2b, 0x87, 0xe6, 0x92, 0x3c, 0x12, 0x08, 0x16, 0x6e, 0xc0, 0xe9, 0xf6, 0x95,
+    0xfb, 0x1e, 0xf6, 0xe9, 0xc0, 0x6e, 0x16, 0x08, 0x12, 0x3c, 0x92, 0xe6, 0x86, 0x2b,
+    0x25, 0x8c, 0xee, 0xfb, 0xe0, 0x9b, 0x4b, 0xc1, 0xee, 0xfb, 0xc6, 0x45, 0x07, 0x70,
+    0xc3, 0xe8, 0xed, 0xf4, 0xf9, 0x87, 0xfb, 0x8b, 0xfb, 0x19, 0xe9, 0x95, 0x04, 0x27,
+    0xbc, 0xfb, 0xfb, 0xef, 0x9b, 0xae, 0xdb, 0xfb, 0xf3, 0xb6, 0x34, 0x11, 0x33, 0x55,
+    0x29, 0x0c, 0x20, 0x5d, 0xa6, 0xd2, 0xef, 0xfa, 0x82, 0xfb, 0x02, 0xf4, 0xde, 0xda,
+    0x8b, 0xfb, 0x02, 0xda, 0xde, 0xf4, 0x82, 0xfb, 0x19, 0xfa, 0xef, 0xd2, 0xa6, 0x5d,
+    0x20, 0x0c, 0x29, 0x55, 0x33, 0x11, 0x34, 0xb7, 0xf3, 0xfb, 0xd8, 0x85, 0x25, 0xb1,
+    0xea, 0xfb, 0xbb, 0x25, 0x04, 0x96, 0xea, 0x8b, 0xfb, 0x8b, 0xfb, 0x17, 0xf6, 0xac,
+    0x0f, 0x0f, 0xaa, 0xf4, 0xf8, 0xdf, 0x4b, 0x67, 0xba, 0xfb, 0xf8, 0xe0, 0x4b, 0x09,
+    0x09, 0x0e, 0x18, 0x4b, 0x87, 0xbf, 0xf0, 0xfa, 0x82, 0xfb, 0x07, 0xf5, 0xcf, 0x96,
+    0x6f, 0x76, 0xb8, 0xef, 0xf9, 0x85, 0xfb, 0x07, 0xf9, 0xef, 0xb8, 0x76, 0x6f, 0x96,
+    0xcf, 0xf5, 0x82, 0xfb, 0x17, 0xfa, 0xf0, 0xbf, 0x87, 0x4b, 0x18, 0x0e, 0x09, 0x09,
+    0x4b, 0xe1, 0xf8, 0xfb, 0xe8, 0xbc, 0x8b, 0xd4, 0xf2, 0xf4, 0xa9, 0x0e, 0x11, 0xad,
+    0xf6, 0x8b, 0xfb, 0x8c, 0xfb, 0x13, 0xbc, 0x28, 0x04, 0x91, 0xe4, 0xf8, 0xe0, 0x5d,
+    0x75, 0xc0, 0xfb, 0xfb, 0xfa, 0x6f, 0x1b, 0x12, 0x34, 0x68, 0xb4, 0xe7, 0x83, 0xfb,
+    0x0a, 0xf3, 0xdd, 0xb5, 0x75, 0x2a, 0x08, 0x17, 0x54, 0xa2, 0xc7, 0xe7, 0x83, 0xfb,
+    0x0a, 0xe7, 0xc7, 0xa2, 0x54, 0x17, 0x08, 0x2a, 0x74, 0xb5, 0xdd, 0xf3, 0x83, 0xfb,
+    0x13, 0xe7, 0xb4, 0x68, 0x34, 0x12, 0x1b, 0x6f, 0xfa, 0xfb, 0xfb, 0xf9, 0xf8, 0xf8,
+    0xfb, 0xfb, 0xe3, 0x8f, 0x04, 0x2c, 0xbe, 0x8c, 0xfb, 0x8c, 0xfb, 0x09, 0xca, 0x50,
+    0x08, 0x6c, 0xca, 0xfb, 0xf8, 0xe4, 0xf0, 0xf9, 0x82, 0xfb, 0x05, 0x9f, 0x52, 0x4f,
+    0xab, 0xf0, 0xfa, 0x82, 0xfb, 0x0c, 0xf9, 0xef, 0xce, 0x8c, 0x2a, 0x06, 0x0c, 0x15,
+    0x15, 0x09, 0x0f, 0x50, 0xb2, 0x83, 0xfb, 0x0c, 0xb2, 0x50, 0x0f, 0x09, 0x15, 0x15,
+    0x0c, 0x06, 0x2a, 0x8b, 0xce, 0xef, 0xf9, 0x82, 0xfb, 0x12, 0xfa, 0xf0, 0xab, 0x4f,
+    0x52, 0x9f, 0xfb, 0xfb, 0xf2, 0xe4, 0xe2, 0xf8, 0xfb, 0xfb, 0xc7, 0x68, 0x09, 0x54,
+    0xcb, 0x8c, 0xfb, 0x8c, 0xfb, 0x08, 0xdc, 0x88, 0x0f, 0x40, 0xab, 0xfb, 0xfb, 0xf8,
+    0xfa, 0x83, 0xfb, 0x04, 0xe1, 0xd5, 0xdd, 0xf2, 0xfa, 0x82, 0xfb, 0x0d, 0xf9, 0xe9,
+    0x94, 0x43, 0x10, 0x06, 0x15, 0x6d, 0xae, 0xa6, 0x4b, 0x09, 0x08, 0x84, 0x83, 0xfb,
+    0x0d, 0x84, 0x08, 0x09, 0x4b, 0xa6, 0xae, 0x6d, 0x15, 0x06, 0x10, 0x42, 0x93, 0xe9,
+    0xf9, 0x82, 0xfb, 0x11, 0xfa, 0xf2, 0xdd, 0xd5, 0xe1, 0xfb, 0xfb, 0xb0, 0x5a, 0x5c,
+    0xe2, 0xf8, 0xfb, 0xa4, 0x37, 0x0f, 0x8b, 0xde, 0x8c, 0xfb, 0x8c, 0xfb, 0x0f, 0xef,
+    0xbf, 0x19, 0x19, 0x8b, 0xf5, 0xfb, 0xfb, 0xbb, 0x84, 0x91, 0xf4, 0xfa, 0xf6, 0xf5,
+    0xf8, 0x82, 0xfb, 0x0f, 0xfa, 0xe2, 0xa4, 0x59, 0x2b, 0x11, 0x1b, 0x5b, 0xa4, 0xd1,
+    0xea, 0xe7, 0xb6, 0x14, 0x00, 0x7e, 0x83, 0xfb, 0x0f, 0x7e, 0x00, 0x14, 0xb6, 0xe7,
+    0xea, 0xd1, 0xa4, 0x5b, 0x1b, 0x10, 0x2b, 0x59, 0xa3, 0xe1, 0xfa, 0x82, 0xfb, 0x0f,
+    0xf8, 0xf5, 0xf6, 0xfb, 0xfb, 0xb7, 0x65, 0x65, 0xe7, 0xf9, 0xf1, 0x82, 0x12, 0x1a,
+    0xc1, 0xf0, 0x8c, 0xfb, 0x8c, 0xfb, 0x0c, 0xf9, 0xdf, 0x3d, 0x10, 0x65, 0xd4, 0xfb,
+    0xfb, 0x9f, 0x51, 0x67, 0xf4, 0xfa, 0x84, 0xfb, 0x10, 0xe4, 0xb4, 0x7a, 0x3f, 0x0d,
+    0x1b, 0x49, 0x85, 0xbe, 0xef, 0xf9, 0xfb, 0xfb, 0xe1, 0x19, 0x00, 0x7e, 0x83, 0xfb,
+    0x10, 0x7e, 0x00, 0x19, 0xe1, 0xfb, 0xfb, 0xf9, 0xef, 0xbe, 0x85, 0x49, 0x1b, 0x0d,
+    0x3f, 0x7a, 0xb4, 0xe4, 0x86, 0xfb, 0x0a, 0xdd, 0xb5, 0xb5, 0xf3, 0xfa, 0xcf, 0x5f,
+    0x0e, 0x3f, 0xe0, 0xf9, 0x8c, 0xfb, 0x8c, 0xfb, 0x0b, 0xf9, 0xe4, 0x56, 0x14, 0x3f,
+    0xa4, 0xfb, 0xfb, 0xba, 0x86, 0x95, 0xf8, 0x82, 0xfb, 0x0a, 0xf9, 0xf1, 0xcc, 0x96,
+    0x4f, 0x17, 0x0e, 0x30, 0x69, 0xaf, 0xe9, 0x84, 0xfb, 0x03, 0xe1, 0x19, 0x00, 0x7e,
+    0x83, 0xfb, 0x03, 0x7e, 0x00, 0x19, 0xe1, 0x84, 0xfb, 0x10, 0xe9, 0xaf, 0x69, 0x30,
+    0x0e, 0x17, 0x4f, 0x96, 0xcc, 0xf1, 0xf9, 0xfb, 0xfa, 0xf3, 0xdc, 0xee, 0xf9, 0x82,
+    0xfb, 0x05, 0xa1, 0x3d, 0x15, 0x58, 0xe4, 0xfa, 0x8c, 0xfb, 0x8b, 0xfb, 0x06, 0xfa,
+    0xef, 0xc5, 0x3d, 0x0f, 0x2c, 0x88, 0x83, 0xfb, 0x0d, 0xf9, 0xf5, 0xf2, 0xf8, 0xfb,
+    0xf6, 0xdc, 0x61, 0x18, 0x00, 0x10, 0x42, 0xaa, 0xe7, 0x86, 0xfb, 0x03, 0xe1, 0x19,
+    0x00, 0x7e, 0x83, 0xfb, 0x03, 0x7e, 0x00, 0x19, 0xe1, 0x86, 0xfb, 0x0e, 0xe7, 0xaa,
+    0x42, 0x10, 0x00, 0x18, 0x61, 0xdc, 0xf6, 0xfb, 0xf4, 0xd9, 0x88, 0xc5, 0xf0, 0x82,
+    0xfb, 0x06, 0x88, 0x2b, 0x0f, 0x3e, 0xc6, 0xef, 0xfa, 0x8b, 0xfb, 0x8b, 0xfb, 0x06,
+    0xf2, 0xb6, 0x3c, 0x0b, 0x16, 0x75, 0xda, 0x83, 0xfb, 0x0d, 0xed, 0xca, 0xaf, 0xe3,
+    0xfb, 0xfa, 0xe5, 0x5a, 0x15, 0x03, 0x3e, 0xc5, 0xee, 0xf9, 0x86, 0xfb, 0x03, 0xe1,
+    0x19, 0x00, 0x7e, 0x83, 0xfb, 0x03, 0x7e, 0x00, 0x19, 0xe1, 0x86, 0xfb, 0x0e, 0xf9,
+    0xee, 0xc5, 0x3e, 0x03, 0x15, 0x5a, 0xe5, 0xfa, 0xfb, 0xe2, 0x97, 0x1c, 0x74, 0xcd,
+    0x82, 0xfb, 0x06, 0xda, 0x75, 0x16, 0x0b, 0x3c, 0xb6, 0xf2, 0x8b, 0xfb, 0x8a, 0xfb,
+    0x07, 0xf9, 0xb0, 0x4e, 0x0f, 0x19, 0x7c, 0xcb, 0xf4, 0x83, 0xfb, 0x0d, 0xce, 0x63,
+    0x38, 0xba, 0xf8, 0xfb, 0xf4, 0xc1, 0x4e, 0x10, 0x1a, 0x5f, 0xd0, 0xf2, 0x86, 0xfb,
+    0x03, 0xe1, 0x19, 0x00, 0x7e, 0x83, 0xfb, 0x03, 0x7e, 0x00, 0x19, 0xe1, 0x86, 0xfb,
+    0x0e, 0xf2, 0xcf, 0x5f, 0x1a, 0x11, 0x4e, 0xc2, 0xf4, 0xfb, 0xfb, 0xf1, 0xd0, 0x7a,
+    0xb6, 0xe8, 0x82, 0xfb, 0x07, 0xf4, 0xcb, 0x7c, 0x18, 0x0f, 0x4f, 0xb1, 0xfa, 0x8a,
+    0xfb, 0x8a, 0xfb, 0x06, 0xe6, 0x7c, 0x16, 0x1a, 0x79, 0xcd, 0xf4, 0x84, 0xfb, 0x0e,
+    0xd8, 0x84, 0x60, 0xc8, 0xf9, 0xfb, 0xfa, 0xf5, 0xa7, 0x4d, 0x12, 0x17, 0x68, 0xb5,
+    0xe7, 0x85, 0xfb, 0x03, 0xe1, 0x19, 0x00, 0x7e, 0x83, 0xfb, 0x03, 0x7e, 0x00, 0x19,
+    0xe1, 0x85, 0xfb, 0x0f, 0xe7, 0xb5, 0x68, 0x16, 0x12, 0x4e, 0xa8, 0xf5, 0xfa, 0xf6,
+    0xed, 0xeb, 0xf4, 0xd0, 0xe9, 0xf8, 0x83, 0xfb, 0x06, 0xf4, 0xcd, 0x78, 0x1a, 0x17,
+    0x7d, 0xe7, 0x8a, 0xfb, 0x8a, 0xfb, 0x05, 0xd7, 0x64, 0x07, 0x2d, 0xd0, 0xf4, 0x83,
+    0xfb, 0x13, 0xfa, 0xfb, 0xf2, 0xdb, 0xcb, 0xeb, 0xef, 0xe9, 0xf7, 0xfb, 0xef, 0xa5,
+    0x49, 0x11, 0x0d, 0x57, 0xa1, 0xd8, 0xf6, 0xfa, 0x82, 0xfb, 0x03, 0xe1, 0x19, 0x00,
+    0x7e, 0x83, 0xfb, 0x03, 0x7e, 0x00, 0x19, 0xe1, 0x82, 0xfb, 0x0f, 0xfa, 0xf6, 0xd8,
+    0xa1, 0x57, 0x0d, 0x11, 0x4b, 0xa6, 0xef, 0xfb, 0xfb, 0xce, 0xa7, 0xb1, 0xf8, 0x87,
+    0xfb, 0x05, 0xf4, 0xd0, 0x2d, 0x07, 0x65, 0xd8, 0x8a, 0xfb, 0x8a, 0xfb, 0x24, 0xe0,
+    0x6e, 0x09, 0x23, 0xc7, 0xf1, 0xf7, 0xf2, 0xec, 0xe7, 0xe5, 0xef, 0xfa, 0xfb, 0xfb,
+    0xf5, 0xc6, 0xaf, 0xe3, 0xf8, 0xfb, 0xf2, 0xb9, 0x46, 0x11, 0x03, 0x2a, 0x7b, 0xd3,
+    0xea, 0xf5, 0xfa, 0xfb, 0xe1, 0x19, 0x00, 0x7e, 0x83, 0xfb, 0x0f, 0x7e, 0x00, 0x19,
+    0xe1, 0xfb, 0xfa, 0xf5, 0xea, 0xd3, 0x7b, 0x2a, 0x03, 0x12, 0x48, 0xba, 0xf2, 0x82,
+    0xfb, 0x11, 0x86, 0x33, 0x56, 0xf2, 0xfa, 0xfb, 0xf0, 0xe5, 0xe7, 0xec, 0xf2, 0xf7,
+    0xf1, 0xc7, 0x23, 0x09, 0x6f, 0xe1, 0x8a, 0xfb, 0x8a, 0xfb, 0x24, 0xf8, 0x97, 0x29,
+    0x0d, 0x6b, 0xd0, 0xdc, 0xae, 0x7b, 0x48, 0x47, 0x9e, 0xf6, 0xfb, 0xfb, 0xd5, 0x6b,
+    0x33, 0x8f, 0xef, 0xfb, 0xfa, 0xf2, 0xd6, 0x71, 0x1e, 0x05, 0x10, 0x2a, 0x77, 0xc7,
+    0xf0, 0xfb, 0xe1, 0x19, 0x00, 0x7e, 0x83, 0xfb, 0x0f, 0x7e, 0x00, 0x19, 0xe1, 0xfb,
+    0xf0, 0xc7, 0x77, 0x2a, 0x10, 0x05, 0x1f, 0x73, 0xd6, 0xf2, 0xfa, 0x82, 0xfb, 0x11,
+    0xbd, 0x8b, 0x99, 0xfa, 0xfb, 0xf7, 0x9f, 0x48, 0x49, 0x7c, 0xae, 0xdc, 0xd0, 0x6b,
+    0x0d, 0x29, 0x98, 0xf8, 0x8a, 0xfb, 0x8b, 0xfb, 0x12, 0xcf, 0x74, 0x05, 0x1c, 0x41,
+    0x43, 0x31, 0x1f, 0x0f, 0x0f, 0x4a, 0xa7, 0xfa, 0xfb, 0xec, 0xa1, 0x7a, 0xc1, 0xf4,
+    0x82, 0xfb, 0x0d, 0xf5, 0xd5, 0x9d, 0x55, 0x1a, 0x06, 0x1e, 0x3b, 0x5e, 0x87, 0x9a,
+    0x11, 0x00, 0x7e, 0x83, 0xfb, 0x23, 0x7e, 0x00, 0x11, 0x9a, 0x87, 0x5e, 0x3b, 0x1e,
+    0x06, 0x1a, 0x56, 0x9e, 0xd5, 0xf5, 0xfb, 0xf1, 0xd7, 0xbb, 0xf3, 0xea, 0xdc, 0xe0,
+    0xfb, 0xfb, 0xaf, 0x50, 0x0f, 0x0f, 0x20, 0x31, 0x43, 0x41, 0x1c, 0x05, 0x75, 0xd0,
+    0x8b, 0xfb, 0x8b, 0xfb, 0x23, 0xf0, 0xb7, 0x48, 0x0e, 0x04, 0x0c, 0x1f, 0x3b, 0x4e,
+    0x1d, 0x19, 0x55, 0xbf, 0xf4, 0xfa, 0xdc, 0xcd, 0xeb, 0xf0, 0xbd, 0xc3, 0xe7, 0xfb,
+    0xfb, 0xe7, 0xb9, 0x83, 0x4f, 0x24, 0x0a, 0x0f, 0x29, 0x3e, 0x06, 0x00, 0x7e, 0x83,
+    0xfb, 0x0b, 0x7e, 0x00, 0x06, 0x3e, 0x29, 0x0f, 0x0a, 0x24, 0x50, 0x84, 0xba, 0xe7,
+    0x82, 0xfb, 0x14, 0xcf, 0x8a, 0x5b, 0xd3, 0xf4, 0xfb, 0xfb, 0xf5, 0xc6, 0x5d, 0x1b,
+    0x1d, 0x4e, 0x3b, 0x1f, 0x0c, 0x04, 0x0e, 0x49, 0xb8, 0xf0, 0x8b, 0xfb, 0x8c, 0xfb,
+    0x14, 0xe7, 0xad, 0x5d, 0x4a, 0x58, 0x79, 0x9d, 0xb9, 0x68, 0x21, 0x1a, 0x61, 0xcd,
+    0xf1, 0xfb, 0xfb, 0xf8, 0xe0, 0x6d, 0x76, 0xc6, 0x83, 0xfb, 0x09, 0xe9, 0xbb, 0x7f,
+    0x51, 0x34, 0x22, 0x14, 0x07, 0x01, 0x7e, 0x83, 0xfb, 0x22, 0x7e, 0x01, 0x07, 0x14,
+    0x22, 0x34, 0x51, 0x80, 0xbc, 0xea, 0xfb, 0xfa, 0xf7, 0xf4, 0xf9, 0xc4, 0x72, 0x41,
+    0xc7, 0xf1, 0xfb, 0xf2, 0xcf, 0x6c, 0x1d, 0x21, 0x68, 0xb9, 0x9d, 0x79, 0x58, 0x4b,
+    0x5d, 0xaf, 0xe7, 0x8c, 0xfb, 0x8e, 0xfb, 0x02, 0xf7, 0xf2, 0xf6, 0x82, 0xfb, 0x10,
+    0xd3, 0x6c, 0x0f, 0x0d, 0x77, 0xcd, 0xf4, 0xfb, 0xf6, 0xd2, 0x4e, 0x54, 0xb0, 0xfa,
+    0xf3, 0xf1, 0xf6, 0x82, 0xfb, 0x06, 0xe5, 0xb8, 0x84, 0x56, 0x30, 0x1c, 0x89, 0x83,
+    0xfb, 0x06, 0x89, 0x1c, 0x30, 0x56, 0x85, 0xb9, 0xe6, 0x83, 0xfb, 0x0f, 0xf1, 0xda,
+    0xd1, 0xee, 0xef, 0xd2, 0xb1, 0xf0, 0xfa, 0xf5, 0xcf, 0x79, 0x0e, 0x10, 0x6c, 0xd3,
+    0x82, 0xfb, 0x02, 0xf6, 0xf2, 0xf8, 0x8e, 0xfb, 0x8f, 0xfb, 0x01, 0xfa, 0xfa, 0x82,
+    0xfb, 0x10, 0xf6, 0xc4, 0x68, 0x02, 0x0d, 0x61, 0xbf, 0xfa, 0xfa, 0xf6, 0xd2, 0xd9,
+    0xf2, 0xf3, 0xb2, 0xa2, 0xcd, 0x82, 0xfb, 0x06, 0xf9, 0xf3, 0xed, 0xe8, 0xe4, 0xd3,
+    0xe4, 0x83, 0xfb, 0x06, 0xe4, 0xd3, 0xe4, 0xe8, 0xed, 0xf3, 0xf9, 0x83, 0xfb, 0x0f,
+    0xc3, 0x41, 0x39, 0xc0, 0xfa, 0xf6, 0xf3, 0xfa, 0xfb, 0xc6, 0x6c, 0x0e, 0x02, 0x69,
+    0xc4, 0xf6, 0x82, 0xfb, 0x01, 0xfa, 0xfa, 0x8f, 0xfb, 0x95, 0xfb, 0x14, 0xee, 0xbf,
+    0x68, 0x0f, 0x1a, 0x55, 0xa8, 0xf7, 0xfb, 0xf4, 0xf6, 0xfb, 0xe9, 0x5f, 0x42, 0x9b,
+    0xfb, 0xfa, 0xf3, 0xf7, 0xfa, 0x82, 0xfb, 0x01, 0xf6, 0xf8, 0x83, 0xfb, 0x01, 0xf8,
+    0xf6, 0x83, 0xfb, 0x08, 0xf6, 0xe6, 0xb6, 0xe2, 0xf9, 0xcf, 0x6b, 0x66, 0xcd, 0x82,
+    0xfb, 0x07, 0xf7, 0xaf, 0x5d, 0x1d, 0x10, 0x69, 0xc0, 0xee, 0x95, 0xfb, 0x96, 0xfb,
+    0x07, 0xee, 0xc4, 0x6c, 0x21, 0x19, 0x4b, 0x9f, 0xef, 0x82, 0xfb, 0x0d, 0xee, 0x8e,
+    0x7c, 0xb9, 0xf7, 0xe1, 0x89, 0xa8, 0xdb, 0xfb, 0xf9, 0xeb, 0xf5, 0xfa, 0x84, 0xfb,
+    0x17, 0xfa, 0xf4, 0xd4, 0xeb, 0xf8, 0xe6, 0xa9, 0x53, 0xa8, 0xe7, 0xe9, 0xbf, 0xbe,
+    0xe8, 0xfb, 0xfb, 0xef, 0x9f, 0x50, 0x1b, 0x21, 0x6c, 0xc4, 0xee, 0x96, 0xfb, 0x97,
+    0xfb, 0x26, 0xf6, 0xd3, 0x68, 0x1d, 0x0f, 0x48, 0xe5, 0xfa, 0xfb, 0xfb, 0xf9, 0xe5,
+    0xe4, 0xf0, 0xf3, 0xcd, 0x2f, 0x6a, 0xc2, 0xf6, 0xe1, 0x9f, 0xc4, 0xe9, 0xf7, 0xe8,
+    0xbb, 0xd5, 0xef, 0xf2, 0xd4, 0x7f, 0xb5, 0xe6, 0xe1, 0x97, 0x3a, 0x96, 0xdf, 0x84,
+    0xfb, 0x07, 0xfa, 0xe5, 0x48, 0x0f, 0x1d, 0x68, 0xd3, 0xf6, 0x97, 0xfb, 0x99, 0xfb,
+    0x04, 0xb9, 0x4e, 0x0f, 0x48, 0xe7, 0x86, 0xfb, 0x18, 0xf6, 0xdc, 0x62, 0x94, 0xd5,
+    0xea, 0xb0, 0x1b, 0x69, 0xc6, 0xee, 0xbd, 0x29, 0x7e, 0xd2, 0xe5, 0xa1, 0x1d, 0x6b,
+    0xc7, 0xf7, 0xe7, 0xac, 0xdc, 0xf7, 0x85, 0xfb, 0x04, 0xe6, 0x47, 0x0f, 0x4e, 0xb9,
+    0x99, 0xfb, 0x99, 0xfb, 0x04, 0x9d, 0x3b, 0x20, 0x7c, 0xec, 0x86, 0xfb, 0x17, 0xfa,
+    0xf7, 0xe9, 0xef, 0xf7, 0xf4, 0xd4, 0x5d, 0x9e, 0xde, 0xef, 0xc0, 0x2e, 0x82, 0xd4,
+    0xf6, 0xe0, 0x85, 0xbc, 0xea, 0xfb, 0xf9, 0xf2, 0xf7, 0x86, 0xfb, 0x04, 0xec, 0x7b,
+    0x1f, 0x3b, 0x9d, 0x99, 0xfb, 0x99, 0xfb, 0x0c, 0x78, 0x1e, 0x31, 0xaf, 0xf2, 0xfb,
+    0xfb, 0xf4, 0xda, 0x88, 0xa1, 0xcf, 0xf1, 0x83, 0xfb, 0x0e, 0xf9, 0xf0, 0xcd, 0xe1,
+    0xf3, 0xf7, 0xe9, 0xbd, 0xd6, 0xef, 0xfa, 0xf5, 0xdb, 0xeb, 0xf7, 0x82, 0xfb, 0x0c,
+    0xf1, 0xcf, 0xa1, 0x88, 0xda, 0xf4, 0xfb, 0xfb, 0xf2, 0xae, 0x31, 0x1e, 0x78, 0x99,
+    0xfb, 0x97, 0xfb, 0x12, 0xfa, 0xf5, 0x58, 0x0c, 0x44, 0xdc, 0xf8, 0xfb, 0xf4, 0xcb,
+    0x75, 0x2b, 0x3d, 0x5f, 0x83, 0xa4, 0xc8, 0xe4, 0xf4, 0x8d, 0xfb, 0x12, 0xf4, 0xe3,
+    0xc7, 0xa4, 0x82, 0x5f, 0x3d, 0x2c, 0x75, 0xcb, 0xf4, 0xfb, 0xf7, 0xdc, 0x44, 0x0c,
+    0x58, 0xf5, 0xfa, 0x97, 0xfb, 0x97, 0xfb, 0x17, 0xfa, 0xf1, 0x4a, 0x05, 0x42, 0xd0,
+    0xf1, 0xf4, 0xcd, 0x7c, 0x16, 0x0f, 0x15, 0x0e, 0x12, 0x37, 0x68, 0x90, 0xaa, 0xbc,
+    0xc6, 0xd0, 0xe0, 0xf1, 0x83, 0xfb, 0x17, 0xf1, 0xe0, 0xd0, 0xc6, 0xbb, 0xa9, 0x8f,
+    0x68, 0x37, 0x12, 0x0d, 0x14, 0x0f, 0x16, 0x7c, 0xcd, 0xf4, 0xf1, 0xcf, 0x41, 0x05,
+    0x4b, 0xf2, 0xfa, 0x97, 0xfb, 0x97, 0xfb, 0x17, 0xfa, 0xf6, 0x5c, 0x0d, 0x1c, 0x6b,
+    0xc7, 0xd0, 0x78, 0x18, 0x0b, 0x3e, 0x58, 0x3f, 0x1a, 0x0f, 0x09, 0x04, 0x0f, 0x26,
+    0x46, 0x62, 0x96, 0xd4, 0x83, 0xfb, 0x16, 0xd4, 0x96, 0x62, 0x45, 0x25, 0x0e, 0x04,
+    0x09, 0x0f, 0x1a, 0x3e, 0x57, 0x3d, 0x0b, 0x19, 0x79, 0xd0, 0xc7, 0x6a, 0x1c, 0x0e,
+    0x5e, 0xf8, 0x98, 0xfb, 0x98, 0xfb, 0x16, 0xfa, 0xad, 0x47, 0x05, 0x0d, 0x24, 0x2d,
+    0x1a, 0x0f, 0x3d, 0xc6, 0xe4, 0xdf, 0xc0, 0x8a, 0x54, 0x2b, 0x10, 0x04, 0x07, 0x0a,
+    0x37, 0xa2, 0x83, 0xfb, 0x15, 0xa1, 0x37, 0x0a, 0x07, 0x03, 0x0f, 0x2a, 0x53, 0x8a,
+    0xc0, 0xdf, 0xe4, 0xc5, 0x3c, 0x0f, 0x1a, 0x2d, 0x23, 0x0d, 0x05, 0x49, 0xaf, 0x99,
+    0xfb, 0x99, 0xfb, 0x2f, 0xe7, 0xb7, 0x74, 0x29, 0x09, 0x07, 0x17, 0x4f, 0xb7, 0xef,
+    0xfa, 0xf9, 0xf0, 0xdd, 0xcb, 0xbd, 0xad, 0x96, 0x6f, 0x0d, 0x11, 0x87, 0xf7, 0xfb,
+    0xfb, 0xf7, 0x87, 0x11, 0x0d, 0x6f, 0x95, 0xad, 0xbd, 0xcb, 0xdd, 0xf0, 0xf9, 0xf9,
+    0xef, 0xb6, 0x4e, 0x16, 0x07, 0x09, 0x29, 0x74, 0xb8, 0xe7, 0x99, 0xfb, 0x9a, 0xfb,
+    0x08, 0xf0, 0xcf, 0x98, 0x6e, 0x64, 0x7d, 0xb1, 0xf2, 0xfa, 0x85, 0xfb, 0x0f, 0xf6,
+    0xe9, 0xc2, 0x2b, 0x09, 0x6d, 0xe2, 0xfb, 0xfb, 0xe1, 0x6d, 0x09, 0x2b, 0xc2, 0xe9,
+    0xf6, 0x85, 0xfb, 0x08, 0xfa, 0xf2, 0xb1, 0x7c, 0x64, 0x6e, 0x97, 0xcf, 0xf0, 0x9a,
+    0xfb, 0x9c, 0xfb, 0x04, 0xf8, 0xe0, 0xd7, 0xe7, 0xfa, 0x89, 0xfb, 0x0b, 0xe8, 0x54,
+    0x13, 0x53, 0xbf, 0xfb, 0xfb, 0xbf, 0x52, 0x14, 0x55, 0xe8, 0x89, 0xfb, 0x04, 0xfa,
+    0xe7, 0xd7, 0xe0, 0xf8, 0x9c, 0xfb, 0xab, 0xfb, 0x0b, 0xed, 0x84, 0x22, 0x33, 0x8e,
+    0xe1, 0xe1, 0x8e, 0x33, 0x22, 0x85, 0xed, 0xab, 0xfb, 0xab, 0xfb, 0x0b, 0xf4, 0xbc,
+    0x36, 0x05, 0x0f, 0x19, 0x19, 0x0f, 0x05, 0x36, 0xbe, 0xf4, 0xab, 0xfb, 0xab, 0xfb,
+    0x0b, 0xf9, 0xea, 0x8b, 0x38, 0x0a, 0x00, 0x00, 0x0a, 0x38, 0x8c, 0xeb, 0xf9, 0xab,
+    0xfb, 0xad, 0xfb, 0x07, 0xd4, 0xa5, 0x85, 0x7e, 0x7e, 0x85, 0xa5, 0xd4, 0xad, 0xfb,
+    0xe3, 0xfb, 0xe3, 0xfb, 0xe3, 0xfb, 0xe3, 0xfb, 0xe3, 0xfb, 0xe3, 0xfb, 0xe3, 0xfb,
+};
+// clang-format on
+
+constexpr bike_computer::CompressedImage gear_icon = {
+    .pPalette    = gear_icon_palette,
+    .pData       = gear_icon_data,
+    .imageWidth  = kGearIconWidth,
+    .imageHeight = kGearIconHeight};
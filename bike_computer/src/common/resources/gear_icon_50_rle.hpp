@@ -0,0 +1,138 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file gear_icon_50_rle.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Gear icon (size 50) as palette indexed RLE data
+ *        (generated by tools/icon_converter.py from gear_icon_50.hpp)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "common/compressed_image.hpp"
+
+constexpr uint8_t kGearIconHeight = 50;
+constexpr uint8_t kGearIconWidth  = 50;
+
+// compressed size is 1413 (raw size is 10000)
+// clang-format off
+const uint32_t gear_icon_palette[] = {
+    0x000000ff, 0x010101ff, 0x030303ff, 0x060606ff, 0x080808ff, 0x090909ff, 0x0a0a0aff,
+    0x0b0b0bff, 0x0c0c0cff, 0x0d0d0dff, 0x0e0e0eff, 0x0f0f0fff, 0x121212ff, 0x131313ff,
+    0x151515ff, 0x161616ff, 0x171717ff, 0x181818ff, 0x1a1a1aff, 0x1b1b1bff, 0x1c1c1cff,
+    0x1d1d1dff, 0x1f1f1fff, 0x212121ff, 0x222222ff, 0x232323ff, 0x252525ff, 0x262626ff,
+    0x272727ff, 0x292929ff, 0x2a2a2aff, 0x2c2c2cff, 0x2d2d2dff, 0x2e2e2eff, 0x313131ff,
+    0x444444ff, 0x454545ff, 0x4b4b4bff, 0x4d4d4dff, 0x4e4e4eff, 0x4f4f4fff, 0x555555ff,
+    0x575757ff, 0x595959ff, 0x5d5d5dff, 0x5f5f5fff, 0x696969ff, 0x7b7b7bff, 0x808080ff,
+    0x828282ff, 0x969696ff, 0x999999ff, 0xa0a0a0ff, 0xa1a1a1ff, 0xafafafff, 0xd4d4d4ff,
+    0xd9d9d9ff, 0xefefefff, 0xf0f0f0ff, 0xf1f1f1ff, 0xf2f2f2ff, 0xf3f3f3ff, 0xf5f5f5ff,
+    0xfcfcfcff, 0xfdfdfdff, 0xfefefeff, 0xffffffff,
+};
+
+const uint8_t gear_icon_data[] = {
+    0x93, 0x42, 0x00, 0x0e, 0x87, 0x00, 0x01, 0x0a, 0x41, 0x92, 0x42, 0x8f, 0x42, 0x00,
+    0x2e, 0x8f, 0x00, 0x00, 0x25, 0x8f, 0x42, 0x8d, 0x42, 0x83, 0x00, 0x00, 0x2f, 0x8b,
+    0x42, 0x00, 0x36, 0x83, 0x00, 0x8d, 0x42, 0x8b, 0x42, 0x82, 0x00, 0x00, 0x11, 0x91,
+    0x42, 0x00, 0x17, 0x82, 0x00, 0x8b, 0x42, 0x8a, 0x42, 0x02, 0x00, 0x00, 0x0c, 0x95,
+    0x42, 0x03, 0x13, 0x00, 0x00, 0x3f, 0x89, 0x42, 0x88, 0x42, 0x02, 0x0b, 0x00, 0x00,
+    0x99, 0x42, 0x02, 0x00, 0x00, 0x05, 0x88, 0x42, 0x84, 0x42, 0x85, 0x00, 0x8b, 0x42,
+    0x83, 0x00, 0x8b, 0x42, 0x02, 0x02, 0x00, 0x00, 0x87, 0x42, 0x83, 0x42, 0x05, 0x00,
+    0x00, 0x42, 0x42, 0x00, 0x00, 0x8b, 0x42, 0x85, 0x00, 0x8b, 0x42, 0x02, 0x38, 0x00,
+    0x00, 0x86, 0x42, 0x83, 0x42, 0x00, 0x00, 0x83, 0x42, 0x01, 0x00, 0x2b, 0x8a, 0x42,
+    0x05, 0x00, 0x0f, 0x42, 0x42, 0x17, 0x00, 0x8c, 0x42, 0x02, 0x3c, 0x00, 0x00, 0x85,
+    0x42, 0x83, 0x42, 0x00, 0x00, 0x83, 0x42, 0x01, 0x00, 0x12, 0x8a, 0x42, 0x00, 0x00,
+    0x83, 0x42, 0x00, 0x00, 0x8d, 0x42, 0x02, 0x37, 0x00, 0x04, 0x84, 0x42, 0x83, 0x42,
+    0x05, 0x00, 0x00, 0x42, 0x42, 0x01, 0x00, 0x82, 0x42, 0x01, 0x00, 0x3f, 0x85, 0x42,
+    0x01, 0x21, 0x00, 0x83, 0x42, 0x01, 0x00, 0x1c, 0x86, 0x42, 0x00, 0x00, 0x85, 0x42,
+    0x01, 0x03, 0x00, 0x84, 0x42, 0x83, 0x42, 0x00, 0x39, 0x83, 0x00, 0x02, 0x17, 0x42,
+    0x42, 0x83, 0x00, 0x84, 0x42, 0x01, 0x00, 0x00, 0x83, 0x42, 0x01, 0x00, 0x00, 0x84,
+    0x42, 0x83, 0x00, 0x85, 0x42, 0x01, 0x00, 0x00, 0x83, 0x42, 0x85, 0x42, 0x01, 0x30,
+    0x2d, 0x82, 0x42, 0x03, 0x00, 0x00, 0x42, 0x3c, 0x82, 0x00, 0x04, 0x42, 0x42, 0x27,
+    0x00, 0x1e, 0x83, 0x42, 0x04, 0x20, 0x00, 0x25, 0x42, 0x42, 0x82, 0x00, 0x03, 0x3b,
+    0x42, 0x00, 0x00, 0x85, 0x42, 0x01, 0x00, 0x00, 0x82, 0x42, 0x89, 0x42, 0x01, 0x00,
+    0x00, 0x83, 0x42, 0x00, 0x08, 0x84, 0x00, 0x85, 0x42, 0x84, 0x00, 0x00, 0x07, 0x83,
+    0x42, 0x01, 0x00, 0x00, 0x84, 0x42, 0x01, 0x15, 0x00, 0x82, 0x42, 0x89, 0x42, 0x02,
+    0x3f, 0x00, 0x3a, 0x84, 0x42, 0x01, 0x00, 0x00, 0x89, 0x42, 0x01, 0x00, 0x00, 0x84,
+    0x42, 0x02, 0x3d, 0x00, 0x3c, 0x85, 0x42, 0x03, 0x00, 0x00, 0x42, 0x42, 0x8a, 0x42,
+    0x01, 0x00, 0x00, 0x97, 0x42, 0x01, 0x00, 0x00, 0x86, 0x42, 0x03, 0x1a, 0x00, 0x42,
+    0x42, 0x8b, 0x42, 0x01, 0x00, 0x07, 0x95, 0x42, 0x01, 0x09, 0x00, 0x88, 0x42, 0x02,
+    0x00, 0x23, 0x42, 0x8b, 0x42, 0x01, 0x00, 0x00, 0x86, 0x42, 0x00, 0x0b, 0x85, 0x00,
+    0x00, 0x09, 0x86, 0x42, 0x01, 0x00, 0x00, 0x88, 0x42, 0x02, 0x00, 0x00, 0x42, 0x8c,
+    0x42, 0x01, 0x00, 0x00, 0x84, 0x42, 0x82, 0x00, 0x03, 0x41, 0x42, 0x42, 0x41, 0x82,
+    0x00, 0x84, 0x42, 0x01, 0x00, 0x00, 0x89, 0x42, 0x02, 0x34, 0x00, 0x42, 0x8c, 0x42,
+    0x01, 0x00, 0x00, 0x83, 0x42, 0x01, 0x00, 0x00, 0x87, 0x42, 0x01, 0x00, 0x00, 0x83,
+    0x42, 0x01, 0x00, 0x00, 0x8a, 0x42, 0x01, 0x00, 0x41, 0x8b, 0x42, 0x01, 0x2a, 0x00,
+    0x83, 0x42, 0x01, 0x00, 0x00, 0x89, 0x42, 0x01, 0x00, 0x00, 0x83, 0x42, 0x01, 0x00,
+    0x24, 0x89, 0x42, 0x01, 0x00, 0x09, 0x8a, 0x42, 0x82, 0x00, 0x82, 0x42, 0x01, 0x0b,
+    0x00, 0x8b, 0x42, 0x01, 0x00, 0x08, 0x82, 0x42, 0x82, 0x00, 0x00, 0x1f, 0x87, 0x42,
+    0x01, 0x00, 0x00, 0x86, 0x42, 0x05, 0x00, 0x00, 0x42, 0x42, 0x00, 0x1c, 0x83, 0x42,
+    0x01, 0x00, 0x00, 0x8b, 0x42, 0x01, 0x00, 0x00, 0x83, 0x42, 0x00, 0x21, 0x84, 0x00,
+    0x84, 0x42, 0x01, 0x00, 0x00, 0x85, 0x42, 0x02, 0x00, 0x00, 0x0e, 0x87, 0x42, 0x01,
+    0x00, 0x41, 0x8c, 0x42, 0x00, 0x00, 0x87, 0x42, 0x02, 0x10, 0x00, 0x00, 0x83, 0x42,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x3c, 0x83, 0x42, 0x01, 0x00, 0x00, 0x88, 0x42, 0x00,
+    0x00, 0x8d, 0x42, 0x00, 0x00, 0x88, 0x42, 0x01, 0x00, 0x00, 0x83, 0x42, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x83, 0x42, 0x01, 0x00, 0x00, 0x88, 0x42, 0x00, 0x00, 0x8d,
+    0x42, 0x00, 0x00, 0x88, 0x42, 0x01, 0x00, 0x00, 0x83, 0x42, 0x01, 0x3e, 0x00, 0x01,
+    0x00, 0x00, 0x83, 0x42, 0x02, 0x00, 0x00, 0x16, 0x87, 0x42, 0x01, 0x00, 0x40, 0x95,
+    0x42, 0x02, 0x19, 0x00, 0x00, 0x85, 0x42, 0x01, 0x00, 0x00, 0x84, 0x42, 0x84, 0x00,
+    0x00, 0x1d, 0x83, 0x42, 0x01, 0x00, 0x00, 0x8b, 0x42, 0x01, 0x00, 0x00, 0x83, 0x42,
+    0x00, 0x22, 0x84, 0x00, 0x86, 0x42, 0x01, 0x00, 0x00, 0x87, 0x42, 0x00, 0x1c, 0x82,
+    0x00, 0x82, 0x42, 0x01, 0x09, 0x00, 0x8b, 0x42, 0x01, 0x00, 0x07, 0x82, 0x42, 0x82,
+    0x00, 0x00, 0x1b, 0x89, 0x42, 0x01, 0x0a, 0x00, 0x89, 0x42, 0x01, 0x29, 0x00, 0x83,
+    0x42, 0x01, 0x00, 0x00, 0x89, 0x42, 0x01, 0x00, 0x00, 0x83, 0x42, 0x01, 0x00, 0x23,
+    0x8b, 0x42, 0x01, 0x41, 0x00, 0x8a, 0x42, 0x01, 0x00, 0x00, 0x83, 0x42, 0x01, 0x00,
+    0x00, 0x87, 0x42, 0x01, 0x00, 0x00, 0x83, 0x42, 0x01, 0x00, 0x00, 0x8c, 0x42, 0x02,
+    0x42, 0x00, 0x35, 0x89, 0x42, 0x01, 0x00, 0x00, 0x84, 0x42, 0x82, 0x00, 0x83, 0x42,
+    0x82, 0x00, 0x84, 0x42, 0x01, 0x00, 0x00, 0x8c, 0x42, 0x02, 0x42, 0x00, 0x00, 0x88,
+    0x42, 0x01, 0x00, 0x00, 0x86, 0x42, 0x00, 0x08, 0x85, 0x00, 0x00, 0x04, 0x86, 0x42,
+    0x01, 0x00, 0x00, 0x8b, 0x42, 0x02, 0x42, 0x25, 0x00, 0x88, 0x42, 0x01, 0x00, 0x06,
+    0x95, 0x42, 0x01, 0x08, 0x00, 0x8b, 0x42, 0x03, 0x42, 0x42, 0x00, 0x17, 0x86, 0x42,
+    0x01, 0x00, 0x00, 0x97, 0x42, 0x01, 0x00, 0x00, 0x8a, 0x42, 0x03, 0x42, 0x42, 0x00,
+    0x00, 0x86, 0x42, 0x01, 0x00, 0x39, 0x84, 0x42, 0x01, 0x00, 0x00, 0x89, 0x42, 0x01,
+    0x00, 0x00, 0x84, 0x42, 0x02, 0x3d, 0x00, 0x3e, 0x89, 0x42, 0x82, 0x42, 0x01, 0x00,
+    0x13, 0x84, 0x42, 0x01, 0x00, 0x00, 0x83, 0x42, 0x00, 0x09, 0x84, 0x00, 0x85, 0x42,
+    0x84, 0x00, 0x00, 0x07, 0x83, 0x42, 0x01, 0x00, 0x00, 0x89, 0x42, 0x82, 0x42, 0x01,
+    0x00, 0x00, 0x85, 0x42, 0x03, 0x00, 0x00, 0x42, 0x3b, 0x82, 0x00, 0x04, 0x42, 0x42,
+    0x28, 0x00, 0x1e, 0x83, 0x42, 0x04, 0x20, 0x00, 0x26, 0x42, 0x42, 0x82, 0x00, 0x03,
+    0x3b, 0x42, 0x00, 0x00, 0x82, 0x42, 0x01, 0x2d, 0x31, 0x85, 0x42, 0x83, 0x42, 0x01,
+    0x00, 0x00, 0x85, 0x42, 0x83, 0x00, 0x84, 0x42, 0x01, 0x00, 0x00, 0x83, 0x42, 0x01,
+    0x00, 0x00, 0x84, 0x42, 0x83, 0x00, 0x02, 0x42, 0x42, 0x1f, 0x83, 0x00, 0x00, 0x39,
+    0x83, 0x42, 0x83, 0x42, 0x02, 0x3f, 0x00, 0x02, 0x85, 0x42, 0x01, 0x00, 0x3c, 0x85,
+    0x42, 0x01, 0x20, 0x00, 0x83, 0x42, 0x01, 0x00, 0x1a, 0x85, 0x42, 0x01, 0x3e, 0x00,
+    0x82, 0x42, 0x05, 0x00, 0x01, 0x42, 0x42, 0x00, 0x00, 0x83, 0x42, 0x84, 0x42, 0x02,
+    0x05, 0x00, 0x38, 0x8d, 0x42, 0x00, 0x00, 0x83, 0x42, 0x00, 0x00, 0x8a, 0x42, 0x01,
+    0x1c, 0x00, 0x83, 0x42, 0x00, 0x00, 0x83, 0x42, 0x85, 0x42, 0x02, 0x00, 0x00, 0x3c,
+    0x8c, 0x42, 0x05, 0x00, 0x0f, 0x42, 0x42, 0x18, 0x00, 0x8a, 0x42, 0x01, 0x2d, 0x00,
+    0x83, 0x42, 0x00, 0x00, 0x83, 0x42, 0x86, 0x42, 0x02, 0x00, 0x00, 0x37, 0x8b, 0x42,
+    0x85, 0x00, 0x8b, 0x42, 0x05, 0x00, 0x00, 0x42, 0x42, 0x00, 0x00, 0x83, 0x42, 0x87,
+    0x42, 0x02, 0x00, 0x00, 0x03, 0x8b, 0x42, 0x83, 0x00, 0x8b, 0x42, 0x00, 0x06, 0x84,
+    0x00, 0x84, 0x42, 0x88, 0x42, 0x02, 0x04, 0x00, 0x00, 0x99, 0x42, 0x02, 0x00, 0x00,
+    0x04, 0x88, 0x42, 0x8a, 0x42, 0x02, 0x00, 0x00, 0x13, 0x95, 0x42, 0x03, 0x0d, 0x00,
+    0x00, 0x3f, 0x89, 0x42, 0x8b, 0x42, 0x82, 0x00, 0x00, 0x1a, 0x91, 0x42, 0x00, 0x14,
+    0x82, 0x00, 0x8b, 0x42, 0x8d, 0x42, 0x83, 0x00, 0x00, 0x33, 0x8b, 0x42, 0x00, 0x32,
+    0x83, 0x00, 0x8d, 0x42, 0x8f, 0x42, 0x00, 0x23, 0x8f, 0x00, 0x00, 0x2c, 0x8f, 0x42,
+    0x92, 0x42, 0x01, 0x41, 0x0a, 0x87, 0x00, 0x00, 0x0d, 0x93, 0x42,
+};
+// clang-format on
+
+constexpr bike_computer::CompressedImage gear_icon = {
+    .pPalette    = gear_icon_palette,
+    .pData       = gear_icon_data,
+    .imageWidth  = kGearIconWidth,
+    .imageHeight = kGearIconHeight};
@@ -0,0 +1,236 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file speedometer_icon_100_rle.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Speedometer icon (size 100) as palette indexed RLE data
+ *        (generated by tools/icon_converter.py from speedometer_icon_100.hpp)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "common/compressed_image.hpp"
+
+constexpr uint8_t kSpeedometerIconHeight = 100;
+constexpr uint8_t kSpeedometerIconWidth  = 100;
+
+// compressed size is 3047 (raw size is 40000)
+// clang-format off
+const uint32_t speedometer_icon_palette[] = {
+    0x000000ff, 0x010101ff, 0x020202ff, 0x030303ff, 0x040404ff, 0x050505ff, 0x060606ff,
+    0x070707ff, 0x080808ff, 0x090909ff, 0x0a0a0aff, 0x0b0b0bff, 0x0c0c0cff, 0x0d0d0dff,
+    0x0e0e0eff, 0x0f0f0fff, 0x101010ff, 0x111111ff, 0x121212ff, 0x131313ff, 0x151515ff,
+    0x171717ff, 0x181818ff, 0x191919ff, 0x1a1a1aff, 0x1b1b1bff, 0x1c1c1cff, 0x1d1d1dff,
+    0x1e1e1eff, 0x1f1f1fff, 0x202020ff, 0x212121ff, 0x222222ff, 0x232323ff, 0x242424ff,
+    0x252525ff, 0x262626ff, 0x272727ff, 0x282828ff, 0x292929ff, 0x2a2a2aff, 0x2c2c2cff,
+    0x303030ff, 0x313131ff, 0x323232ff, 0x353535ff, 0x383838ff, 0x3b3b3bff, 0x3c3c3cff,
+    0x3d3d3dff, 0x3e3e3eff, 0x3f3f3fff, 0x404040ff, 0x414141ff, 0x424242ff, 0x444444ff,
+    0x474747ff, 0x494949ff, 0x4a4a4aff, 0x4c4c4cff, 0x4d4d4dff, 0x4e4e4eff, 0x545454ff,
+    0x575757ff, 0x585858ff, 0x595959ff, 0x5a5a5aff, 0x5b5b5bff, 0x5c5c5cff, 0x5d5d5dff,
+    0x5e5e5eff, 0x5f5f5fff, 0x606060ff, 0x616161ff, 0x636363ff, 0x656565ff, 0x666666ff,
+    0x696969ff, 0x6d6d6dff, 0x6e6e6eff, 0x6f6f6fff, 0x707070ff, 0x717171ff, 0x727272ff,
+    0x737373ff, 0x757575ff, 0x777777ff, 0x787878ff, 0x797979ff, 0x7a7a7aff, 0x7b7b7bff,
+    0x7c7c7cff, 0x7d7d7dff, 0x7e7e7eff, 0x7f7f7fff, 0x808080ff, 0x828282ff, 0x838383ff,
+    0x858585ff, 0x878787ff, 0x898989ff, 0x8a8a8aff, 0x8b8b8bff, 0x8e8e8eff, 0x8f8f8fff,
+    0x909090ff, 0x929292ff, 0x949494ff, 0x959595ff, 0x969696ff, 0x979797ff, 0x989898ff,
+    0x999999ff, 0x9a9a9aff, 0x9b9b9bff, 0x9c9c9cff, 0x9d9d9dff, 0x9e9e9eff, 0x9f9f9fff,
+    0xa1a1a1ff, 0xa2a2a2ff, 0xa3a3a3ff, 0xa4a4a4ff, 0xa5a5a5ff, 0xa6a6a6ff, 0xa7a7a7ff,
+    0xa8a8a8ff, 0xa9a9a9ff, 0xaaaaaaff, 0xabababff, 0xacacacff, 0xaeaeaeff, 0xafafafff,
+    0xb0b0b0ff, 0xb1b1b1ff, 0xb2b2b2ff, 0xb3b3b3ff, 0xb4b4b4ff, 0xb5b5b5ff, 0xb6b6b6ff,
+    0xb7b7b7ff, 0xbababaff, 0xbbbbbbff, 0xbcbcbcff, 0xbdbdbdff, 0xbebebeff, 0xbfbfbfff,
+    0xc0c0c0ff, 0xc2c2c2ff, 0xc3c3c3ff, 0xc4c4c4ff, 0xc5c5c5ff, 0xc6c6c6ff, 0xc7c7c7ff,
+    0xc8c8c8ff, 0xc9c9c9ff, 0xcacacaff, 0xcbcbcbff, 0xccccccff, 0xcdcdcdff, 0xcfcfcfff,
+    0xd0d0d0ff, 0xd1d1d1ff, 0xd2d2d2ff, 0xd3d3d3ff, 0xd4d4d4ff, 0xd5d5d5ff, 0xd6d6d6ff,
+    0xd7d7d7ff, 0xd9d9d9ff, 0xdadadaff, 0xdbdbdbff, 0xdcdcdcff, 0xddddddff, 0xdededeff,
+    0xdfdfdfff, 0xe0e0e0ff, 0xe2e2e2ff, 0xe3e3e3ff, 0xe4e4e4ff, 0xe5e5e5ff, 0xe8e8e8ff,
+    0xe9e9e9ff, 0xebebebff, 0xecececff, 0xf1f1f1ff, 0xf2f2f2ff, 0xf3f3f3ff, 0xf4f4f4ff,
+    0xf5f5f5ff, 0xf6f6f6ff, 0xf7f7f7ff, 0xf8f8f8ff, 0xf9f9f9ff, 0xfafafaff, 0xfbfbfbff,
+    0xfcfcfcff, 0xfdfdfdff, 0xfefefeff, 0xffffffff,
+};
+
+const uint8_t speedometer_icon_data[] = {
+    0xe3, 0xc7, 0xe3, 0xc7, 0xe3, 0xc7, 0xe3, 0xc7, 0xe3, 0xc7, 0xe3, 0xc7, 0xe3, 0xc7,
+    0xe3, 0xc7, 0xa7, 0xc7, 0x13, 0xbf, 0x9e, 0x77, 0x56, 0x42, 0x31, 0x24, 0x14, 0x11,
+    0x00, 0x00, 0x10, 0x14, 0x24, 0x31, 0x42, 0x56, 0x78, 0x9f, 0xc0, 0xa7, 0xc7, 0xa3,
+    0xc7, 0x04, 0xc2, 0x8f, 0x57, 0x2f, 0x06, 0x91, 0x00, 0x04, 0x07, 0x30, 0x58, 0x90,
+    0xc3, 0xa3, 0xc7, 0xa0, 0xc7, 0x03, 0xc3, 0x87, 0x41, 0x10, 0x99, 0x00, 0x03, 0x11,
+    0x42, 0x89, 0xc4, 0xa0, 0xc7, 0x9e, 0xc7, 0x02, 0xb1, 0x56, 0x16, 0x9f, 0x00, 0x02,
+    0x17, 0x57, 0xb2, 0x9e, 0xc7, 0x9c, 0xc7, 0x02, 0xa3, 0x42, 0x05, 0x88, 0x00, 0x06,
+    0x13, 0x39, 0x5a, 0x6e, 0x87, 0x9d, 0xb4, 0x83, 0x00, 0x06, 0xb4, 0x9d, 0x87, 0x6e,
+    0x5a, 0x39, 0x13, 0x88, 0x00, 0x02, 0x05, 0x44, 0xa4, 0x9c, 0xc7, 0x9a, 0xc7, 0x02,
+    0xae, 0x45, 0x02, 0x86, 0x00, 0x03, 0x10, 0x46, 0x79, 0xaa, 0x86, 0xc7, 0x83, 0x00,
+    0x86, 0xc7, 0x03, 0xaa, 0x79, 0x46, 0x10, 0x86, 0x00, 0x02, 0x02, 0x46, 0xaf, 0x9a,
+    0xc7, 0x98, 0xc7, 0x02, 0xbe, 0x59, 0x07, 0x85, 0x00, 0x03, 0x10, 0x49, 0x8a, 0xc1,
+    0x89, 0xc7, 0x83, 0x00, 0x89, 0xc7, 0x03, 0xc1, 0x89, 0x48, 0x0f, 0x85, 0x00, 0x02,
+    0x07, 0x58, 0xbe, 0x98, 0xc7, 0x97, 0xc7, 0x01, 0x8e, 0x22, 0x85, 0x00, 0x02, 0x1e,
+    0x68, 0xba, 0x8c, 0xc7, 0x83, 0x00, 0x8c, 0xc7, 0x02, 0xba, 0x68, 0x1d, 0x85, 0x00,
+    0x01, 0x22, 0x90, 0x97, 0xc7, 0x95, 0xc7, 0x02, 0xc0, 0x50, 0x01, 0x84, 0x00, 0x02,
+    0x0f, 0x7d, 0xc3, 0x8e, 0xc7, 0x03, 0x1e, 0x00, 0x00, 0x1f, 0x8e, 0xc7, 0x02, 0xc3,
+    0x7d, 0x0f, 0x84, 0x00, 0x02, 0x01, 0x51, 0xc0, 0x95, 0xc7, 0x94, 0xc7, 0x01, 0xaa,
+    0x2a, 0x86, 0x00, 0x01, 0x01, 0x94, 0x8f, 0xc7, 0x03, 0x8b, 0x1a, 0x1a, 0x8c, 0x8f,
+    0xc7, 0x01, 0x94, 0x01, 0x86, 0x00, 0x01, 0x2b, 0xab, 0x94, 0xc7, 0x93, 0xc7, 0x01,
+    0x8e, 0x11, 0x83, 0x00, 0x01, 0x02, 0x16, 0x82, 0x00, 0x01, 0x2c, 0xc5, 0xa1, 0xc7,
+    0x01, 0xc5, 0x2c, 0x82, 0x00, 0x01, 0x16, 0x02, 0x83, 0x00, 0x01, 0x12, 0x8f, 0x93,
+    0xc7, 0x92, 0xc7, 0x01, 0x6f, 0x04, 0x83, 0x00, 0x03, 0x18, 0x8f, 0x97, 0x01, 0x82,
+    0x00, 0x00, 0x73, 0xa1, 0xc7, 0x00, 0x73, 0x82, 0x00, 0x03, 0x01, 0x97, 0x8f, 0x18,
+    0x83, 0x00, 0x01, 0x04, 0x70, 0x92, 0xc7, 0x91, 0xc7, 0x00, 0x63, 0x84, 0x00, 0x04,
+    0x3c, 0xb7, 0xc7, 0xc7, 0x42, 0x82, 0x00, 0x00, 0x24, 0xa1, 0xc7, 0x00, 0x23, 0x82,
+    0x00, 0x04, 0x42, 0xc7, 0xc7, 0xb7, 0x3c, 0x83, 0x00, 0x01, 0x01, 0x64, 0x91, 0xc7,
+    0x90, 0xc7, 0x00, 0x5a, 0x83, 0x00, 0x02, 0x01, 0x65, 0xc6, 0x82, 0xc7, 0x05, 0xb2,
+    0x0a, 0x00, 0x00, 0x11, 0xc6, 0x9f, 0xc7, 0x05, 0xc5, 0x11, 0x00, 0x00, 0x0a, 0xb2,
+    0x82, 0xc7, 0x02, 0xc6, 0x65, 0x01, 0x83, 0x00, 0x00, 0x5c, 0x90, 0xc7, 0x8f, 0xc7,
+    0x00, 0x63, 0x83, 0x00, 0x01, 0x06, 0x7b, 0x85, 0xc7, 0x03, 0x7b, 0x08, 0x05, 0x6c,
+    0xa1, 0xc7, 0x03, 0x6b, 0x05, 0x08, 0x7c, 0x85, 0xc7, 0x01, 0x7b, 0x06, 0x83, 0x00,
+    0x00, 0x64, 0x8f, 0xc7, 0x8e, 0xc7, 0x00, 0x6f, 0x83, 0x00, 0x01, 0x0d, 0x8e, 0x87,
+    0xc7, 0x01, 0xbd, 0xbb, 0xa3, 0xc7, 0x01, 0xbb, 0xbd, 0x87, 0xc7, 0x01, 0x8e, 0x0d,
+    0x82, 0x00, 0x01, 0x01, 0x71, 0x8e, 0xc7, 0x8d, 0xc7, 0x01, 0x8e, 0x04, 0x82, 0x00,
+    0x01, 0x0e, 0x9d, 0xb9, 0xc7, 0x01, 0x9d, 0x0d, 0x82, 0x00, 0x01, 0x05, 0x90, 0x8d,
+    0xc7, 0x8c, 0xc7, 0x01, 0xaa, 0x11, 0x82, 0x00, 0x01, 0x06, 0x8f, 0xbb, 0xc7, 0x01,
+    0x8d, 0x06, 0x82, 0x00, 0x01, 0x13, 0xac, 0x8c, 0xc7, 0x8b, 0xc7, 0x01, 0xc0, 0x2b,
+    0x82, 0x00, 0x01, 0x01, 0x77, 0xbd, 0xc7, 0x01, 0x7d, 0x02, 0x82, 0x00, 0x01, 0x2c,
+    0xc1, 0x8b, 0xc7, 0x8b, 0xc7, 0x00, 0x50, 0x83, 0x00, 0x00, 0x66, 0xbf, 0xc7, 0x00,
+    0x65, 0x83, 0x00, 0x00, 0x53, 0x8b, 0xc7, 0x8a, 0xc7, 0x01, 0x8f, 0x01, 0x82, 0x00,
+    0x01, 0x3d, 0xc6, 0xbf, 0xc7, 0x01, 0xc6, 0x3c, 0x82, 0x00, 0x01, 0x01, 0x91, 0x8a,
+    0xc7, 0x89, 0xc7, 0x01, 0xc0, 0x25, 0x82, 0x00, 0x01, 0x18, 0xb7, 0xc1, 0xc7, 0x01,
+    0xb7, 0x18, 0x82, 0x00, 0x01, 0x23, 0xbe, 0x89, 0xc7, 0x89, 0xc7, 0x00, 0x59, 0x82,
+    0x00, 0x01, 0x02, 0x8f, 0xc3, 0xc7, 0x01, 0x8e, 0x02, 0x82, 0x00, 0x00, 0x59, 0x89,
+    0xc7, 0x88, 0xc7, 0x01, 0xae, 0x07, 0x82, 0x00, 0x01, 0x16, 0x97, 0xc3, 0xc7, 0x01,
+    0x97, 0x16, 0x82, 0x00, 0x01, 0x07, 0xae, 0x88, 0xc7, 0x88, 0xc7, 0x00, 0x45, 0x85,
+    0x00, 0x01, 0x3b, 0xaf, 0xbf, 0xc7, 0x02, 0xb3, 0x45, 0x01, 0x84, 0x00, 0x00, 0x46,
+    0x88, 0xc7, 0x87, 0xc7, 0x01, 0xa4, 0x02, 0x86, 0x00, 0x01, 0x0a, 0x7b, 0xbd, 0xc7,
+    0x01, 0x7b, 0x0a, 0x86, 0x00, 0x01, 0x03, 0xa5, 0x87, 0xc7, 0x87, 0xc7, 0x00, 0x43,
+    0x82, 0x00, 0x01, 0x0f, 0x01, 0x83, 0x00, 0x01, 0x08, 0xbd, 0xbb, 0xc7, 0x01, 0xbc,
+    0x08, 0x83, 0x00, 0x01, 0x01, 0x0f, 0x82, 0x00, 0x00, 0x45, 0x87, 0xc7, 0x86, 0xc7,
+    0x01, 0xb3, 0x05, 0x82, 0x00, 0x02, 0x7e, 0x9b, 0x2e, 0x82, 0x00, 0x01, 0x04, 0xb9,
+    0xbb, 0xc7, 0x01, 0xba, 0x05, 0x82, 0x00, 0x02, 0x2b, 0x94, 0x7d, 0x82, 0x00, 0x01,
+    0x05, 0xb1, 0x86, 0xc7, 0x86, 0xc7, 0x00, 0x57, 0x82, 0x00, 0x07, 0x1e, 0xc3, 0xc7,
+    0xc5, 0x72, 0x23, 0x11, 0x6c, 0xbd, 0xc7, 0x07, 0x6b, 0x11, 0x24, 0x72, 0xc5, 0xc7,
+    0xc3, 0x1d, 0x82, 0x00, 0x00, 0x58, 0x86, 0xc7, 0x85, 0xc7, 0x01, 0xc3, 0x17, 0x82,
+    0x00, 0x00, 0x68, 0xbe, 0xc7, 0x02, 0xc1, 0x83, 0x5f, 0x89, 0xc7, 0x00, 0x67, 0x82,
+    0x00, 0x01, 0x18, 0xc4, 0x85, 0xc7, 0x85, 0xc7, 0x00, 0x88, 0x82, 0x00, 0x01, 0x10,
+    0xba, 0xbc, 0xc7, 0x04, 0xa2, 0x51, 0x14, 0x02, 0x68, 0x89, 0xc7, 0x01, 0xba, 0x0f,
+    0x82, 0x00, 0x00, 0x8b, 0x85, 0xc7, 0x85, 0xc7, 0x00, 0x42, 0x82, 0x00, 0x00, 0x49,
+    0xba, 0xc7, 0x06, 0xb8, 0x6a, 0x2c, 0x00, 0x00, 0x08, 0x82, 0x8b, 0xc7, 0x00, 0x47,
+    0x82, 0x00, 0x00, 0x44, 0x85, 0xc7, 0x84, 0xc7, 0x01, 0xc2, 0x11, 0x82, 0x00, 0x00,
+    0x8b, 0xb7, 0xc7, 0x03, 0xc5, 0x8e, 0x45, 0x09, 0x82, 0x00, 0x01, 0x12, 0x94, 0x8c,
+    0xc7, 0x00, 0x88, 0x82, 0x00, 0x01, 0x10, 0xc2, 0x84, 0xc7, 0x84, 0xc7, 0x00, 0x90,
+    0x82, 0x00, 0x01, 0x10, 0xc1, 0xb5, 0xc7, 0x02, 0xa8, 0x56, 0x18, 0x84, 0x00, 0x01,
+    0x20, 0xa9, 0x8d, 0xc7, 0x01, 0xc0, 0x0f, 0x82, 0x00, 0x00, 0x91, 0x84, 0xc7, 0x84,
+    0xc7, 0x00, 0x57, 0x82, 0x00, 0x00, 0x47, 0xb3, 0xc7, 0x03, 0xb9, 0x77, 0x37, 0x01,
+    0x85, 0x00, 0x01, 0x2d, 0xb5, 0x8f, 0xc7, 0x00, 0x45, 0x82, 0x00, 0x00, 0x59, 0x84,
+    0xc7, 0x84, 0xc7, 0x00, 0x2f, 0x82, 0x00, 0x00, 0x7b, 0xb0, 0xc7, 0x03, 0xc5, 0x95,
+    0x4c, 0x0b, 0x87, 0x00, 0x01, 0x38, 0xba, 0x90, 0xc7, 0x00, 0x79, 0x82, 0x00, 0x00,
+    0x32, 0x84, 0xc7, 0x83, 0xc7, 0x01, 0xbf, 0x07, 0x82, 0x00, 0x00, 0xaa, 0xa2, 0xc7,
+    0x0e, 0xc2, 0x81, 0x42, 0x26, 0x0b, 0x09, 0x1f, 0x40, 0x81, 0xc1, 0xc7, 0xc7, 0xad,
+    0x5d, 0x1d, 0x89, 0x00, 0x01, 0x4d, 0xc4, 0x91, 0xc7, 0x00, 0xa9, 0x82, 0x00, 0x01,
+    0x08, 0xc0, 0x83, 0xc7, 0x83, 0xc7, 0x00, 0x9f, 0x82, 0x00, 0x01, 0x13, 0xc6, 0xa1,
+    0xc7, 0x01, 0x84, 0x22, 0x87, 0x00, 0x03, 0x21, 0x63, 0x33, 0x01, 0x89, 0x00, 0x01,
+    0x01, 0x63, 0x93, 0xc7, 0x01, 0xc6, 0x12, 0x82, 0x00, 0x00, 0xa1, 0x83, 0xc7, 0x83,
+    0xc7, 0x00, 0x77, 0x82, 0x00, 0x00, 0x39, 0xa0, 0xc7, 0x01, 0xc5, 0x56, 0x96, 0x00,
+    0x01, 0x07, 0x7b, 0x95, 0xc7, 0x00, 0x38, 0x82, 0x00, 0x00, 0x7a, 0x83, 0xc7, 0x83,
+    0xc7, 0x00, 0x56, 0x82, 0x00, 0x00, 0x5a, 0xa0, 0xc7, 0x00, 0x56, 0x96, 0x00, 0x01,
+    0x10, 0x92, 0x96, 0xc7, 0x00, 0x58, 0x82, 0x00, 0x00, 0x58, 0x83, 0xc7, 0x83, 0xc7,
+    0x00, 0x40, 0x82, 0x00, 0x00, 0x6e, 0x9f, 0xc7, 0x00, 0x84, 0x83, 0x00, 0x07, 0x08,
+    0x52, 0x9b, 0xbc, 0xbc, 0x9b, 0x51, 0x08, 0x8a, 0x00, 0x01, 0x1c, 0xa5, 0x97, 0xc7,
+    0x00, 0x6d, 0x82, 0x00, 0x00, 0x43, 0x83, 0xc7, 0x83, 0xc7, 0x00, 0x31, 0x82, 0x00,
+    0x00, 0x86, 0x9e, 0xc7, 0x01, 0xc2, 0x22, 0x82, 0x00, 0x01, 0x1c, 0xa5, 0x85, 0xc7,
+    0x01, 0xa4, 0x1c, 0x88, 0x00, 0x01, 0x2a, 0xb4, 0x98, 0xc7, 0x00, 0x85, 0x82, 0x00,
+    0x00, 0x34, 0x83, 0xc7, 0x83, 0xc7, 0x00, 0x22, 0x82, 0x00, 0x00, 0x9d, 0x9e, 0xc7,
+    0x00, 0x80, 0x82, 0x00, 0x01, 0x08, 0xa4, 0x87, 0xc7, 0x01, 0xa4, 0x08, 0x86, 0x00,
+    0x01, 0x38, 0xba, 0x99, 0xc7, 0x00, 0x9d, 0x82, 0x00, 0x00, 0x24, 0x83, 0xc7, 0x83,
+    0xc7, 0x00, 0x15, 0x82, 0x00, 0x00, 0xb4, 0x9e, 0xc7, 0x00, 0x42, 0x82, 0x00, 0x00,
+    0x51, 0x89, 0xc7, 0x00, 0x50, 0x85, 0x00, 0x01, 0x49, 0xc2, 0x9a, 0xc7, 0x00, 0xb4,
+    0x82, 0x00, 0x00, 0x17, 0x83, 0xc7, 0x83, 0xc7, 0x00, 0x0d, 0x86, 0x00, 0x01, 0x1e,
+    0x8b, 0x99, 0xc7, 0x00, 0x24, 0x82, 0x00, 0x00, 0x9c, 0x89, 0xc7, 0x00, 0x9a, 0x83,
+    0x00, 0x02, 0x01, 0x5f, 0xc6, 0x96, 0xc7, 0x01, 0x8a, 0x1e, 0x86, 0x00, 0x00, 0x0e,
+    0x83, 0xc7, 0x83, 0xc7, 0x00, 0x04, 0x87, 0x00, 0x00, 0x1a, 0x99, 0xc7, 0x00, 0x0d,
+    0x82, 0x00, 0x00, 0xbb, 0x89, 0xc7, 0x00, 0xba, 0x83, 0x00, 0x00, 0x75, 0x98, 0xc7,
+    0x00, 0x19, 0x87, 0x00, 0x00, 0x04, 0x83, 0xc7, 0x83, 0xc7, 0x00, 0x06, 0x87, 0x00,
+    0x00, 0x1a, 0x99, 0xc7, 0x00, 0x0d, 0x82, 0x00, 0x00, 0xbb, 0x89, 0xc7, 0x00, 0xba,
+    0x82, 0x00, 0x00, 0x0d, 0x99, 0xc7, 0x00, 0x1a, 0x87, 0x00, 0x00, 0x06, 0x83, 0xc7,
+    0x83, 0xc7, 0x00, 0x11, 0x86, 0x00, 0x01, 0x1f, 0x8c, 0x99, 0xc7, 0x00, 0x24, 0x82,
+    0x00, 0x00, 0x9b, 0x89, 0xc7, 0x00, 0x99, 0x82, 0x00, 0x00, 0x25, 0x99, 0xc7, 0x01,
+    0x8b, 0x1f, 0x86, 0x00, 0x00, 0x12, 0x83, 0xc7, 0x83, 0xc7, 0x00, 0x1b, 0x82, 0x00,
+    0x00, 0xad, 0x9e, 0xc7, 0x00, 0x42, 0x82, 0x00, 0x00, 0x50, 0x89, 0xc7, 0x00, 0x4e,
+    0x82, 0x00, 0x00, 0x44, 0x9e, 0xc7, 0x00, 0xad, 0x82, 0x00, 0x00, 0x1d, 0x83, 0xc7,
+    0x83, 0xc7, 0x00, 0x27, 0x82, 0x00, 0x00, 0x96, 0x9e, 0xc7, 0x00, 0x80, 0x82, 0x00,
+    0x01, 0x08, 0xa3, 0x87, 0xc7, 0x01, 0xa1, 0x07, 0x82, 0x00, 0x00, 0x82, 0x9e, 0xc7,
+    0x00, 0x95, 0x82, 0x00, 0x00, 0x29, 0x83, 0xc7, 0x83, 0xc7, 0x00, 0x32, 0x82, 0x00,
+    0x00, 0x80, 0x9e, 0xc7, 0x01, 0xc2, 0x23, 0x82, 0x00, 0x01, 0x1c, 0xa3, 0x85, 0xc7,
+    0x01, 0xa2, 0x1b, 0x82, 0x00, 0x01, 0x24, 0xc2, 0x9e, 0xc7, 0x00, 0x7f, 0x82, 0x00,
+    0x00, 0x34, 0x83, 0xc7, 0x83, 0xc7, 0x00, 0x46, 0x82, 0x00, 0x00, 0x69, 0x9f, 0xc7,
+    0x01, 0x85, 0x01, 0x82, 0x00, 0x07, 0x07, 0x4f, 0x99, 0xbb, 0xbb, 0x99, 0x4e, 0x07,
+    0x82, 0x00, 0x01, 0x01, 0x87, 0x9f, 0xc7, 0x00, 0x68, 0x82, 0x00, 0x00, 0x49, 0x83,
+    0xc7, 0x83, 0xc7, 0x00, 0x5e, 0x82, 0x00, 0x00, 0x55, 0xa0, 0xc7, 0x00, 0x57, 0x8d,
+    0x00, 0x00, 0x59, 0xa0, 0xc7, 0x00, 0x54, 0x82, 0x00, 0x00, 0x60, 0x83, 0xc7, 0x83,
+    0xc7, 0x00, 0x77, 0x82, 0x00, 0x00, 0x37, 0xa0, 0xc7, 0x02, 0xc5, 0x58, 0x01, 0x89,
+    0x00, 0x02, 0x01, 0x59, 0xc5, 0xa0, 0xc7, 0x00, 0x36, 0x82, 0x00, 0x00, 0x79, 0x83,
+    0xc7, 0x83, 0xc7, 0x00, 0xa1, 0x82, 0x00, 0x01, 0x0f, 0xc5, 0xa1, 0xc7, 0x01, 0x86,
+    0x23, 0x87, 0x00, 0x01, 0x24, 0x87, 0xa1, 0xc7, 0x01, 0xc5, 0x0e, 0x82, 0x00, 0x00,
+    0xa4, 0x83, 0xc7, 0x83, 0xc7, 0x01, 0xc3, 0x0a, 0x82, 0x00, 0x00, 0xa7, 0xa2, 0xc7,
+    0x09, 0xc2, 0x82, 0x44, 0x27, 0x0c, 0x0c, 0x27, 0x45, 0x82, 0xc2, 0xa2, 0xc7, 0x00,
+    0xa5, 0x82, 0x00, 0x01, 0x0d, 0xc4, 0x83, 0xc7, 0x84, 0xc7, 0x00, 0x30, 0x82, 0x00,
+    0x00, 0x76, 0xcf, 0xc7, 0x00, 0x74, 0x82, 0x00, 0x00, 0x35, 0x84, 0xc7, 0x84, 0xc7,
+    0x00, 0x56, 0x82, 0x00, 0x00, 0x45, 0xcf, 0xc7, 0x00, 0x44, 0x82, 0x00, 0x00, 0x5a,
+    0x84, 0xc7, 0x84, 0xc7, 0x00, 0x94, 0x82, 0x00, 0x01, 0x0e, 0xbf, 0xcd, 0xc7, 0x01,
+    0xc0, 0x0f, 0x82, 0x00, 0x00, 0x98, 0x84, 0xc7, 0x84, 0xc7, 0x01, 0xc4, 0x13, 0x82,
+    0x00, 0x00, 0x89, 0xcd, 0xc7, 0x00, 0x86, 0x82, 0x00, 0x01, 0x12, 0xc4, 0x84, 0xc7,
+    0x85, 0xc7, 0x00, 0x42, 0x82, 0x00, 0x00, 0x48, 0xcd, 0xc7, 0x00, 0x46, 0x82, 0x00,
+    0x00, 0x44, 0x85, 0xc7, 0x85, 0xc7, 0x00, 0x8b, 0x82, 0x00, 0x01, 0x10, 0xbc, 0xcb,
+    0xc7, 0x01, 0xbb, 0x0f, 0x82, 0x00, 0x00, 0x8c, 0x85, 0xc7, 0x85, 0xc7, 0x01, 0xc5,
+    0x1b, 0x82, 0x00, 0x00, 0x6a, 0xcb, 0xc7, 0x00, 0x68, 0x82, 0x00, 0x01, 0x1a, 0xc4,
+    0x85, 0xc7, 0x86, 0xc7, 0x00, 0x58, 0x82, 0x00, 0x07, 0x1f, 0xc3, 0xc7, 0xc7, 0x9c,
+    0x37, 0x18, 0x62, 0xbd, 0xc7, 0x07, 0x61, 0x19, 0x3a, 0x9c, 0xc7, 0xc7, 0xc3, 0x1e,
+    0x82, 0x00, 0x00, 0x5b, 0x86, 0xc7, 0x86, 0xc7, 0x01, 0xb0, 0x05, 0x82, 0x00, 0x03,
+    0x7e, 0xb6, 0x4a, 0x02, 0x82, 0x00, 0x00, 0xa2, 0xbb, 0xc7, 0x00, 0xa0, 0x82, 0x00,
+    0x03, 0x02, 0x4a, 0xb6, 0x7e, 0x82, 0x00, 0x01, 0x06, 0xb1, 0x86, 0xc7, 0x87, 0xc7,
+    0x00, 0x46, 0x82, 0x00, 0x01, 0x1d, 0x10, 0x84, 0x00, 0x00, 0x9b, 0xbb, 0xc7, 0x00,
+    0x99, 0x84, 0x00, 0x01, 0x10, 0x1d, 0x82, 0x00, 0x00, 0x49, 0x87, 0xc7, 0x87, 0xc7,
+    0x01, 0xa6, 0x02, 0x87, 0x00, 0x00, 0x4b, 0xbc, 0xc7, 0x01, 0xc6, 0x4a, 0x87, 0x00,
+    0x01, 0x02, 0xa8, 0x87, 0xc7, 0x88, 0xc7, 0x00, 0x3f, 0x85, 0x00, 0x01, 0x28, 0x8e,
+    0xbf, 0xc7, 0x01, 0x8e, 0x28, 0x85, 0x00, 0x00, 0x42, 0x88, 0xc7, 0x88, 0xc7, 0x01,
+    0xb0, 0x09, 0x82, 0x00, 0x02, 0x09, 0x68, 0xc2, 0xc1, 0xc7, 0x02, 0xc2, 0x68, 0x09,
+    0x82, 0x00, 0x01, 0x0a, 0xb1, 0x88, 0xc7, 0x89, 0xc7, 0x00, 0x5a, 0x82, 0x00, 0x01,
+    0x02, 0x93, 0xc3, 0xc7, 0x01, 0x97, 0x03, 0x82, 0x00, 0x00, 0x5e, 0x89, 0xc7, 0x89,
+    0xc7, 0x01, 0xbb, 0x1f, 0x82, 0x00, 0x01, 0x21, 0xbd, 0xc1, 0xc7, 0x01, 0xbd, 0x21,
+    0x82, 0x00, 0x01, 0x20, 0xbc, 0x89, 0xc7, 0x8a, 0xc7, 0x01, 0x92, 0x02, 0x82, 0x00,
+    0x00, 0x73, 0xc1, 0xc7, 0x00, 0x71, 0x82, 0x00, 0x01, 0x02, 0x93, 0x8a, 0xc7, 0x8b,
+    0xc7, 0x00, 0x4f, 0x82, 0x00, 0x00, 0x72, 0x8a, 0xc7, 0x01, 0x89, 0x19, 0xa7, 0x00,
+    0x01, 0x1a, 0x8a, 0x8a, 0xc7, 0x00, 0x70, 0x82, 0x00, 0x00, 0x50, 0x8b, 0xc7, 0x8b,
+    0xc7, 0x04, 0xbe, 0x3f, 0x0e, 0x3e, 0xbf, 0x8a, 0xc7, 0x00, 0x19, 0xa9, 0x00, 0x00,
+    0x1a, 0x8a, 0xc7, 0x04, 0xbe, 0x3e, 0x0e, 0x40, 0xbe, 0x8b, 0xc7, 0x9a, 0xc7, 0x00,
+    0xc6, 0xab, 0x00, 0x00, 0xc6, 0x9a, 0xc7, 0x9a, 0xc7, 0x00, 0xc6, 0xab, 0x00, 0x00,
+    0xc6, 0x9a, 0xc7, 0x9a, 0xc7, 0x00, 0xc6, 0x82, 0x00, 0x00, 0x01, 0xa3, 0xc7, 0x00,
+    0x01, 0x82, 0x00, 0x00, 0xc6, 0x9a, 0xc7, 0x9a, 0xc7, 0x00, 0xc6, 0x82, 0x00, 0x00,
+    0x01, 0xa3, 0xc7, 0x00, 0x01, 0x82, 0x00, 0x00, 0xc6, 0x9a, 0xc7, 0x9a, 0xc7, 0x00,
+    0xc6, 0x82, 0x00, 0x00, 0x01, 0xa3, 0xc7, 0x00, 0x01, 0x82, 0x00, 0x00, 0xc6, 0x9a,
+    0xc7, 0x9a, 0xc7, 0x00, 0xc6, 0x82, 0x00, 0x00, 0x01, 0xa3, 0xc7, 0x00, 0x01, 0x82,
+    0x00, 0x00, 0xc6, 0x9a, 0xc7, 0x9a, 0xc7, 0x00, 0xc6, 0xab, 0x00, 0x00, 0xc6, 0x9a,
+    0xc7, 0x9a, 0xc7, 0x00, 0xc6, 0xab, 0x00, 0x00, 0xc6, 0x9a, 0xc7, 0x9b, 0xc7, 0x00,
+    0x19, 0xa9, 0x00, 0x00, 0x1b, 0x9b, 0xc7, 0x9b, 0xc7, 0x01, 0x8b, 0x1b, 0xa7, 0x00,
+    0x01, 0x1c, 0x8c, 0x9b, 0xc7, 0xe3, 0xc7, 0xe3, 0xc7, 0xe3, 0xc7, 0xe3, 0xc7, 0xe3,
+    0xc7, 0xe3, 0xc7, 0xe3, 0xc7, 0xe3, 0xc7,
+};
+// clang-format on
+
+constexpr bike_computer::CompressedImage speedometer_icon = {
+    .pPalette    = speedometer_icon_palette,
+    .pData       = speedometer_icon_data,
+    .imageWidth  = kSpeedometerIconWidth,
+    .imageHeight = kSpeedometerIconHeight};
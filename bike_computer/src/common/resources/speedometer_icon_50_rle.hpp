@@ -0,0 +1,110 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file speedometer_icon_50_rle.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Speedometer icon (size 50) as palette indexed RLE data
+ *        (generated by tools/icon_converter.py from speedometer_icon_50.hpp)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "common/compressed_image.hpp"
+
+constexpr uint8_t kSpeedometerIconHeight = 50;
+constexpr uint8_t kSpeedometerIconWidth  = 50;
+
+// compressed size is 1035 (raw size is 10000)
+// clang-format off
+const uint32_t speedometer_icon_palette[] = {
+    0x000000ff, 0x010101ff, 0x020202ff, 0x030303ff, 0x040404ff, 0x060606ff, 0x070707ff,
+    0x080808ff, 0x090909ff, 0x0b0b0bff, 0x0d0d0dff, 0x0f0f0fff, 0x101010ff, 0x111111ff,
+    0x131313ff, 0x141414ff, 0x151515ff, 0x181818ff, 0x212121ff, 0x252525ff, 0x262626ff,
+    0x272727ff, 0x2d2d2dff, 0x2e2e2eff, 0x444444ff, 0x4e4e4eff, 0x575757ff, 0x595959ff,
+    0x606060ff, 0x626262ff, 0x636363ff, 0x686868ff, 0x707070ff, 0x727272ff, 0x787878ff,
+    0x7c7c7cff, 0x7d7d7dff, 0x808080ff, 0x838383ff, 0x888888ff, 0x8b8b8bff, 0x8c8c8cff,
+    0x8d8d8dff, 0x8e8e8eff, 0x8f8f8fff, 0x9a9a9aff, 0x9f9f9fff, 0xa1a1a1ff, 0xa8a8a8ff,
+    0xacacacff, 0xb1b1b1ff, 0xb2b2b2ff, 0xb8b8b8ff, 0xb9b9b9ff, 0xbbbbbbff, 0xbdbdbdff,
+    0xcfcfcfff, 0xd0d0d0ff, 0xd9d9d9ff, 0xdbdbdbff, 0xdfdfdfff, 0xe3e3e3ff, 0xf1f1f1ff,
+    0xf2f2f2ff, 0xfafafaff, 0xfbfbfbff, 0xfcfcfcff, 0xfdfdfdff, 0xfefefeff, 0xffffffff,
+};
+
+const uint8_t speedometer_icon_data[] = {
+    0xb1, 0x45, 0xb1, 0x45, 0xb1, 0x45, 0xb1, 0x45, 0xb1, 0x45, 0x93, 0x45, 0x01, 0x37,
+    0x01, 0x85, 0x00, 0x01, 0x01, 0x36, 0x93, 0x45, 0x90, 0x45, 0x8f, 0x00, 0x90, 0x45,
+    0x8d, 0x45, 0x00, 0x10, 0x93, 0x00, 0x00, 0x0c, 0x8d, 0x45, 0x8b, 0x45, 0x00, 0x1d,
+    0x86, 0x00, 0x00, 0x1c, 0x87, 0x45, 0x00, 0x1d, 0x86, 0x00, 0x00, 0x1b, 0x8b, 0x45,
+    0x8a, 0x45, 0x85, 0x00, 0x00, 0x40, 0x8d, 0x45, 0x00, 0x41, 0x85, 0x00, 0x8a, 0x45,
+    0x88, 0x45, 0x00, 0x2f, 0x84, 0x00, 0x93, 0x45, 0x84, 0x00, 0x00, 0x2d, 0x88, 0x45,
+    0x87, 0x45, 0x84, 0x00, 0x89, 0x45, 0x03, 0x3c, 0x00, 0x00, 0x38, 0x89, 0x45, 0x84,
+    0x00, 0x87, 0x45, 0x86, 0x45, 0x84, 0x00, 0x8a, 0x45, 0x03, 0x3c, 0x00, 0x00, 0x38,
+    0x8a, 0x45, 0x84, 0x00, 0x86, 0x45, 0x85, 0x45, 0x83, 0x00, 0x00, 0x21, 0x83, 0x45,
+    0x01, 0x2b, 0x00, 0x85, 0x45, 0x03, 0x3c, 0x00, 0x00, 0x38, 0x85, 0x45, 0x01, 0x00,
+    0x29, 0x83, 0x45, 0x00, 0x22, 0x83, 0x00, 0x85, 0x45, 0x84, 0x45, 0x00, 0x1e, 0x82,
+    0x00, 0x00, 0x39, 0x83, 0x45, 0x83, 0x00, 0x84, 0x45, 0x03, 0x3c, 0x00, 0x00, 0x38,
+    0x84, 0x45, 0x83, 0x00, 0x83, 0x45, 0x00, 0x3a, 0x82, 0x00, 0x00, 0x1a, 0x84, 0x45,
+    0x84, 0x45, 0x82, 0x00, 0x00, 0x25, 0x85, 0x45, 0x82, 0x00, 0x84, 0x45, 0x03, 0x3c,
+    0x00, 0x00, 0x38, 0x84, 0x45, 0x82, 0x00, 0x85, 0x45, 0x00, 0x28, 0x82, 0x00, 0x84,
+    0x45, 0x83, 0x45, 0x82, 0x00, 0x00, 0x02, 0x86, 0x45, 0x00, 0x15, 0x82, 0x00, 0x83,
+    0x45, 0x03, 0x3c, 0x00, 0x00, 0x38, 0x83, 0x45, 0x82, 0x00, 0x00, 0x15, 0x86, 0x45,
+    0x00, 0x03, 0x82, 0x00, 0x83, 0x45, 0x82, 0x45, 0x00, 0x10, 0x82, 0x00, 0x88, 0x45,
+    0x82, 0x00, 0x00, 0x43, 0x89, 0x45, 0x00, 0x42, 0x82, 0x00, 0x88, 0x45, 0x82, 0x00,
+    0x00, 0x0e, 0x82, 0x45, 0x82, 0x45, 0x82, 0x00, 0x89, 0x45, 0x02, 0x3e, 0x00, 0x13,
+    0x8b, 0x45, 0x02, 0x13, 0x00, 0x3e, 0x89, 0x45, 0x82, 0x00, 0x82, 0x45, 0x01, 0x45,
+    0x45, 0x83, 0x00, 0x82, 0x45, 0x00, 0x23, 0x9d, 0x45, 0x00, 0x24, 0x82, 0x45, 0x83,
+    0x00, 0x01, 0x45, 0x45, 0x01, 0x45, 0x45, 0x82, 0x00, 0x82, 0x45, 0x02, 0x19, 0x00,
+    0x00, 0x9a, 0x45, 0x03, 0x44, 0x00, 0x00, 0x18, 0x82, 0x45, 0x82, 0x00, 0x01, 0x45,
+    0x45, 0x01, 0x45, 0x33, 0x82, 0x00, 0x82, 0x45, 0x84, 0x00, 0x97, 0x45, 0x84, 0x00,
+    0x82, 0x45, 0x82, 0x00, 0x01, 0x31, 0x45, 0x00, 0x45, 0x82, 0x00, 0x84, 0x45, 0x84,
+    0x00, 0x94, 0x45, 0x00, 0x04, 0x84, 0x00, 0x84, 0x45, 0x82, 0x00, 0x00, 0x45, 0x00,
+    0x45, 0x82, 0x00, 0x85, 0x45, 0x03, 0x3d, 0x00, 0x00, 0x2c, 0x92, 0x45, 0x00, 0x37,
+    0x84, 0x00, 0x00, 0x3b, 0x85, 0x45, 0x82, 0x00, 0x00, 0x45, 0x00, 0x45, 0x82, 0x00,
+    0x87, 0x45, 0x00, 0x0e, 0x92, 0x45, 0x84, 0x00, 0x00, 0x0b, 0x87, 0x45, 0x82, 0x00,
+    0x00, 0x45, 0x03, 0x16, 0x00, 0x00, 0x3e, 0x99, 0x45, 0x85, 0x00, 0x89, 0x45, 0x03,
+    0x3f, 0x00, 0x00, 0x14, 0x82, 0x00, 0x92, 0x45, 0x00, 0x2e, 0x83, 0x00, 0x01, 0x35,
+    0x11, 0x84, 0x00, 0x00, 0x43, 0x8b, 0x45, 0x82, 0x00, 0x82, 0x00, 0x91, 0x45, 0x00,
+    0x23, 0x89, 0x00, 0x00, 0x26, 0x8d, 0x45, 0x82, 0x00, 0x82, 0x00, 0x91, 0x45, 0x89,
+    0x00, 0x8f, 0x45, 0x82, 0x00, 0x82, 0x00, 0x82, 0x45, 0x85, 0x00, 0x88, 0x45, 0x82,
+    0x00, 0x01, 0x45, 0x45, 0x82, 0x00, 0x88, 0x45, 0x85, 0x00, 0x82, 0x45, 0x82, 0x00,
+    0x82, 0x00, 0x82, 0x45, 0x85, 0x00, 0x88, 0x45, 0x07, 0x00, 0x00, 0x0a, 0x45, 0x45,
+    0x0f, 0x00, 0x00, 0x88, 0x45, 0x85, 0x00, 0x82, 0x45, 0x82, 0x00, 0x82, 0x00, 0x82,
+    0x45, 0x85, 0x00, 0x88, 0x45, 0x82, 0x00, 0x01, 0x27, 0x2a, 0x82, 0x00, 0x88, 0x45,
+    0x85, 0x00, 0x82, 0x45, 0x82, 0x00, 0x82, 0x00, 0x91, 0x45, 0x87, 0x00, 0x91, 0x45,
+    0x82, 0x00, 0x82, 0x00, 0x92, 0x45, 0x85, 0x00, 0x92, 0x45, 0x82, 0x00, 0x02, 0x08,
+    0x00, 0x00, 0x94, 0x45, 0x01, 0x37, 0x37, 0x94, 0x45, 0x02, 0x00, 0x00, 0x07, 0x03,
+    0x42, 0x00, 0x00, 0x08, 0xa9, 0x45, 0x03, 0x09, 0x00, 0x00, 0x42, 0x00, 0x45, 0x82,
+    0x00, 0x86, 0x45, 0x02, 0x00, 0x00, 0x43, 0x95, 0x45, 0x02, 0x43, 0x00, 0x00, 0x86,
+    0x45, 0x82, 0x00, 0x00, 0x45, 0x00, 0x45, 0x82, 0x00, 0x84, 0x45, 0x00, 0x06, 0x83,
+    0x00, 0x95, 0x45, 0x83, 0x00, 0x00, 0x05, 0x84, 0x45, 0x82, 0x00, 0x00, 0x45, 0x04,
+    0x45, 0x17, 0x00, 0x00, 0x0b, 0x82, 0x45, 0x84, 0x00, 0x00, 0x35, 0x95, 0x45, 0x00,
+    0x34, 0x84, 0x00, 0x82, 0x45, 0x04, 0x0d, 0x00, 0x00, 0x12, 0x45, 0x01, 0x45, 0x45,
+    0x82, 0x00, 0x82, 0x45, 0x83, 0x00, 0x99, 0x45, 0x83, 0x00, 0x82, 0x45, 0x82, 0x00,
+    0x01, 0x45, 0x45, 0x01, 0x45, 0x45, 0x82, 0x00, 0x00, 0x1f, 0x82, 0x45, 0x00, 0x00,
+    0x9d, 0x45, 0x00, 0x00, 0x82, 0x45, 0x00, 0x20, 0x82, 0x00, 0x01, 0x45, 0x45, 0x82,
+    0x45, 0x82, 0x00, 0xa5, 0x45, 0x82, 0x00, 0x82, 0x45, 0x82, 0x45, 0xab, 0x00, 0x82,
+    0x45, 0x83, 0x45, 0xa9, 0x00, 0x83, 0x45, 0x83, 0x45, 0x00, 0x32, 0xa7, 0x00, 0x00,
+    0x30, 0x83, 0x45, 0xb1, 0x45, 0xb1, 0x45, 0xb1, 0x45, 0xb1, 0x45, 0xb1, 0x45,
+};
+// clang-format on
+
+constexpr bike_computer::CompressedImage speedometer_icon = {
+    .pPalette    = speedometer_icon_palette,
+    .pData       = speedometer_icon_data,
+    .imageWidth  = kSpeedometerIconWidth,
+    .imageHeight = kSpeedometerIconHeight};
@@ -0,0 +1,177 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file thermometer_icon_100_rle.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Thermometer icon (size 100) as palette indexed RLE data
+ *        (generated by tools/icon_converter.py from thermometer_icon_100.hpp)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "common/compressed_image.hpp"
+
+constexpr uint8_t kThermometerIconHeight = 100;
+constexpr uint8_t kThermometerIconWidth  = 100;
+
+// compressed size is 2143 (raw size is 40000)
+// clang-format off
+const uint32_t thermometer_icon_palette[] = {
+    0x000000ff, 0x010101ff, 0x020202ff, 0x030303ff, 0x040404ff, 0x060606ff, 0x070707ff,
+    0x080808ff, 0x090909ff, 0x0a0a0aff, 0x0b0b0bff, 0x0c0c0cff, 0x0d0d0dff, 0x0e0e0eff,
+    0x0f0f0fff, 0x101010ff, 0x111111ff, 0x121212ff, 0x131313ff, 0x141414ff, 0x161616ff,
+    0x171717ff, 0x181818ff, 0x191919ff, 0x1b1b1bff, 0x1c1c1cff, 0x1d1d1dff, 0x202020ff,
+    0x212121ff, 0x222222ff, 0x232323ff, 0x242424ff, 0x252525ff, 0x262626ff, 0x272727ff,
+    0x292929ff, 0x2b2b2bff, 0x2c2c2cff, 0x303030ff, 0x313131ff, 0x333333ff, 0x343434ff,
+    0x383838ff, 0x393939ff, 0x3a3a3aff, 0x3c3c3cff, 0x3d3d3dff, 0x3e3e3eff, 0x3f3f3fff,
+    0x434343ff, 0x444444ff, 0x454545ff, 0x464646ff, 0x474747ff, 0x484848ff, 0x494949ff,
+    0x4c4c4cff, 0x515151ff, 0x535353ff, 0x5a5a5aff, 0x5c5c5cff, 0x5f5f5fff, 0x616161ff,
+    0x626262ff, 0x646464ff, 0x656565ff, 0x6c6c6cff, 0x6d6d6dff, 0x6e6e6eff, 0x707070ff,
+    0x737373ff, 0x757575ff, 0x787878ff, 0x7a7a7aff, 0x7b7b7bff, 0x7c7c7cff, 0x7d7d7dff,
+    0x7e7e7eff, 0x7f7f7fff, 0x808080ff, 0x868686ff, 0x878787ff, 0x888888ff, 0x8c8c8cff,
+    0x8d8d8dff, 0x8e8e8eff, 0x8f8f8fff, 0x909090ff, 0x919191ff, 0x949494ff, 0x959595ff,
+    0x979797ff, 0x999999ff, 0x9a9a9aff, 0x9b9b9bff, 0x9c9c9cff, 0x9e9e9eff, 0xa1a1a1ff,
+    0xa2a2a2ff, 0xa4a4a4ff, 0xa5a5a5ff, 0xa6a6a6ff, 0xa7a7a7ff, 0xa8a8a8ff, 0xa9a9a9ff,
+    0xabababff, 0xacacacff, 0xadadadff, 0xaeaeaeff, 0xafafafff, 0xb1b1b1ff, 0xb2b2b2ff,
+    0xb3b3b3ff, 0xb4b4b4ff, 0xb6b6b6ff, 0xb7b7b7ff, 0xb8b8b8ff, 0xb9b9b9ff, 0xbdbdbdff,
+    0xbfbfbfff, 0xc0c0c0ff, 0xc2c2c2ff, 0xc3c3c3ff, 0xc4c4c4ff, 0xc5c5c5ff, 0xc9c9c9ff,
+    0xd0d0d0ff, 0xd1d1d1ff, 0xd2d2d2ff, 0xd3d3d3ff, 0xd4d4d4ff, 0xd5d5d5ff, 0xd7d7d7ff,
+    0xd9d9d9ff, 0xdadadaff, 0xdbdbdbff, 0xdcdcdcff, 0xdededeff, 0xe2e2e2ff, 0xe3e3e3ff,
+    0xe4e4e4ff, 0xe5e5e5ff, 0xe6e6e6ff, 0xe7e7e7ff, 0xe8e8e8ff, 0xeaeaeaff, 0xebebebff,
+    0xecececff, 0xedededff, 0xeeeeeeff, 0xefefefff, 0xf0f0f0ff, 0xf1f1f1ff, 0xf3f3f3ff,
+    0xf4f4f4ff, 0xf5f5f5ff, 0xf7f7f7ff, 0xf8f8f8ff, 0xf9f9f9ff, 0xfafafaff, 0xfbfbfbff,
+    0xfdfdfdff, 0xfefefeff, 0xffffffff,
+};
+
+const uint8_t thermometer_icon_data[] = {
+    0xab, 0xa3, 0x0b, 0x8a, 0x56, 0x3b, 0x25, 0x15, 0x06, 0x06, 0x15, 0x25, 0x3b, 0x57,
+    0x8b, 0xab, 0xa3, 0xa9, 0xa3, 0x02, 0x7e, 0x34, 0x02, 0x89, 0x00, 0x02, 0x02, 0x35,
+    0x7f, 0xa9, 0xa3, 0xa8, 0xa3, 0x01, 0x4f, 0x03, 0x8d, 0x00, 0x01, 0x03, 0x4f, 0xa8,
+    0xa3, 0xa7, 0xa3, 0x00, 0x42, 0x91, 0x00, 0x00, 0x43, 0xa7, 0xa3, 0xa6, 0xa3, 0x00,
+    0x68, 0x84, 0x00, 0x09, 0x2b, 0x55, 0x7b, 0x91, 0x9d, 0x9d, 0x91, 0x7b, 0x55, 0x2a,
+    0x84, 0x00, 0x00, 0x69, 0xa6, 0xa3, 0xa5, 0xa3, 0x01, 0x9b, 0x14, 0x82, 0x00, 0x01,
+    0x17, 0x75, 0x89, 0xa3, 0x01, 0x75, 0x17, 0x82, 0x00, 0x01, 0x15, 0x9b, 0xa5, 0xa3,
+    0xa5, 0xa3, 0x00, 0x66, 0x82, 0x00, 0x01, 0x0f, 0x89, 0x8b, 0xa3, 0x01, 0x88, 0x0e,
+    0x82, 0x00, 0x00, 0x67, 0xa5, 0xa3, 0xa5, 0xa3, 0x00, 0x39, 0x82, 0x00, 0x00, 0x52,
+    0x8d, 0xa3, 0x00, 0x50, 0x82, 0x00, 0x00, 0x3a, 0xa5, 0xa3, 0xa5, 0xa3, 0x00, 0x23,
+    0x82, 0x00, 0x00, 0x84, 0x8d, 0xa3, 0x00, 0x83, 0x82, 0x00, 0x00, 0x24, 0xa5, 0xa3,
+    0xa5, 0xa3, 0x00, 0x0c, 0x82, 0x00, 0x00, 0x9b, 0x8d, 0xa3, 0x00, 0x9a, 0x82, 0x00,
+    0x00, 0x0c, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x8f, 0xa3, 0x83, 0x00, 0xa5, 0xa3,
+    0xa5, 0xa3, 0x83, 0x00, 0x8f, 0xa3, 0x83, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00,
+    0x8f, 0xa3, 0x83, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x8f, 0xa3, 0x83, 0x00,
+    0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x8f, 0xa3, 0x83, 0x00, 0xa5, 0xa3, 0xa5, 0xa3,
+    0x83, 0x00, 0x8f, 0xa3, 0x83, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x8f, 0xa3,
+    0x83, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x8f, 0xa3, 0x83, 0x00, 0xa5, 0xa3,
+    0xa5, 0xa3, 0x97, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x97, 0x00, 0xa5, 0xa3, 0xa5, 0xa3,
+    0x97, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x97, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00,
+    0x8f, 0xa3, 0x83, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x8f, 0xa3, 0x83, 0x00,
+    0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x8f, 0xa3, 0x83, 0x00, 0xa5, 0xa3, 0xa5, 0xa3,
+    0x83, 0x00, 0x8f, 0xa3, 0x83, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x87, 0xa3,
+    0x8b, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x87, 0xa3, 0x8b, 0x00, 0xa5, 0xa3,
+    0xa5, 0xa3, 0x83, 0x00, 0x87, 0xa3, 0x8b, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00,
+    0x87, 0xa3, 0x8b, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x8f, 0xa3, 0x83, 0x00,
+    0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x8f, 0xa3, 0x83, 0x00, 0xa5, 0xa3, 0xa5, 0xa3,
+    0x83, 0x00, 0x8f, 0xa3, 0x83, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x8f, 0xa3,
+    0x83, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x8b, 0xa3, 0x87, 0x00, 0xa5, 0xa3,
+    0xa5, 0xa3, 0x83, 0x00, 0x8b, 0xa3, 0x87, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00,
+    0x8b, 0xa3, 0x87, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x8b, 0xa3, 0x87, 0x00,
+    0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x8f, 0xa3, 0x83, 0x00, 0xa5, 0xa3, 0xa5, 0xa3,
+    0x83, 0x00, 0x8f, 0xa3, 0x83, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x8f, 0xa3,
+    0x83, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x8f, 0xa3, 0x83, 0x00, 0xa5, 0xa3,
+    0xa5, 0xa3, 0x83, 0x00, 0x87, 0xa3, 0x8b, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00,
+    0x87, 0xa3, 0x8b, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x87, 0xa3, 0x8b, 0x00,
+    0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x87, 0xa3, 0x8b, 0x00, 0xa5, 0xa3, 0xa5, 0xa3,
+    0x83, 0x00, 0x8f, 0xa3, 0x83, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x8f, 0xa3,
+    0x83, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x8f, 0xa3, 0x83, 0x00, 0xa5, 0xa3,
+    0xa5, 0xa3, 0x83, 0x00, 0x8f, 0xa3, 0x83, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00,
+    0x8f, 0xa3, 0x83, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x8f, 0xa3, 0x83, 0x00,
+    0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x8f, 0xa3, 0x83, 0x00, 0xa5, 0xa3, 0xa5, 0xa3,
+    0x83, 0x00, 0x8f, 0xa3, 0x83, 0x00, 0xa5, 0xa3, 0xa5, 0xa3, 0x83, 0x00, 0x8f, 0xa3,
+    0x83, 0x00, 0xa5, 0xa3, 0xa4, 0xa3, 0x00, 0x70, 0x83, 0x00, 0x8f, 0xa3, 0x83, 0x00,
+    0x00, 0x70, 0xa4, 0xa3, 0xa2, 0xa3, 0x01, 0x93, 0x3c, 0x83, 0x00, 0x00, 0x06, 0x8f,
+    0xa3, 0x00, 0x05, 0x83, 0x00, 0x01, 0x3c, 0x94, 0xa2, 0xa3, 0xa1, 0xa3, 0x01, 0x7e,
+    0x19, 0x84, 0x00, 0x00, 0x40, 0x8f, 0xa3, 0x00, 0x3f, 0x84, 0x00, 0x01, 0x1a, 0x7f,
+    0xa1, 0xa3, 0xa0, 0xa3, 0x01, 0x72, 0x0c, 0x83, 0x00, 0x02, 0x11, 0x59, 0xa1, 0x8f,
+    0xa3, 0x02, 0xa1, 0x59, 0x11, 0x83, 0x00, 0x01, 0x0c, 0x73, 0xa0, 0xa3, 0x9f, 0xa3,
+    0x01, 0x6f, 0x04, 0x83, 0x00, 0x01, 0x3e, 0x93, 0x93, 0xa3, 0x01, 0x93, 0x3d, 0x83,
+    0x00, 0x01, 0x04, 0x71, 0x9f, 0xa3, 0x9e, 0xa3, 0x01, 0x7d, 0x0a, 0x82, 0x00, 0x01,
+    0x06, 0x5d, 0x97, 0xa3, 0x01, 0x61, 0x08, 0x82, 0x00, 0x01, 0x08, 0x7c, 0x9e, 0xa3,
+    0x9d, 0xa3, 0x01, 0x8a, 0x12, 0x82, 0x00, 0x01, 0x0b, 0x7a, 0x99, 0xa3, 0x01, 0x79,
+    0x0a, 0x82, 0x00, 0x01, 0x13, 0x8b, 0x9d, 0xa3, 0x9c, 0xa3, 0x01, 0xa2, 0x36, 0x82,
+    0x00, 0x01, 0x06, 0x74, 0x9b, 0xa3, 0x01, 0x76, 0x07, 0x82, 0x00, 0x01, 0x32, 0xa2,
+    0x9c, 0xa3, 0x9c, 0xa3, 0x00, 0x59, 0x83, 0x00, 0x00, 0x66, 0x9d, 0xa3, 0x00, 0x64,
+    0x83, 0x00, 0x00, 0x5a, 0x9c, 0xa3, 0x9b, 0xa3, 0x01, 0x97, 0x10, 0x82, 0x00, 0x00,
+    0x3e, 0x9f, 0xa3, 0x00, 0x3d, 0x82, 0x00, 0x01, 0x0e, 0x95, 0x9b, 0xa3, 0x9b, 0xa3,
+    0x00, 0x4b, 0x82, 0x00, 0x01, 0x19, 0x99, 0x9f, 0xa3, 0x01, 0x99, 0x18, 0x82, 0x00,
+    0x00, 0x4d, 0x9b, 0xa3, 0x9a, 0xa3, 0x01, 0x95, 0x0c, 0x82, 0x00, 0x00, 0x5e, 0xa1,
+    0xa3, 0x00, 0x5c, 0x82, 0x00, 0x01, 0x0e, 0x96, 0x9a, 0xa3, 0x9a, 0xa3, 0x00, 0x5c,
+    0x82, 0x00, 0x01, 0x21, 0xa0, 0xa1, 0xa3, 0x01, 0xa0, 0x1f, 0x82, 0x00, 0x00, 0x5e,
+    0x9a, 0xa3, 0x9a, 0xa3, 0x00, 0x30, 0x82, 0x00, 0x00, 0x53, 0xa3, 0xa3, 0x00, 0x52,
+    0x82, 0x00, 0x00, 0x31, 0x9a, 0xa3, 0x99, 0xa3, 0x05, 0x8e, 0x02, 0x00, 0x00, 0x03,
+    0x8d, 0xa3, 0xa3, 0x05, 0x8c, 0x02, 0x00, 0x00, 0x02, 0x8f, 0x99, 0xa3, 0x99, 0xa3,
+    0x00, 0x6b, 0x82, 0x00, 0x00, 0x2f, 0xa5, 0xa3, 0x00, 0x2d, 0x82, 0x00, 0x00, 0x6d,
+    0x99, 0xa3, 0x99, 0xa3, 0x00, 0x48, 0x82, 0x00, 0x00, 0x48, 0xa5, 0xa3, 0x00, 0x47,
+    0x82, 0x00, 0x00, 0x4a, 0x99, 0xa3, 0x99, 0xa3, 0x00, 0x33, 0x82, 0x00, 0x00, 0x6b,
+    0xa5, 0xa3, 0x00, 0x69, 0x82, 0x00, 0x00, 0x35, 0x99, 0xa3, 0x99, 0xa3, 0x00, 0x24,
+    0x82, 0x00, 0x00, 0x82, 0xa5, 0xa3, 0x00, 0x80, 0x82, 0x00, 0x00, 0x25, 0x99, 0xa3,
+    0x99, 0xa3, 0x00, 0x16, 0x82, 0x00, 0x00, 0x8e, 0xa5, 0xa3, 0x00, 0x8c, 0x82, 0x00,
+    0x00, 0x18, 0x99, 0xa3, 0x99, 0xa3, 0x00, 0x07, 0x82, 0x00, 0x00, 0x9c, 0xa5, 0xa3,
+    0x00, 0x9c, 0x82, 0x00, 0x00, 0x07, 0x99, 0xa3, 0x99, 0xa3, 0x00, 0x05, 0x82, 0x00,
+    0x00, 0x9e, 0xa5, 0xa3, 0x00, 0x9d, 0x82, 0x00, 0x00, 0x06, 0x99, 0xa3, 0x99, 0xa3,
+    0x00, 0x11, 0x82, 0x00, 0x00, 0x94, 0xa5, 0xa3, 0x00, 0x92, 0x82, 0x00, 0x00, 0x13,
+    0x99, 0xa3, 0x99, 0xa3, 0x00, 0x1e, 0x82, 0x00, 0x00, 0x83, 0xa5, 0xa3, 0x00, 0x81,
+    0x82, 0x00, 0x00, 0x20, 0x99, 0xa3, 0x99, 0xa3, 0x00, 0x34, 0x82, 0x00, 0x00, 0x6d,
+    0xa5, 0xa3, 0x00, 0x6a, 0x82, 0x00, 0x00, 0x37, 0x99, 0xa3, 0x99, 0xa3, 0x00, 0x44,
+    0x82, 0x00, 0x00, 0x4c, 0xa5, 0xa3, 0x00, 0x49, 0x82, 0x00, 0x00, 0x45, 0x99, 0xa3,
+    0x99, 0xa3, 0x00, 0x65, 0x82, 0x00, 0x00, 0x2e, 0xa5, 0xa3, 0x00, 0x2a, 0x82, 0x00,
+    0x00, 0x68, 0x99, 0xa3, 0x99, 0xa3, 0x05, 0x8e, 0x01, 0x00, 0x00, 0x04, 0x8f, 0xa3,
+    0xa3, 0x05, 0x8e, 0x03, 0x00, 0x00, 0x01, 0x90, 0x99, 0xa3, 0x9a, 0xa3, 0x00, 0x29,
+    0x82, 0x00, 0x00, 0x56, 0xa3, 0xa3, 0x00, 0x53, 0x82, 0x00, 0x00, 0x2a, 0x9a, 0xa3,
+    0x9a, 0xa3, 0x00, 0x58, 0x82, 0x00, 0x01, 0x1d, 0xa0, 0xa1, 0xa3, 0x01, 0x9f, 0x1c,
+    0x82, 0x00, 0x00, 0x59, 0x9a, 0xa3, 0x9a, 0xa3, 0x01, 0x92, 0x09, 0x82, 0x00, 0x00,
+    0x61, 0xa1, 0xa3, 0x00, 0x5f, 0x82, 0x00, 0x01, 0x0a, 0x93, 0x9a, 0xa3, 0x9b, 0xa3,
+    0x00, 0x44, 0x82, 0x00, 0x01, 0x16, 0x97, 0x9f, 0xa3, 0x01, 0x98, 0x17, 0x82, 0x00,
+    0x00, 0x46, 0x9b, 0xa3, 0x9b, 0xa3, 0x01, 0x8c, 0x0a, 0x82, 0x00, 0x00, 0x41, 0x9f,
+    0xa3, 0x00, 0x3f, 0x82, 0x00, 0x01, 0x0c, 0x8e, 0x9b, 0xa3, 0x9c, 0xa3, 0x00, 0x51,
+    0x83, 0x00, 0x00, 0x64, 0x9d, 0xa3, 0x00, 0x62, 0x83, 0x00, 0x00, 0x53, 0x9c, 0xa3,
+    0x9c, 0xa3, 0x01, 0x9e, 0x26, 0x82, 0x00, 0x01, 0x07, 0x78, 0x9b, 0xa3, 0x01, 0x77,
+    0x06, 0x82, 0x00, 0x01, 0x28, 0x9f, 0x9c, 0xa3, 0x9d, 0xa3, 0x01, 0x85, 0x0c, 0x82,
+    0x00, 0x01, 0x0e, 0x78, 0x99, 0xa3, 0x01, 0x77, 0x0d, 0x82, 0x00, 0x01, 0x0d, 0x87,
+    0x9d, 0xa3, 0x9e, 0xa3, 0x01, 0x6c, 0x03, 0x82, 0x00, 0x01, 0x07, 0x63, 0x97, 0xa3,
+    0x01, 0x62, 0x06, 0x82, 0x00, 0x01, 0x03, 0x6e, 0x9e, 0xa3, 0x9f, 0xa3, 0x00, 0x5b,
+    0x84, 0x00, 0x01, 0x40, 0x97, 0x93, 0xa3, 0x01, 0x97, 0x3f, 0x83, 0x00, 0x01, 0x01,
+    0x5c, 0x9f, 0xa3, 0xa0, 0xa3, 0x01, 0x5c, 0x03, 0x83, 0x00, 0x02, 0x16, 0x60, 0xa0,
+    0x8f, 0xa3, 0x02, 0x9f, 0x5f, 0x15, 0x83, 0x00, 0x01, 0x03, 0x5d, 0xa0, 0xa3, 0xa1,
+    0xa3, 0x01, 0x6c, 0x0d, 0x84, 0x00, 0x02, 0x1c, 0x54, 0x8e, 0x8b, 0xa3, 0x02, 0x8d,
+    0x53, 0x1b, 0x84, 0x00, 0x01, 0x0e, 0x6e, 0xa1, 0xa3, 0xa2, 0xa3, 0x01, 0x86, 0x27,
+    0x85, 0x00, 0x0d, 0x03, 0x2c, 0x4a, 0x6b, 0x81, 0x94, 0x9e, 0x9e, 0x94, 0x80, 0x6a,
+    0x49, 0x2b, 0x03, 0x85, 0x00, 0x01, 0x28, 0x87, 0xa2, 0xa3, 0xa3, 0xa3, 0x02, 0xa0,
+    0x57, 0x0c, 0x95, 0x00, 0x02, 0x09, 0x4e, 0x9e, 0xa3, 0xa3, 0xa5, 0xa3, 0x02, 0x91,
+    0x4e, 0x0d, 0x91, 0x00, 0x02, 0x0a, 0x44, 0x8d, 0xa5, 0xa3, 0xa7, 0xa3, 0x03, 0x95,
+    0x5b, 0x2b, 0x02, 0x8b, 0x00, 0x03, 0x02, 0x2c, 0x5b, 0x96, 0xa7, 0xa3, 0xaa, 0xa3,
+    0x0d, 0x93, 0x69, 0x47, 0x38, 0x22, 0x15, 0x06, 0x06, 0x15, 0x22, 0x38, 0x47, 0x69,
+    0x93, 0xaa, 0xa3,
+};
+// clang-format on
+
+constexpr bike_computer::CompressedImage thermometer_icon = {
+    .pPalette    = thermometer_icon_palette,
+    .pData       = thermometer_icon_data,
+    .imageWidth  = kThermometerIconWidth,
+    .imageHeight = kThermometerIconHeight};
@@ -0,0 +1,108 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file thermometer_icon_50_rle.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Thermometer icon (size 50) as palette indexed RLE data
+ *        (generated by tools/icon_converter.py from thermometer_icon_50.hpp)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "common/compressed_image.hpp"
+
+constexpr uint8_t kThermometerIconHeight = 50;
+constexpr uint8_t kThermometerIconWidth  = 50;
+
+// compressed size is 936 (raw size is 10000)
+// clang-format off
+const uint32_t thermometer_icon_palette[] = {
+    0x000000ff, 0x040404ff, 0x060606ff, 0x070707ff, 0x090909ff, 0x101010ff, 0x141414ff,
+    0x313131ff, 0x383838ff, 0x3f3f3fff, 0x525252ff, 0x575757ff, 0x5c5c5cff, 0x787878ff,
+    0x808080ff, 0x848484ff, 0x858585ff, 0x8a8a8aff, 0x939393ff, 0x999999ff, 0xa1a1a1ff,
+    0xa9a9a9ff, 0xb6b6b6ff, 0xbebebeff, 0xc3c3c3ff, 0xc4c4c4ff, 0xccccccff, 0xdcdcdcff,
+    0xe1e1e1ff, 0xf0f0f0ff, 0xf5f5f5ff, 0xfbfbfbff, 0xfcfcfcff, 0xfdfdfdff, 0xffffffff,
+};
+
+const uint8_t thermometer_icon_data[] = {
+    0x95, 0x22, 0x00, 0x1f, 0x83, 0x00, 0x00, 0x17, 0x95, 0x22, 0x94, 0x22, 0x87, 0x00,
+    0x94, 0x22, 0x93, 0x22, 0x02, 0x00, 0x00, 0x05, 0x83, 0x22, 0x02, 0x16, 0x00, 0x00,
+    0x93, 0x22, 0x93, 0x22, 0x01, 0x00, 0x03, 0x85, 0x22, 0x02, 0x11, 0x00, 0x1d, 0x92,
+    0x22, 0x92, 0x22, 0x01, 0x00, 0x00, 0x87, 0x22, 0x01, 0x00, 0x00, 0x92, 0x22, 0x92,
+    0x22, 0x01, 0x00, 0x00, 0x87, 0x22, 0x01, 0x00, 0x00, 0x92, 0x22, 0x92, 0x22, 0x01,
+    0x00, 0x00, 0x87, 0x22, 0x01, 0x00, 0x00, 0x92, 0x22, 0x92, 0x22, 0x01, 0x00, 0x00,
+    0x82, 0x22, 0x01, 0x14, 0x14, 0x82, 0x22, 0x01, 0x00, 0x00, 0x92, 0x22, 0x92, 0x22,
+    0x01, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x92,
+    0x22, 0x92, 0x22, 0x82, 0x00, 0x03, 0x02, 0x22, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00,
+    0x00, 0x92, 0x22, 0x92, 0x22, 0x82, 0x00, 0x03, 0x02, 0x22, 0x00, 0x00, 0x82, 0x22,
+    0x01, 0x00, 0x00, 0x92, 0x22, 0x92, 0x22, 0x01, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00,
+    0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x92, 0x22, 0x92, 0x22, 0x01, 0x00, 0x00, 0x82,
+    0x22, 0x01, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x92, 0x22, 0x92, 0x22, 0x82,
+    0x00, 0x03, 0x02, 0x22, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x92, 0x22, 0x92,
+    0x22, 0x82, 0x00, 0x03, 0x02, 0x22, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x92,
+    0x22, 0x92, 0x22, 0x01, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x82, 0x22, 0x01,
+    0x00, 0x00, 0x92, 0x22, 0x92, 0x22, 0x01, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00,
+    0x82, 0x22, 0x01, 0x00, 0x00, 0x92, 0x22, 0x92, 0x22, 0x06, 0x00, 0x00, 0x0e, 0x0f,
+    0x22, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x92, 0x22, 0x92, 0x22, 0x82, 0x00,
+    0x03, 0x02, 0x22, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x92, 0x22, 0x92, 0x22,
+    0x01, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x92,
+    0x22, 0x92, 0x22, 0x01, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x82, 0x22, 0x01,
+    0x00, 0x00, 0x92, 0x22, 0x92, 0x22, 0x01, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00,
+    0x82, 0x22, 0x01, 0x00, 0x00, 0x92, 0x22, 0x92, 0x22, 0x82, 0x00, 0x03, 0x02, 0x22,
+    0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x92, 0x22, 0x92, 0x22, 0x01, 0x00, 0x00,
+    0x82, 0x22, 0x01, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x92, 0x22, 0x92, 0x22,
+    0x01, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x92,
+    0x22, 0x92, 0x22, 0x01, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x82, 0x22, 0x01,
+    0x00, 0x00, 0x92, 0x22, 0x92, 0x22, 0x82, 0x00, 0x03, 0x02, 0x22, 0x00, 0x00, 0x82,
+    0x22, 0x01, 0x00, 0x00, 0x92, 0x22, 0x92, 0x22, 0x06, 0x00, 0x00, 0x0a, 0x0b, 0x22,
+    0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x92, 0x22, 0x92, 0x22, 0x01, 0x00, 0x00,
+    0x82, 0x22, 0x01, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x92, 0x22, 0x92, 0x22,
+    0x01, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x92,
+    0x22, 0x92, 0x22, 0x82, 0x00, 0x03, 0x02, 0x22, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00,
+    0x00, 0x92, 0x22, 0x92, 0x22, 0x82, 0x00, 0x03, 0x02, 0x22, 0x00, 0x00, 0x82, 0x22,
+    0x01, 0x00, 0x00, 0x92, 0x22, 0x92, 0x22, 0x01, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00,
+    0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x92, 0x22, 0x92, 0x22, 0x01, 0x00, 0x00, 0x82,
+    0x22, 0x01, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x92, 0x22, 0x91, 0x22, 0x02,
+    0x09, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x82, 0x22, 0x82, 0x00, 0x91, 0x22,
+    0x91, 0x22, 0x01, 0x00, 0x00, 0x83, 0x22, 0x01, 0x00, 0x00, 0x83, 0x22, 0x02, 0x00,
+    0x00, 0x0d, 0x90, 0x22, 0x90, 0x22, 0x01, 0x00, 0x00, 0x84, 0x22, 0x01, 0x00, 0x00,
+    0x84, 0x22, 0x01, 0x00, 0x00, 0x90, 0x22, 0x8f, 0x22, 0x02, 0x13, 0x00, 0x21, 0x82,
+    0x22, 0x00, 0x1b, 0x83, 0x00, 0x00, 0x0c, 0x83, 0x22, 0x01, 0x00, 0x06, 0x8f, 0x22,
+    0x8f, 0x22, 0x01, 0x00, 0x00, 0x82, 0x22, 0x07, 0x20, 0x00, 0x00, 0x1c, 0x1e, 0x00,
+    0x00, 0x10, 0x82, 0x22, 0x01, 0x00, 0x00, 0x8f, 0x22, 0x8f, 0x22, 0x01, 0x00, 0x00,
+    0x82, 0x22, 0x01, 0x00, 0x00, 0x83, 0x22, 0x01, 0x00, 0x00, 0x82, 0x22, 0x01, 0x04,
+    0x00, 0x8f, 0x22, 0x8f, 0x22, 0x01, 0x00, 0x01, 0x82, 0x22, 0x01, 0x00, 0x00, 0x83,
+    0x22, 0x01, 0x18, 0x00, 0x82, 0x22, 0x01, 0x1a, 0x00, 0x8f, 0x22, 0x8f, 0x22, 0x01,
+    0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x83, 0x22, 0x01, 0x07, 0x00, 0x82, 0x22,
+    0x01, 0x19, 0x00, 0x8f, 0x22, 0x8f, 0x22, 0x01, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00,
+    0x00, 0x83, 0x22, 0x01, 0x00, 0x00, 0x82, 0x22, 0x01, 0x00, 0x00, 0x8f, 0x22, 0x8f,
+    0x22, 0x01, 0x00, 0x00, 0x83, 0x22, 0x85, 0x00, 0x83, 0x22, 0x01, 0x00, 0x00, 0x8f,
+    0x22, 0x90, 0x22, 0x01, 0x00, 0x12, 0x83, 0x22, 0x83, 0x00, 0x84, 0x22, 0x01, 0x00,
+    0x14, 0x8f, 0x22, 0x90, 0x22, 0x01, 0x00, 0x00, 0x8b, 0x22, 0x01, 0x00, 0x00, 0x90,
+    0x22, 0x91, 0x22, 0x01, 0x00, 0x00, 0x89, 0x22, 0x01, 0x00, 0x00, 0x91, 0x22, 0x92,
+    0x22, 0x02, 0x00, 0x00, 0x08, 0x85, 0x22, 0x03, 0x15, 0x00, 0x00, 0x1e, 0x91, 0x22,
+    0x93, 0x22, 0x89, 0x00, 0x93, 0x22, 0x95, 0x22, 0x85, 0x00, 0x95, 0x22,
+};
+// clang-format on
+
+constexpr bike_computer::CompressedImage thermometer_icon = {
+    .pPalette    = thermometer_icon_palette,
+    .pData       = thermometer_icon_data,
+    .imageWidth  = kThermometerIconWidth,
+    .imageHeight = kThermometerIconHeight};
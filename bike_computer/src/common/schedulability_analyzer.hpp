@@ -0,0 +1,179 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file schedulability_analyzer.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Compile-time schedulability analysis of periodic task sets
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// std
+#include <chrono>
+#include <cstdint>
+
+// local
+#include "schedule_synthesizer.hpp"
+
+namespace bike_computer {
+
+// Result of the schedulability analysis of a set of independent periodic tasks
+// with deadlines equal to periods, released simultaneously (critical instant)
+template <uint8_t NbrOfTasks>
+struct TaskSetAnalysis {
+  static constexpr uint8_t kNbrOfTasks = NbrOfTasks;
+  // total utilization and sufficient utilization based tests (rate monotonic)
+  double utilization           = 0.0;
+  double liuLaylandBound       = 0.0;
+  bool isLiuLaylandSchedulable = false;
+  double hyperbolicProduct     = 0.0;
+  bool isHyperbolicSchedulable = false;
+  // exact response time analysis with rate monotonic priorities
+  // (priority 0 is the highest one, ties are broken by task index)
+  uint8_t priorities[NbrOfTasks]                      = {};
+  std::chrono::microseconds responseTimes[NbrOfTasks] = {};
+  bool isFixedPrioritySchedulable                     = false;
+  // exact EDF test (processor utilization computed over the hyperperiod)
+  std::chrono::microseconds hyperperiod = {};
+  std::chrono::microseconds busyTime    = {};
+  bool isEDFSchedulable                 = false;
+
+  // time left to each task before its deadline in the worst case
+  // (negative if the task misses its deadline)
+  constexpr std::chrono::microseconds getFixedPrioritySlack(
+      uint8_t taskIndex, const std::chrono::microseconds& period) const {
+    return period - responseTimes[taskIndex];
+  }
+  // processor time left idle over the hyperperiod under EDF
+  constexpr std::chrono::microseconds getEDFIdleTime() const {
+    return hyperperiod - busyTime;
+  }
+};
+
+namespace schedulability_analyzer {
+
+// n-th root of 2 computed with Newton's method (constexpr friendly)
+constexpr double nthRootOfTwo(uint8_t n) {
+  double x = 1.5;
+  for (uint8_t iteration = 0; iteration < 64; iteration++) {
+    double power = 1.0;
+    for (uint8_t index = 1; index < n; index++) {
+      power *= x;
+    }
+    x = ((n - 1) * x + 2.0 / power) / n;
+  }
+  return x;
+}
+
+// Liu & Layland bound n(2^(1/n) - 1)
+constexpr double liuLaylandBound(uint8_t n) {
+  return n == 0 ? 1.0 : n * (nthRootOfTwo(n) - 1.0);
+}
+
+constexpr int64_t ceilDiv(int64_t a, int64_t b) { return (a + b - 1) / b; }
+
+// task j has a higher priority than task i under rate monotonic
+template <uint8_t NbrOfTasks>
+constexpr bool hasHigherPriority(uint8_t j,
+                                 uint8_t i,
+                                 const std::chrono::microseconds (&periods)[NbrOfTasks]) {
+  return periods[j] < periods[i] || (periods[j] == periods[i] && j < i);
+}
+
+// worst case response time of task i: smallest fixed point of
+// R = Ci + sum over higher priority tasks j of ceil(R / Tj) * Cj
+// the iteration stops as soon as the deadline is exceeded
+template <uint8_t NbrOfTasks>
+constexpr int64_t computeResponseTime(
+    uint8_t i,
+    const std::chrono::microseconds (&periods)[NbrOfTasks],
+    const std::chrono::microseconds (&computationTimes)[NbrOfTasks]) {
+  int64_t responseTime = computationTimes[i].count();
+  while (true) {
+    int64_t next = computationTimes[i].count();
+    for (uint8_t j = 0; j < NbrOfTasks; j++) {
+      if (hasHigherPriority<NbrOfTasks>(j, i, periods)) {
+        next += ceilDiv(responseTime, periods[j].count()) * computationTimes[j].count();
+      }
+    }
+    if (next == responseTime || next > periods[i].count()) {
+      return next;
+    }
+    responseTime = next;
+  }
+}
+
+}  // namespace schedulability_analyzer
+
+// Analyze a set of periodic tasks (deadlines equal periods) with the
+// utilization based tests, the response time analysis for rate monotonic
+// priorities and the exact EDF test
+template <uint8_t NbrOfTasks>
+constexpr TaskSetAnalysis<NbrOfTasks> analyzeTaskSet(
+    const std::chrono::microseconds (&periods)[NbrOfTasks],
+    const std::chrono::microseconds (&computationTimes)[NbrOfTasks]) {
+  TaskSetAnalysis<NbrOfTasks> analysis;
+
+  int64_t hyperperiod = 1;
+  for (uint8_t taskIndex = 0; taskIndex < NbrOfTasks; taskIndex++) {
+    hyperperiod = schedule_synthesizer::lcm(hyperperiod, periods[taskIndex].count());
+  }
+
+  analysis.hyperbolicProduct = 1.0;
+  int64_t busyTime           = 0;
+  for (uint8_t taskIndex = 0; taskIndex < NbrOfTasks; taskIndex++) {
+    const double taskUtilization =
+        static_cast<double>(computationTimes[taskIndex].count()) /
+        static_cast<double>(periods[taskIndex].count());
+    analysis.utilization += taskUtilization;
+    analysis.hyperbolicProduct *= (taskUtilization + 1.0);
+    busyTime += computationTimes[taskIndex].count() *
+                (hyperperiod / periods[taskIndex].count());
+  }
+  analysis.liuLaylandBound         = schedulability_analyzer::liuLaylandBound(NbrOfTasks);
+  analysis.isLiuLaylandSchedulable = analysis.utilization <= analysis.liuLaylandBound;
+  analysis.isHyperbolicSchedulable = analysis.hyperbolicProduct <= 2.0;
+
+  // EDF with deadlines equal to periods is exact for U <= 1, computed in integer
+  // arithmetic over the hyperperiod to avoid rounding issues
+  analysis.hyperperiod      = std::chrono::microseconds(hyperperiod);
+  analysis.busyTime         = std::chrono::microseconds(busyTime);
+  analysis.isEDFSchedulable = busyTime <= hyperperiod;
+
+  analysis.isFixedPrioritySchedulable = true;
+  for (uint8_t i = 0; i < NbrOfTasks; i++) {
+    uint8_t priority = 0;
+    for (uint8_t j = 0; j < NbrOfTasks; j++) {
+      if (schedulability_analyzer::hasHigherPriority<NbrOfTasks>(j, i, periods)) {
+        priority++;
+      }
+    }
+    analysis.priorities[i] = priority;
+    const int64_t responseTime =
+        schedulability_analyzer::computeResponseTime<NbrOfTasks>(
+            i, periods, computationTimes);
+    analysis.responseTimes[i] = std::chrono::microseconds(responseTime);
+    if (responseTime > periods[i].count()) {
+      analysis.isFixedPrioritySchedulable = false;
+    }
+  }
+  return analysis;
+}
+
+}  // namespace bike_computer
@@ -0,0 +1,103 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file schedulability_report.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Schedulability analysis report of the TaskManager task set
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "schedulability_report.hpp"
+
+// std
+#include <algorithm>
+
+// zephyr
+// false positive cpplint warning
+// NOLINTNEXTLINE(build/include_order)
+#include <zephyr/logging/log.h>
+
+// local
+#include "bike_schedule.hpp"
+
+LOG_MODULE_DECLARE(bike_computer, CONFIG_APP_LOG_LEVEL);
+
+namespace bike_computer {
+
+// utilization values are logged in per mille since floating point formatting is
+// not always enabled
+static int toPerMille(double value) { return static_cast<int>(value * 1000.0 + 0.5); }
+
+void logSchedulabilityReport(const TaskManager& taskManager) {
+  const auto& analysis = kBikeTaskSetAnalysis;
+
+  LOG_INF("Schedulability: U = %d/1000, Liu&Layland bound %d/1000 (%s)",
+          toPerMille(analysis.utilization),
+          toPerMille(analysis.liuLaylandBound),
+          analysis.isLiuLaylandSchedulable ? "pass" : "inconclusive");
+  LOG_INF("Schedulability: hyperbolic product %d/1000 (%s)",
+          toPerMille(analysis.hyperbolicProduct),
+          analysis.isHyperbolicSchedulable ? "pass" : "inconclusive");
+
+  // cyclic executive: idle time left in the frames of the synthesized schedule
+  std::chrono::microseconds minFrameSlack = kBikeSchedule.minorCycle;
+  std::chrono::microseconds totalSlack    = std::chrono::microseconds::zero();
+  for (uint16_t frameIndex = 0; frameIndex < kBikeSchedule.nbrOfFrames; frameIndex++) {
+    const auto frameSlack =
+        kBikeSchedule.minorCycle - kBikeSchedule.frameLoads[frameIndex];
+    minFrameSlack = std::min(minFrameSlack, frameSlack);
+    totalSlack += frameSlack;
+  }
+  LOG_INF("Cyclic executive: %d frames of %lld us, min frame slack %lld us, "
+          "idle %lld us per %lld us",
+          kBikeSchedule.nbrOfFrames,
+          kBikeSchedule.minorCycle.count(),
+          minFrameSlack.count(),
+          totalSlack.count(),
+          kBikeSchedule.hyperperiod.count());
+
+  // EDF: idle time over the hyperperiod
+  LOG_INF("EDF: %s, idle %lld us per %lld us",
+          analysis.isEDFSchedulable ? "schedulable" : "not schedulable",
+          analysis.getEDFIdleTime().count(),
+          analysis.hyperperiod.count());
+
+  // rate monotonic: worst case response time and slack of each task, compared with
+  // the measured values
+  LOG_INF("Rate monotonic: %s",
+          analysis.isFixedPrioritySchedulable ? "schedulable" : "not schedulable");
+  for (uint8_t taskIndex = 0; taskIndex < TaskManager::kNbrOfTaskTypes; taskIndex++) {
+    const auto period = TaskManager::kTaskPeriods[taskIndex];
+    const TaskStatistics& stats =
+        taskManager.getTaskStatistics(static_cast<TaskManager::TaskType>(taskIndex));
+    LOG_INF("  task %d (prio %d): C %lld, R %lld, slack %lld, measured WCET %lld, "
+            "measured R %lld",
+            taskIndex,
+            analysis.priorities[taskIndex],
+            TaskManager::kTaskComputationTimes[taskIndex].count(),
+            analysis.responseTimes[taskIndex].count(),
+            analysis.getFixedPrioritySlack(taskIndex, period).count(),
+            stats.getWCET().count(),
+            stats.getWorstResponseTime().count());
+    if (stats.getWCET() > TaskManager::kTaskComputationTimes[taskIndex]) {
+      LOG_WRN("  task %d exceeds its computation time budget", taskIndex);
+    }
+  }
+}
+
+}  // namespace bike_computer
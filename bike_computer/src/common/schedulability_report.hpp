@@ -0,0 +1,44 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file schedulability_report.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Schedulability analysis of the TaskManager task set
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// local
+#include "schedulability_analyzer.hpp"
+#include "task_manager.hpp"
+
+namespace bike_computer {
+
+// analysis of the TaskManager task set, computed at compile time
+static constexpr auto kBikeTaskSetAnalysis =
+    analyzeTaskSet(TaskManager::kTaskPeriods, TaskManager::kTaskComputationTimes);
+static_assert(kBikeTaskSetAnalysis.isEDFSchedulable,
+              "The TaskManager task set overloads the processor (U > 1)");
+
+// log the analysis results for each scheduling variant (cyclic executive, rate
+// monotonic and EDF) together with the headroom left by each of them and compare
+// the analytical bounds with the values measured by the task manager
+void logSchedulabilityReport(const TaskManager& taskManager);
+
+}  // namespace bike_computer
@@ -0,0 +1,230 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file schedule_synthesizer.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Compile-time synthesis of cyclic executive schedules
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// std
+#include <chrono>
+#include <cstdint>
+
+namespace bike_computer {
+
+// Result of the schedule synthesis: the hyperperiod (major cycle) is split into
+// nbrOfFrames frames (minor cycles) and each frame lists the indices of the tasks
+// to be run, in execution order
+template <uint8_t NbrOfTasks, uint16_t MaxNbrOfFrames, uint16_t MaxFrameSize>
+struct CyclicSchedule {
+  static constexpr uint8_t kNbrOfTasks                 = NbrOfTasks;
+  static constexpr uint16_t kMaxNbrOfFrames            = MaxNbrOfFrames;
+  static constexpr uint16_t kMaxFrameSize              = MaxFrameSize;
+  bool isFeasible                                      = false;
+  std::chrono::microseconds hyperperiod                = {};
+  std::chrono::microseconds minorCycle                 = {};
+  uint16_t nbrOfFrames                                 = 0;
+  uint8_t frames[MaxNbrOfFrames][MaxFrameSize]         = {};
+  uint16_t frameSizes[MaxNbrOfFrames]                  = {};
+  std::chrono::microseconds frameLoads[MaxNbrOfFrames] = {};
+};
+
+namespace schedule_synthesizer {
+
+constexpr int64_t gcd(int64_t a, int64_t b) {
+  while (b != 0) {
+    const int64_t r = a % b;
+    a               = b;
+    b               = r;
+  }
+  return a;
+}
+
+constexpr int64_t lcm(int64_t a, int64_t b) { return (a / gcd(a, b)) * b; }
+
+// a job is one instance of a task released within the hyperperiod
+struct Job {
+  uint8_t taskIndex   = 0;
+  int64_t release     = 0;
+  int64_t deadline    = 0;
+  int64_t computeTime = 0;
+};
+
+template <uint16_t MaxNbrOfJobs>
+struct JobSet {
+  Job jobs[MaxNbrOfJobs] = {};
+  uint16_t nbrOfJobs     = 0;
+  bool overflow          = false;
+};
+
+// frame size constraints of the cyclic executive (deadlines equal periods):
+// - each job must fit in one frame (f >= max Ci)
+// - the frame size must divide the hyperperiod
+// - there must be a full frame between release and deadline of each job
+//   (2f - gcd(f, Ti) <= Ti)
+template <uint8_t NbrOfTasks>
+constexpr bool isValidFrameSize(
+    int64_t frameSize,
+    int64_t hyperperiod,
+    const std::chrono::microseconds (&periods)[NbrOfTasks],
+    const std::chrono::microseconds (&computationTimes)[NbrOfTasks]) {
+  if (frameSize <= 0 || hyperperiod % frameSize != 0) {
+    return false;
+  }
+  for (uint8_t taskIndex = 0; taskIndex < NbrOfTasks; taskIndex++) {
+    const int64_t period = periods[taskIndex].count();
+    if (computationTimes[taskIndex].count() > frameSize) {
+      return false;
+    }
+    if (2 * frameSize - gcd(frameSize, period) > period) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// build the list of jobs released within the hyperperiod, sorted by deadline
+// (ties broken by shorter period, then by task index)
+template <uint16_t MaxNbrOfJobs, uint8_t NbrOfTasks>
+constexpr JobSet<MaxNbrOfJobs> buildJobSet(
+    int64_t hyperperiod,
+    const std::chrono::microseconds (&periods)[NbrOfTasks],
+    const std::chrono::microseconds (&computationTimes)[NbrOfTasks]) {
+  JobSet<MaxNbrOfJobs> jobSet;
+  for (uint8_t taskIndex = 0; taskIndex < NbrOfTasks; taskIndex++) {
+    const int64_t period = periods[taskIndex].count();
+    for (int64_t release = 0; release < hyperperiod; release += period) {
+      if (jobSet.nbrOfJobs >= MaxNbrOfJobs) {
+        jobSet.overflow = true;
+        return jobSet;
+      }
+      Job& job        = jobSet.jobs[jobSet.nbrOfJobs++];
+      job.taskIndex   = taskIndex;
+      job.release     = release;
+      job.deadline    = release + period;
+      job.computeTime = computationTimes[taskIndex].count();
+    }
+  }
+
+  // insertion sort (small number of jobs, constexpr friendly)
+  for (uint16_t i = 1; i < jobSet.nbrOfJobs; i++) {
+    const Job job = jobSet.jobs[i];
+    uint16_t j    = i;
+    while (j > 0) {
+      const Job& prev          = jobSet.jobs[j - 1];
+      const int64_t period     = job.deadline - job.release;
+      const int64_t prevPeriod = prev.deadline - prev.release;
+      const bool isBefore =
+          job.deadline < prev.deadline ||
+          (job.deadline == prev.deadline &&
+           (period < prevPeriod ||
+            (period == prevPeriod && job.taskIndex < prev.taskIndex)));
+      if (!isBefore) {
+        break;
+      }
+      jobSet.jobs[j] = jobSet.jobs[j - 1];
+      j--;
+    }
+    jobSet.jobs[j] = job;
+  }
+  return jobSet;
+}
+
+// assign jobs [jobIndex, nbrOfJobs) to frames using depth-first search with
+// backtracking: each job may run in any frame that starts at or after its release
+// and ends at or before its deadline
+template <typename Schedule, uint16_t MaxNbrOfJobs>
+constexpr bool packJobs(const JobSet<MaxNbrOfJobs>& jobSet,
+                        uint16_t jobIndex,
+                        int64_t frameSize,
+                        Schedule& schedule) {
+  if (jobIndex == jobSet.nbrOfJobs) {
+    return true;
+  }
+  const Job& job = jobSet.jobs[jobIndex];
+  const uint16_t firstFrame =
+      static_cast<uint16_t>((job.release + frameSize - 1) / frameSize);
+  const uint16_t lastFrame = static_cast<uint16_t>(job.deadline / frameSize);
+  for (uint16_t frame = firstFrame; frame < lastFrame; frame++) {
+    const int64_t load = schedule.frameLoads[frame].count();
+    if (load + job.computeTime > frameSize ||
+        schedule.frameSizes[frame] >= Schedule::kMaxFrameSize) {
+      continue;
+    }
+    schedule.frames[frame][schedule.frameSizes[frame]++] = job.taskIndex;
+    schedule.frameLoads[frame] = std::chrono::microseconds(load + job.computeTime);
+    if (packJobs(jobSet, jobIndex + 1, frameSize, schedule)) {
+      return true;
+    }
+    schedule.frameSizes[frame]--;
+    schedule.frameLoads[frame] = std::chrono::microseconds(load);
+  }
+  return false;
+}
+
+}  // namespace schedule_synthesizer
+
+// Synthesize a cyclic executive schedule for a set of periodic tasks (deadlines
+// equal periods). The largest valid minor cycle for which all jobs of the
+// hyperperiod can be packed into frames is selected. If no such minor cycle
+// exists, the returned schedule is marked as not feasible and callers are
+// expected to static_assert on isFeasible.
+template <uint16_t MaxNbrOfFrames, uint16_t MaxFrameSize, uint8_t NbrOfTasks>
+constexpr CyclicSchedule<NbrOfTasks, MaxNbrOfFrames, MaxFrameSize> synthesizeSchedule(
+    const std::chrono::microseconds (&periods)[NbrOfTasks],
+    const std::chrono::microseconds (&computationTimes)[NbrOfTasks]) {
+  using Schedule = CyclicSchedule<NbrOfTasks, MaxNbrOfFrames, MaxFrameSize>;
+  constexpr uint16_t kMaxJobs = MaxNbrOfFrames * MaxFrameSize;
+
+  int64_t hyperperiod = 1;
+  for (uint8_t taskIndex = 0; taskIndex < NbrOfTasks; taskIndex++) {
+    hyperperiod = schedule_synthesizer::lcm(hyperperiod, periods[taskIndex].count());
+  }
+
+  const auto jobSet =
+      schedule_synthesizer::buildJobSet<kMaxJobs>(hyperperiod, periods, computationTimes);
+  if (jobSet.overflow) {
+    return Schedule();
+  }
+
+  // try the largest frames first (fewest timer interrupts)
+  for (uint16_t nbrOfFrames = 1; nbrOfFrames <= MaxNbrOfFrames; nbrOfFrames++) {
+    if (hyperperiod % nbrOfFrames != 0) {
+      continue;
+    }
+    const int64_t frameSize = hyperperiod / nbrOfFrames;
+    if (!schedule_synthesizer::isValidFrameSize<NbrOfTasks>(
+            frameSize, hyperperiod, periods, computationTimes)) {
+      continue;
+    }
+    Schedule schedule;
+    schedule.hyperperiod = std::chrono::microseconds(hyperperiod);
+    schedule.minorCycle  = std::chrono::microseconds(frameSize);
+    schedule.nbrOfFrames = nbrOfFrames;
+    if (schedule_synthesizer::packJobs(jobSet, 0, frameSize, schedule)) {
+      schedule.isFeasible = true;
+      return schedule;
+    }
+  }
+  return Schedule();
+}
+
+}  // namespace bike_computer
@@ -0,0 +1,272 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file sensor_device.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief SensorDevice implementation
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+
+#include "sensor_device.hpp"
+
+// zephyr
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/logging/log.h>
+
+// zpp_lib
+#include "zpp_include/clock.hpp"
+#include "zpp_include/time.hpp"
+
+LOG_MODULE_DECLARE(bike_computer, CONFIG_APP_LOG_LEVEL);
+
+namespace bike_computer {
+
+SensorDevice::SensorDevice() {
+  k_work_init(&_work, &SensorDevice::_workHandler);
+  k_timer_init(&_timer, &SensorDevice::_timerHandler, nullptr);
+  // specify this instance as user data
+  // cppcheck-suppress cstyleCast
+  _timer.user_data = (void*)this;  // NOLINT(readability/casting)
+}
+
+SensorDevice::~SensorDevice() {
+  // the timer and the work item must not refer to this instance once destroyed
+  stopStreaming();
+  struct k_work_sync sync;
+  k_work_cancel_sync(&_work, &sync);
+}
+
+zpp_lib::ZephyrResult SensorDevice::initialize() {
+  zpp_lib::ZephyrResult res;
+#if DT_HAS_ALIAS(ambient_temp0)
+  _sensorDevice = DEVICE_DT_GET(DT_ALIAS(ambient_temp0));
+#endif  // DT_HAS_ALIAS(ambient_temp0)
+  if (_sensorDevice == nullptr || !device_is_ready(_sensorDevice)) {
+    _sensorDevice = nullptr;
+    res.assign_error(zpp_lib::ZephyrErrorCode::k_nodev);
+  }
+  return res;
+}
+
+zpp_lib::ZephyrResult SensorDevice::requestSample() {
+  zpp_lib::ZephyrResult res;
+  if (_sensorDevice == nullptr) {
+    res.assign_error(zpp_lib::ZephyrErrorCode::k_nodev);
+    return res;
+  }
+  // a request made while a fetch is pending is served by that fetch
+  const int ret = k_work_submit(&_work);
+  if (ret < 0) {
+    LOG_ERR("Cannot submit sensor work: %d", ret);
+    res.assign_error(zpp_lib::ZephyrErrorCode::k_busy);
+  }
+  return res;
+}
+
+zpp_lib::ZephyrResult SensorDevice::getSample(
+    SensorSample& sample, const std::chrono::microseconds& maxAge) const {
+  zpp_lib::ZephyrResult res;
+  if (_sample.getNbrOfPublications() == 0) {
+    res.assign_error(zpp_lib::ZephyrErrorCode::k_again);
+    return res;
+  }
+  sample = _sample.read();
+  if (zpp_lib::Time::getUpTime() - sample.time > maxAge) {
+    res.assign_error(zpp_lib::ZephyrErrorCode::k_again);
+  }
+  return res;
+}
+
+zpp_lib::ZephyrResult SensorDevice::readTemperature(float& temperature) {
+  SensorSample sample;
+  auto res = getRecentSample(sample);
+  if (res) {
+    temperature = sample.temperature;
+  }
+  return res;
+}
+
+zpp_lib::ZephyrResult SensorDevice::readHumidity(float& humidity) {
+  SensorSample sample;
+  auto res = getRecentSample(sample);
+  if (res && !sample.hasHumidity) {
+    res.assign_error(zpp_lib::ZephyrErrorCode::k_inval);
+  }
+  if (res) {
+    humidity = sample.humidity;
+  }
+  return res;
+}
+
+uint32_t SensorDevice::getNbrOfFetches() const {
+  return static_cast<uint32_t>(atomic_get(&_nbrOfFetches));
+}
+
+zpp_lib::ZephyrResult SensorDevice::startStreaming(
+    const std::chrono::milliseconds& samplingPeriod, uint8_t decimationFactor) {
+  zpp_lib::ZephyrResult res;
+  if (_sensorDevice == nullptr) {
+    res.assign_error(zpp_lib::ZephyrErrorCode::k_nodev);
+    return res;
+  }
+  if (decimationFactor == 0 || samplingPeriod <= std::chrono::milliseconds::zero() ||
+      atomic_get(&_isStreaming) != 0) {
+    res.assign_error(zpp_lib::ZephyrErrorCode::k_inval);
+    return res;
+  }
+
+  _decimationFactor     = decimationFactor;
+  _nbrOfFilteredSamples = 0;
+  _hasFilteredSample    = false;
+  _temperatureFilter.reset();
+  _humidityFilter.reset();
+  _pressureFilter.reset();
+  // drop the samples queued in a previous streaming session
+  SensorSample sample;
+  while (_ring.pop(sample)) {
+  }
+
+  atomic_set(&_isStreaming, 1);
+  const k_timeout_t period = zpp_lib::milliseconds_to_ticks(samplingPeriod);
+  k_timer_start(&_timer, period, period);
+  return res;
+}
+
+void SensorDevice::stopStreaming() {
+  k_timer_stop(&_timer);
+  atomic_set(&_isStreaming, 0);
+}
+
+zpp_lib::ZephyrResult SensorDevice::readFilteredSample(SensorSample& sample) {
+  // filter all queued samples and keep the last decimated output
+  SensorSample rawSample;
+  while (_ring.pop(rawSample)) {
+    SensorSample filteredSample = rawSample;
+    filteredSample.temperature  = _temperatureFilter.update(rawSample.temperature);
+    if (rawSample.hasHumidity) {
+      filteredSample.humidity = _humidityFilter.update(rawSample.humidity);
+    }
+    if (rawSample.hasPressure) {
+      filteredSample.pressure = _pressureFilter.update(rawSample.pressure);
+    }
+    _nbrOfFilteredSamples++;
+    if (_nbrOfFilteredSamples == _decimationFactor) {
+      _nbrOfFilteredSamples = 0;
+      _filteredSample       = filteredSample;
+      _hasFilteredSample    = true;
+    }
+  }
+
+  zpp_lib::ZephyrResult res;
+  if (!_hasFilteredSample) {
+    res.assign_error(zpp_lib::ZephyrErrorCode::k_again);
+    return res;
+  }
+  sample = _filteredSample;
+  return res;
+}
+
+uint32_t SensorDevice::getNbrOfDroppedSamples() const {
+  return _ring.getNbrOfOverflows();
+}
+
+void SensorDevice::_timerHandler(struct k_timer* timer) {
+  // get instance from user data
+  // cppcheck-suppress cstyleCast
+  SensorDevice* pSensorDevice =
+      (SensorDevice*)timer->user_data;  // NOLINT(readability/casting)
+  // the fetch is done by the work item, since it may block on bus transfers
+  k_work_submit(&pSensorDevice->_work);
+}
+
+void SensorDevice::_workHandler(struct k_work* item) {
+  // this ugly casting is the simplest way of getting the information
+  // we need in the _workHandler method
+  // CASTING IS POSSIBLE ONLY WHEN k_work IS THE FIRST ATTRIBUTE IN THE CLASS
+  // cppcheck-suppress dangerousTypeCast
+  SensorDevice* pSensorDevice = (SensorDevice*)item;  // NOLINT(readability/casting)
+
+  SensorSample sample;
+  auto res = pSensorDevice->readSample(sample);
+  atomic_inc(&pSensorDevice->_nbrOfFetches);
+  if (!res) {
+    LOG_ERR("Cannot read sensor sample: %d", (int)res.error());
+    return;
+  }
+  pSensorDevice->_sample.publish(sample);
+  if (atomic_get(&pSensorDevice->_isStreaming) != 0) {
+    // samples are dropped (and counted) when the consumer does not keep up
+    pSensorDevice->_ring.push(sample);
+  }
+}
+
+zpp_lib::ZephyrResult SensorDevice::getRecentSample(SensorSample& sample) {
+  auto res = getSample(sample, kMaxSampleAge);
+  if (res) {
+    return res;
+  }
+  res = requestSample();
+  if (!res) {
+    return res;
+  }
+  // wait for the fetch to complete
+  struct k_work_sync sync;
+  k_work_flush(&_work, &sync);
+  res = getSample(sample, kMaxSampleAge);
+  if (!res) {
+    res.assign_error(zpp_lib::ZephyrErrorCode::k_io);
+  }
+  return res;
+}
+
+zpp_lib::ZephyrResult SensorDevice::readSample(SensorSample& sample) {
+  zpp_lib::ZephyrResult res;
+  // fetch all channels in a single bus transaction
+  int ret = sensor_sample_fetch(_sensorDevice);
+  if (ret != 0) {
+    res.assign_error(zpp_lib::ZephyrErrorCode::k_io);
+    return res;
+  }
+  sample.time = zpp_lib::Time::getUpTime();
+
+  struct sensor_value value;
+  ret = sensor_channel_get(_sensorDevice, SENSOR_CHAN_AMBIENT_TEMP, &value);
+  if (ret != 0) {
+    res.assign_error(zpp_lib::ZephyrErrorCode::k_io);
+    return res;
+  }
+  sample.temperature = sensor_value_to_float(&value);
+
+  // humidity and pressure are not supported by all sensors
+  ret                = sensor_channel_get(_sensorDevice, SENSOR_CHAN_HUMIDITY, &value);
+  sample.hasHumidity = ret == 0;
+  if (sample.hasHumidity) {
+    sample.humidity = sensor_value_to_float(&value);
+  }
+  ret                = sensor_channel_get(_sensorDevice, SENSOR_CHAN_PRESS, &value);
+  sample.hasPressure = ret == 0;
+  if (sample.hasPressure) {
+    sample.pressure = sensor_value_to_float(&value);
+  }
+  return res;
+}
+
+}  // namespace bike_computer
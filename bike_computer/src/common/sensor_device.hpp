@@ -27,27 +27,117 @@
 // zephyr
 #include <zephyr/kernel.h>
 
+// std
+#include <chrono>
+
+// local
+#include "sensor_filter.hpp"
+#include "snapshot_channel.hpp"
+#include "spsc_ring.hpp"
+
 // zpp_lib
 #include "zpp_include/non_copyable.hpp"
 #include "zpp_include/zephyr_result.hpp"
 
 namespace bike_computer {
 
+// measurements of all sensor channels, converted from a single sample fetch
+struct SensorSample {
+  // time at which the sample was fetched
+  std::chrono::microseconds time = std::chrono::microseconds::zero();
+  // temperature expressed in degrees Celsius
+  float temperature = 0.0f;
+  // relative humidity expressed in percents (if supported by the sensor)
+  float humidity   = 0.0f;
+  bool hasHumidity = false;
+  // pressure expressed in kPa (if supported by the sensor)
+  float pressure   = 0.0f;
+  bool hasPressure = false;
+};
+
+// The sensor is read asynchronously: requestSample() submits a work item that
+// fetches all channels once and caches the converted sample, so that the caller
+// does not wait for the bus transfers and for the sensor conversion time.
+// Measurements are then served from the cached sample, as long as it is not
+// older than the requested maximal age.
+// In streaming mode, a timer requests samples periodically and the samples are
+// also queued, so that they can be filtered and decimated at the consumer rate.
 class SensorDevice : private zpp_lib::NonCopyable<SensorDevice> {
  public:
   // constructor
-  SensorDevice() = default;
+  SensorDevice();
+  // destructor, stops streaming and waits for a pending fetch to complete
+  ~SensorDevice();
 
   // method for initializing the device
   [[nodiscard]] zpp_lib::ZephyrResult initialize();
 
+  // method used for requesting a new sample (returns immediately)
+  [[nodiscard]] zpp_lib::ZephyrResult requestSample();
+
+  // method used for getting the last sample, fails with k_again if no sample was
+  // fetched during the last maxAge
+  [[nodiscard]] zpp_lib::ZephyrResult getSample(
+      SensorSample& sample, const std::chrono::microseconds& maxAge) const;
+
   // methods used for reading sensor measurements
+  // a new sample is fetched (and waited for) only if the cached sample is older
+  // than kMaxSampleAge
   [[nodiscard]] zpp_lib::ZephyrResult readTemperature(float& temperature);
   [[nodiscard]] zpp_lib::ZephyrResult readHumidity(float& humidity);
 
+  // number of sample fetches (successful or not) done so far
+  uint32_t getNbrOfFetches() const;
+
+  // methods used for starting/stopping the streaming mode: all channels are
+  // fetched every samplingPeriod and the samples are queued in a ring
+  [[nodiscard]] zpp_lib::ZephyrResult startStreaming(
+      const std::chrono::milliseconds& samplingPeriod, uint8_t decimationFactor);
+  void stopStreaming();
+
+  // method used for getting the filtered sample in streaming mode
+  // the queued samples are filtered (median of kMedianSize followed by an IIR
+  // filter) and one filtered sample is produced every decimationFactor samples
+  // fails with k_again if no filtered sample is available yet
+  // must be called from a single thread
+  [[nodiscard]] zpp_lib::ZephyrResult readFilteredSample(SensorSample& sample);
+
+  // number of samples dropped because the ring was full
+  uint32_t getNbrOfDroppedSamples() const;
+
+  static constexpr std::chrono::milliseconds kMaxSampleAge =
+      std::chrono::milliseconds(1000);
+  // streaming mode parameters
+  static constexpr uint16_t kStreamRingSize = 32;
+  static constexpr uint8_t kMedianSize      = 3;
+  static constexpr float kIirAlpha          = 0.25f;
+
  private:
+  // private methods
+  static void _workHandler(struct k_work* item);
+  static void _timerHandler(struct k_timer* timer);
+  [[nodiscard]] zpp_lib::ZephyrResult getRecentSample(SensorSample& sample);
+  [[nodiscard]] zpp_lib::ZephyrResult readSample(SensorSample& sample);
+
   // data members
+  // CASTING IN _workHandler IS POSSIBLE ONLY WHEN k_work IS THE FIRST ATTRIBUTE
+  struct k_work _work;
   const struct device* _sensorDevice = nullptr;
+  // written by the work item only
+  SnapshotChannel<SensorSample> _sample;
+  atomic_t _nbrOfFetches = ATOMIC_INIT(0);
+
+  // streaming mode (the ring is filled by the work item)
+  struct k_timer _timer;
+  atomic_t _isStreaming         = ATOMIC_INIT(0);
+  uint8_t _decimationFactor     = 1;
+  uint8_t _nbrOfFilteredSamples = 0;
+  bool _hasFilteredSample       = false;
+  SpscRing<SensorSample, kStreamRingSize> _ring;
+  ChannelFilter<kMedianSize> _temperatureFilter{kIirAlpha};
+  ChannelFilter<kMedianSize> _humidityFilter{kIirAlpha};
+  ChannelFilter<kMedianSize> _pressureFilter{kIirAlpha};
+  SensorSample _filteredSample;
 };
 
 }  // namespace bike_computer
@@ -0,0 +1,120 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file sensor_filter.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Incremental filters for denoising sensor measurements
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+
+#pragma once
+
+// std
+#include <cstdint>
+
+namespace bike_computer {
+
+// Median of the last N values, used for removing isolated outliers.
+// The values are kept in a ring and sorted on each update (N is small).
+template <uint8_t N>
+class MedianFilter {
+  static_assert(N > 0 && N % 2 == 1, "N must be odd");
+
+ public:
+  float update(float value) {
+    _values[_head] = value;
+    _head          = (_head + 1) % N;
+    if (_nbrOfValues < N) {
+      _nbrOfValues++;
+    }
+
+    // insertion sort of the values received so far
+    float sortedValues[N] = {};
+    for (uint8_t i = 0; i < _nbrOfValues; i++) {
+      const float v = _values[i];
+      uint8_t j     = i;
+      while (j > 0 && sortedValues[j - 1] > v) {
+        sortedValues[j] = sortedValues[j - 1];
+        j--;
+      }
+      sortedValues[j] = v;
+    }
+    // while warming up with an even number of values, neither middle value may be
+    // trusted more than the other: return their mean
+    if (_nbrOfValues % 2 == 0) {
+      return (sortedValues[_nbrOfValues / 2 - 1] + sortedValues[_nbrOfValues / 2]) / 2.0f;
+    }
+    return sortedValues[_nbrOfValues / 2];
+  }
+
+  void reset() {
+    _head        = 0;
+    _nbrOfValues = 0;
+  }
+
+ private:
+  float _values[N]     = {};
+  uint8_t _head        = 0;
+  uint8_t _nbrOfValues = 0;
+};
+
+// First order IIR (exponential moving average) low-pass filter:
+// y[n] = y[n-1] + alpha * (x[n] - y[n-1]), initialized with the first value
+class IirFilter {
+ public:
+  explicit IirFilter(float alpha) : _alpha(alpha) {}
+
+  float update(float value) {
+    if (!_isInitialized) {
+      _output        = value;
+      _isInitialized = true;
+    } else {
+      _output += _alpha * (value - _output);
+    }
+    return _output;
+  }
+
+  void reset() { _isInitialized = false; }
+
+ private:
+  const float _alpha;
+  float _output       = 0.0f;
+  bool _isInitialized = false;
+};
+
+// Median filter followed by an IIR filter: outliers are removed before they
+// can disturb the moving average
+template <uint8_t MedianSize>
+class ChannelFilter {
+ public:
+  explicit ChannelFilter(float alpha) : _iirFilter(alpha) {}
+
+  float update(float value) { return _iirFilter.update(_medianFilter.update(value)); }
+
+  void reset() {
+    _medianFilter.reset();
+    _iirFilter.reset();
+  }
+
+ private:
+  MedianFilter<MedianSize> _medianFilter;
+  IirFilter _iirFilter;
+};
+
+}  // namespace bike_computer
@@ -0,0 +1,88 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file snapshot_channel.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Lock-free channel for publishing state snapshots between tasks
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// zephyr
+#include <zephyr/kernel.h>
+#include <zephyr/sys/barrier.h>
+
+// zpp_lib
+#include "zpp_include/non_copyable.hpp"
+
+namespace bike_computer {
+
+// Double-buffered sequence lock: a single producer publishes values of type T
+// and any number of consumers read consistent snapshots without locking.
+// The sequence number is incremented when a write starts and when it ends.
+// Version v (sequence 2v or 2v+1) is stored in buffer v % 2, so a reader never
+// waits for a producer preempted in the middle of a write: it reads the last
+// completed version and retries only if two new writes started in the meantime.
+// T must be trivially copyable.
+template <typename T>
+class SnapshotChannel : private zpp_lib::NonCopyable<SnapshotChannel<T>> {
+ public:
+  SnapshotChannel() = default;
+  explicit SnapshotChannel(const T& initialValue) {
+    _buffers[0] = initialValue;
+    _buffers[1] = initialValue;
+  }
+
+  // producer side (must be called from a single thread)
+  void publish(const T& value) {
+    const uint32_t sequence = static_cast<uint32_t>(atomic_get(&_sequence));
+    atomic_set(&_sequence, static_cast<atomic_val_t>(sequence + 1));
+    barrier_dmem_fence_full();
+    _buffers[((sequence / 2) + 1) % 2] = value;
+    barrier_dmem_fence_full();
+    atomic_set(&_sequence, static_cast<atomic_val_t>(sequence + 2));
+  }
+
+  // consumer side (may be called from any thread)
+  T read() const {
+    while (true) {
+      const uint32_t sequence = static_cast<uint32_t>(atomic_get(&_sequence));
+      const uint32_t version  = sequence / 2;
+      T value                 = _buffers[version % 2];
+      barrier_dmem_fence_full();
+      // the buffer is overwritten by the write of version + 2, that starts
+      // when the sequence reaches 2 * version + 3
+      const uint32_t newSequence = static_cast<uint32_t>(atomic_get(&_sequence));
+      if (newSequence - 2 * version < 3) {
+        return value;
+      }
+    }
+  }
+
+  // number of values published so far
+  uint32_t getNbrOfPublications() const {
+    return static_cast<uint32_t>(atomic_get(&_sequence)) / 2;
+  }
+
+ private:
+  T _buffers[2]      = {};
+  atomic_t _sequence = ATOMIC_INIT(0);
+};
+
+}  // namespace bike_computer
@@ -0,0 +1,137 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file speed_history.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Fixed-size history of speedometer samples with rolling statistics
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+
+#pragma once
+
+// std
+#include <chrono>
+#include <cstdint>
+
+// zpp_lib
+#include "zpp_include/non_copyable.hpp"
+
+namespace bike_computer {
+
+// sample taken periodically by the speedometer
+struct SpeedSample {
+  std::chrono::microseconds time = std::chrono::microseconds::zero();
+  // speed expressed in m / h
+  uint32_t speed = 0;
+  // distance expressed in um
+  uint64_t distance                           = 0;
+  std::chrono::milliseconds pedalRotationTime = std::chrono::milliseconds::zero();
+};
+
+// statistics computed over the samples of the history
+struct SpeedStatistics {
+  uint16_t nbrOfSamples = 0;
+  // speeds expressed in m / h (max speed since the history was cleared)
+  uint32_t speed        = 0;
+  uint32_t averageSpeed = 0;
+  uint32_t maxSpeed     = 0;
+  // distance expressed in m
+  uint32_t distance = 0;
+  // average cadence expressed in pedal turns / min
+  uint32_t cadence = 0;
+};
+
+// Ring buffer of the last Size samples. The sums used for the rolling averages
+// are updated when a sample is added and when the oldest one is overwritten, so
+// that adding a sample and computing the statistics are O(1).
+// Must be used from a single thread.
+template <uint16_t Size>
+class SpeedHistory : private zpp_lib::NonCopyable<SpeedHistory<Size>> {
+  static_assert(Size > 0, "Size must be positive");
+
+ public:
+  SpeedHistory() = default;
+
+  void addSample(const SpeedSample& sample) {
+    if (_nbrOfSamples == Size) {
+      // the oldest sample is overwritten
+      const SpeedSample& oldestSample = _samples[_head];
+      _speedSum -= oldestSample.speed;
+      _cadenceSum -= getCadence(oldestSample);
+    } else {
+      _nbrOfSamples++;
+    }
+    _samples[_head] = sample;
+    _head           = (_head + 1) % Size;
+    _speedSum += sample.speed;
+    _cadenceSum += getCadence(sample);
+    if (sample.speed > _maxSpeed) {
+      _maxSpeed = sample.speed;
+    }
+  }
+
+  void clear() {
+    _head         = 0;
+    _nbrOfSamples = 0;
+    _speedSum     = 0;
+    _cadenceSum   = 0;
+    _maxSpeed     = 0;
+  }
+
+  SpeedStatistics computeStatistics() const {
+    SpeedStatistics statistics;
+    statistics.nbrOfSamples = _nbrOfSamples;
+    if (_nbrOfSamples == 0) {
+      return statistics;
+    }
+    const SpeedSample& lastSample = getSample(_nbrOfSamples - 1);
+    statistics.speed              = lastSample.speed;
+    statistics.averageSpeed       = static_cast<uint32_t>(_speedSum / _nbrOfSamples);
+    statistics.maxSpeed           = _maxSpeed;
+    statistics.distance           = static_cast<uint32_t>(lastSample.distance / 1000000);
+    statistics.cadence =
+        static_cast<uint32_t>((_cadenceSum / _nbrOfSamples + 500) / 1000);
+    return statistics;
+  }
+
+  uint16_t getNbrOfSamples() const { return _nbrOfSamples; }
+  static constexpr uint16_t getCapacity() { return Size; }
+
+  // samples are indexed from the oldest (0) to the most recent one
+  const SpeedSample& getSample(uint16_t index) const {
+    return _samples[(_head + Size - _nbrOfSamples + index) % Size];
+  }
+
+ private:
+  // cadence of a sample expressed in 1/1000 pedal turns / min
+  static uint64_t getCadence(const SpeedSample& sample) {
+    const uint64_t pedalRotationTime =
+        static_cast<uint64_t>(sample.pedalRotationTime.count());
+    return pedalRotationTime == 0 ? 0 : 60000000 / pedalRotationTime;
+  }
+
+  SpeedSample _samples[Size] = {};
+  uint16_t _head             = 0;
+  uint16_t _nbrOfSamples     = 0;
+  uint64_t _speedSum         = 0;
+  uint64_t _cadenceSum       = 0;
+  uint32_t _maxSpeed         = 0;
+};
+
+}  // namespace bike_computer
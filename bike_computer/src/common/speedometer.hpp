@@ -24,27 +24,31 @@
 
 #pragma once
 
+// zephyr
+#include <zephyr/kernel.h>
+
 // std
 #include <chrono>
+#include <cstdint>
+#include <functional>
 
 // local
 #include "constants.hpp"
+#include "snapshot_channel.hpp"
+#include "speed_history.hpp"
 
 // zpp_lib
-#include "zpp_include/mutex.hpp"
 #include "zpp_include/non_copyable.hpp"
 #include "zpp_include/thread.hpp"
-
-// stl
-#if CONFIG_TEST == 1
-#include <functional>
-#endif  // CONFIG_TEST == 1
+#include "zpp_include/zephyr_result.hpp"
 
 namespace bike_computer {
 
 class Speedometer : private zpp_lib::NonCopyable<Speedometer> {
  public:
   Speedometer();
+  // destructor, stops the sampling thread that refers to this instance
+  ~Speedometer();
 
   // method used for setting the current pedal rotation time
   void setCurrentRotationTime(const std::chrono::milliseconds& currentRotationTime);
@@ -56,11 +60,31 @@ class Speedometer : private zpp_lib::NonCopyable<Speedometer> {
   float getCurrentSpeed() const;
 
   // method called for getting the current traveled distance (expressed in km)
-  float getDistance();
+  // (lock-free, may be called concurrently with the other methods)
+  float getDistance() const;
 
   // method called for resetting the traveled distance
   void reset();
 
+  // sources of the pedal rotation time and of the gear size used in sampling mode
+  using RotationTimeSource = std::function<std::chrono::milliseconds()>;
+  using GearSizeSource     = std::function<uint8_t()>;
+
+  // methods used for starting/stopping the sampling mode: a low priority thread
+  // samples the pedal rotation time and the gear size every kSamplingPeriod and
+  // records the speed and distance in a history
+  [[nodiscard]] zpp_lib::ZephyrResult startSampling(
+      const RotationTimeSource& rotationTimeSource, const GearSizeSource& gearSizeSource);
+  void stopSampling();
+
+  // method called for getting the statistics computed over the sampling history
+  // (lock-free, may be called concurrently with the other methods)
+  SpeedStatistics getStatistics() const;
+
+  // sampling period and history size (the history covers 6.4 s)
+  static constexpr std::chrono::milliseconds kSamplingPeriod = 100ms;
+  static constexpr uint16_t kHistorySize                     = 64;
+
   // methods used for tests only
 #if CONFIG_TEST == 1
   uint8_t getGearSize() const;
@@ -71,29 +95,54 @@ class Speedometer : private zpp_lib::NonCopyable<Speedometer> {
 #endif  // CONFIG_TEST == 1
 
  private:
+  // state of the distance computation: writers commit a complete state and
+  // readers extrapolate the distance from the last committed state
+  struct DistanceState {
+    // time of the last commit
+    std::chrono::microseconds time = std::chrono::microseconds::zero();
+    // distance is expressed in um, the remainder accumulates the fractions of um
+    // (expressed in um * us / pedal rotation time) so that no distance is lost
+    uint64_t distance  = 0;
+    uint64_t remainder = 0;
+    // distance run with one pedal turn, expressed in um
+    uint32_t distancePerPedalTurn               = 0;
+    std::chrono::milliseconds pedalRotationTime = kInitialPedalRotationTime;
+    // speed is expressed in m / h
+    uint32_t speed   = 0;
+    uint8_t gearSize = 1;
+  };
+
   // private methods
-  void computeSpeed();
-  void computeDistance();
+  static void computeSpeed(DistanceState& state);
+  static void computeDistance(DistanceState& state,
+                              const std::chrono::microseconds& currentTime);
+  static uint32_t getDistancePerPedalTurn(uint8_t gearSize);
+  void runSampling();
 
   // definition of task period time
   static constexpr std::chrono::milliseconds kTaskPeriod = 400ms;
   // definition of task execution time
   static constexpr std::chrono::microseconds kTaskRunTime = 200000us;
 
-  // constants related to speed computation
-  static constexpr float kWheelCircumference   = 2.1f;
-  static constexpr uint8_t kTraySize           = 50;
-  std::chrono::microseconds _lastTime          = std::chrono::microseconds::zero();
-  std::chrono::milliseconds _pedalRotationTime = kInitialPedalRotationTime;
+  // constants related to speed computation (wheel circumference expressed in um)
+  static constexpr uint32_t kWheelCircumference = 2100000;
+  static constexpr uint8_t kTraySize            = 50;
 
   // data members
-  // LowPowerTicker _ticker;
-  float _currentSpeed = 0.0f;
-  zpp_lib::Mutex _totalDistanceMutex;
-  float _totalDistance = 0.0f;
-  uint8_t _gearSize    = 1;
-
+  SnapshotChannel<DistanceState> _distanceState;
+  // serializes the writers of the distance state (speed and reset tasks), readers
+  // never take this lock
+  struct k_spinlock _distanceStateLock;
+
+  // sampling mode (the history is only accessed by the sampling thread)
+  static constexpr uint8_t kSamplingStopBit = 0;
+  atomic_t _samplingFlags                   = ATOMIC_INIT(0x00);
   zpp_lib::Thread _thread;
+  bool _isSampling = false;
+  RotationTimeSource _rotationTimeSource;
+  GearSizeSource _gearSizeSource;
+  SpeedHistory<kHistorySize> _history;
+  SnapshotChannel<SpeedStatistics> _statistics;
 
 #if CONFIG_TEST == 1
   std::function<void()> _cb;
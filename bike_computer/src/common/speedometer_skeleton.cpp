@@ -25,54 +25,117 @@
 #include "speedometer.hpp"
 
 // zephyr
+#include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 
 // std
 #include <chrono>
+#include <cstdint>
+#include <functional>
 #include <ratio>
 
 // zpp_lib
 #include "zpp_include/time.hpp"
 
+// local
+#include "absolute_time.hpp"
+
 LOG_MODULE_DECLARE(bike_computer, CONFIG_APP_LOG_LEVEL);
 
 namespace bike_computer {
 
-Speedometer::Speedometer() : _lastTime(zpp_lib::Time::getUpTime()) {}
+namespace {
+
+// distance run with one pedal turn for each gear size, expressed in um
+struct DistancePerPedalTurnTable {
+  uint32_t distances[kMaxGearSize - kMinGearSize + 1] = {};
+};
+
+constexpr uint32_t computeDistancePerPedalTurn(uint32_t traySize,
+                                               uint32_t wheelCircumference,
+                                               uint8_t gearSize) {
+  // rounded to the nearest um
+  return (traySize * wheelCircumference + gearSize / 2) / gearSize;
+}
+
+constexpr DistancePerPedalTurnTable makeDistancePerPedalTurnTable(
+    uint32_t traySize, uint32_t wheelCircumference) {
+  DistancePerPedalTurnTable table;
+  for (uint8_t gearSize = kMinGearSize; gearSize <= kMaxGearSize; gearSize++) {
+    table.distances[gearSize - kMinGearSize] =
+        computeDistancePerPedalTurn(traySize, wheelCircumference, gearSize);
+  }
+  return table;
+}
+
+}  // namespace
+
+Speedometer::Speedometer()
+    : _thread(zpp_lib::PreemptableThreadPriority::PriorityLow, "Speedometer") {
+  DistanceState state;
+  state.time                 = zpp_lib::Time::getUpTime();
+  state.distancePerPedalTurn = getDistancePerPedalTurn(state.gearSize);
+  computeSpeed(state);
+  _distanceState.publish(state);
+}
+
+Speedometer::~Speedometer() { stopSampling(); }
 
 void Speedometer::setCurrentRotationTime(
     const std::chrono::milliseconds& currentRotationTime) {
-  if (_pedalRotationTime != currentRotationTime) {
+  k_spinlock_key_t key = k_spin_lock(&_distanceStateLock);
+  DistanceState state  = _distanceState.read();
+  if (state.pedalRotationTime != currentRotationTime) {
     // compute distance before changing the rotation time
-    computeDistance();
+    computeDistance(state, zpp_lib::Time::getUpTime());
+
+    // the remainder of the distance is expressed relatively to the pedal
+    // rotation time and must be rescaled
+    state.remainder = state.remainder *
+                      static_cast<uint64_t>(currentRotationTime.count()) /
+                      static_cast<uint64_t>(state.pedalRotationTime.count());
 
     // change pedal rotation time
-    _pedalRotationTime = currentRotationTime;
+    state.pedalRotationTime = currentRotationTime;
 
     // compute speed with the new pedal rotation time
-    computeSpeed();
+    computeSpeed(state);
+    _distanceState.publish(state);
   }
+  k_spin_unlock(&_distanceStateLock, key);
 }
 
 void Speedometer::setGearSize(uint8_t gearSize) {
-  if (_gearSize != gearSize) {
+  k_spinlock_key_t key = k_spin_lock(&_distanceStateLock);
+  DistanceState state  = _distanceState.read();
+  if (state.gearSize != gearSize) {
     // compute distance before chaning the gear size
-    computeDistance();
+    computeDistance(state, zpp_lib::Time::getUpTime());
 
     // change gear size
-    _gearSize = gearSize;
+    state.gearSize             = gearSize;
+    state.distancePerPedalTurn = getDistancePerPedalTurn(gearSize);
 
     // compute speed with the new gear size
-    computeSpeed();
+    computeSpeed(state);
+    _distanceState.publish(state);
   }
+  k_spin_unlock(&_distanceStateLock, key);
+}
+
+float Speedometer::getCurrentSpeed() const {
+  // convert from m / h to km / h
+  return static_cast<float>(_distanceState.read().speed) / 1000.0f;
 }
 
-float Speedometer::getCurrentSpeed() const { return _currentSpeed; }
+float Speedometer::getDistance() const {
+  // extrapolate the distance traveled since the last committed state
+  DistanceState state = _distanceState.read();
+  computeDistance(state, zpp_lib::Time::getUpTime());
 
-float Speedometer::getDistance() {
-  // make sure to update the distance traveled
-  computeDistance();
-  return _totalDistance;
+  // convert to mm before converting to float for keeping the float precision
+  // for the conversion from mm to km
+  return static_cast<float>(state.distance / 1000) / 1000000.0f;
 }
 
 void Speedometer::reset() {
@@ -82,36 +145,85 @@ void Speedometer::reset() {
   }
 #endif  // CONFIG_TEST == 1
 
-  // TODO
+  k_spinlock_key_t key = k_spin_lock(&_distanceStateLock);
+  DistanceState state  = _distanceState.read();
+  state.time           = zpp_lib::Time::getUpTime();
+  state.distance       = 0;
+  state.remainder      = 0;
+  _distanceState.publish(state);
+  k_spin_unlock(&_distanceStateLock, key);
 }
 
+zpp_lib::ZephyrResult Speedometer::startSampling(
+    const RotationTimeSource& rotationTimeSource, const GearSizeSource& gearSizeSource) {
+  zpp_lib::ZephyrResult res;
+  if (_isSampling) {
+    LOG_ERR("Speedometer sampling already started");
+    res.assign_error(zpp_lib::ZephyrErrorCode::k_inval);
+    return res;
+  }
+  _rotationTimeSource = rotationTimeSource;
+  _gearSizeSource     = gearSizeSource;
+  _history.clear();
+  atomic_clear_bit(&_samplingFlags, kSamplingStopBit);
+  res = _thread.start(std::bind(&Speedometer::runSampling, this));
+  if (!res) {
+    LOG_ERR("Cannot start speedometer sampling thread: %d", (int)res.error());
+    return res;
+  }
+  _isSampling = true;
+  return res;
+}
+
+void Speedometer::stopSampling() {
+  if (!_isSampling) {
+    return;
+  }
+  atomic_set_bit(&_samplingFlags, kSamplingStopBit);
+  auto res = _thread.join();
+  if (!res) {
+    LOG_ERR("Cannot join speedometer sampling thread: %d", (int)res.error());
+  }
+  _isSampling = false;
+}
+
+SpeedStatistics Speedometer::getStatistics() const { return _statistics.read(); }
+
 #if CONFIG_TEST == 1
-uint8_t Speedometer::getGearSize() const { return _gearSize; }
+uint8_t Speedometer::getGearSize() const { return _distanceState.read().gearSize; }
 
-float Speedometer::getWheelCircumference() const { return kWheelCircumference; }
+float Speedometer::getWheelCircumference() const {
+  // convert from um to m
+  return static_cast<float>(kWheelCircumference) / 1000000.0f;
+}
 
 float Speedometer::getTraySize() const { return kTraySize; }
 
 std::chrono::milliseconds Speedometer::getCurrentPedalRotationTime() const {
-  return _pedalRotationTime;
+  return _distanceState.read().pedalRotationTime;
 }
 
 void Speedometer::setOnResetCallback(std::function<void()> cb) { _cb = cb; }
 
 #endif  // CONFIG_TEST == 1
 
-void Speedometer::computeSpeed() {
+void Speedometer::computeSpeed(DistanceState& state) {
   // For computing the speed given a rear gear (braquet), one must divide the size of
   // the tray (plateau) by the size of the rear gear (pignon arrière), and then multiply
   // the result by the circumference of the wheel. Example: tray = 50, rear gear = 15.
   // Distance run with one pedal turn (wheel circumference = 2.10 m) = 50/15 * 2.1 m
   // = 6.99m If you ride at 80 pedal turns / min, you run a distance of 6.99 * 80 / min
   // ~= 560 m / min = 33.6 km/h
+  // The distance per pedal turn is expressed in um and the pedal rotation time in
+  // ms, so the speed in m / h is distance * 3.6 / rotation time (rounded).
+  const uint64_t distance = state.distancePerPedalTurn;
+  const uint64_t time     = static_cast<uint64_t>(state.pedalRotationTime.count());
 
-  // TODO
+  state.speed = static_cast<uint32_t>((distance * 36 + time * 5) / (time * 10));
 }
 
-void Speedometer::computeDistance() {
+void Speedometer::computeDistance(DistanceState& state,
+                                  const std::chrono::microseconds& currentTime) {
   // For computing the speed given a rear gear (braquet), one must divide the size of
   // the tray (plateau) by the size of the rear gear (pignon arrière), and then multiply
   // the result by the circumference of the wheel. Example: tray = 50, rear gear = 15.
@@ -119,8 +231,54 @@ void Speedometer::computeDistance() {
   // = 6.99m If you ride at 80 pedal turns / min, you run a distance of 6.99 * 80 / min
   // ~= 560 m / min = 33.6 km/h. We then multiply the speed by the time for getting the
   // distance traveled.
+  // The distance is accumulated in um and the fraction of um that does not fit is
+  // kept as a remainder, which makes the accumulation exact over long rides.
+  if (currentTime <= state.time) {
+    return;
+  }
+  // pedal rotation time expressed in us
+  const uint64_t pedalRotationTime =
+      static_cast<uint64_t>(state.pedalRotationTime.count()) * 1000;
+  const uint64_t elapsedTime = static_cast<uint64_t>((currentTime - state.time).count());
+  state.time                 = currentTime;
 
-  // TODO
+  const uint64_t distance = state.distancePerPedalTurn * elapsedTime + state.remainder;
+  state.distance += distance / pedalRotationTime;
+  state.remainder = distance % pedalRotationTime;
+}
+
+void Speedometer::runSampling() {
+  // samples are released at absolute times, so that the sampling period does not
+  // drift
+  auto releaseTime = zpp_lib::Time::getUpTime();
+  while (!atomic_test_bit(&_samplingFlags, kSamplingStopBit)) {
+    sleepUntil(releaseTime);
+    setCurrentRotationTime(_rotationTimeSource());
+    setGearSize(_gearSizeSource());
+
+    DistanceState state = _distanceState.read();
+    computeDistance(state, zpp_lib::Time::getUpTime());
+    SpeedSample sample;
+    sample.time              = state.time;
+    sample.speed             = state.speed;
+    sample.distance          = state.distance;
+    sample.pedalRotationTime = state.pedalRotationTime;
+    _history.addSample(sample);
+    _statistics.publish(_history.computeStatistics());
+
+    releaseTime += kSamplingPeriod;
+  }
+}
+
+uint32_t Speedometer::getDistancePerPedalTurn(uint8_t gearSize) {
+  static constexpr DistancePerPedalTurnTable kDistancePerPedalTurnTable =
+      makeDistancePerPedalTurnTable(kTraySize, kWheelCircumference);
+  if (gearSize >= kMinGearSize && gearSize <= kMaxGearSize) {
+    return kDistancePerPedalTurnTable.distances[gearSize - kMinGearSize];
+  }
+  // gear sizes outside of the bike range are computed on the fly
+  __ASSERT(gearSize > 0, "Invalid gear size %d", gearSize);
+  return computeDistancePerPedalTurn(kTraySize, kWheelCircumference, gearSize);
 }
 
 }  // namespace bike_computer
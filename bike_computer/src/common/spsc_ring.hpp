@@ -0,0 +1,93 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file spsc_ring.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Lock-free single producer / single consumer ring buffer
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// zephyr
+#include <zephyr/kernel.h>
+
+// zpp_lib
+#include "zpp_include/non_copyable.hpp"
+
+namespace bike_computer {
+
+// Ring buffer that may be used without locking as long as a single context
+// (thread or ISR) calls push() and a single context calls pop().
+// Items are dropped (and counted) when the ring is full.
+template <typename T, uint16_t Size>
+class SpscRing : private zpp_lib::NonCopyable<SpscRing<T, Size>> {
+  static_assert(Size > 0 && (Size & (Size - 1)) == 0, "Size must be a power of two");
+
+ public:
+  SpscRing() = default;
+
+  // producer side
+  bool push(const T& item) {
+    const uint32_t head = static_cast<uint32_t>(atomic_get(&_head));
+    const uint32_t tail = static_cast<uint32_t>(atomic_get(&_tail));
+    if (head - tail >= Size) {
+      atomic_inc(&_nbrOfOverflows);
+      return false;
+    }
+    _items[head & kMask] = item;
+    // publish the item only once it is written
+    atomic_set(&_head, static_cast<atomic_val_t>(head + 1));
+    return true;
+  }
+
+  // consumer side
+  bool pop(T& item) {
+    const uint32_t tail = static_cast<uint32_t>(atomic_get(&_tail));
+    const uint32_t head = static_cast<uint32_t>(atomic_get(&_head));
+    if (head == tail) {
+      return false;
+    }
+    item = _items[tail & kMask];
+    // release the slot only once the item is read
+    atomic_set(&_tail, static_cast<atomic_val_t>(tail + 1));
+    return true;
+  }
+
+  uint32_t getSize() const {
+    return static_cast<uint32_t>(atomic_get(&_head)) -
+           static_cast<uint32_t>(atomic_get(&_tail));
+  }
+  bool isEmpty() const { return getSize() == 0; }
+  static constexpr uint16_t getCapacity() { return Size; }
+
+  // number of items dropped because the ring was full
+  uint32_t getNbrOfOverflows() const {
+    return static_cast<uint32_t>(atomic_get(&_nbrOfOverflows));
+  }
+
+ private:
+  static constexpr uint32_t kMask = Size - 1;
+
+  T _items[Size];
+  atomic_t _head           = ATOMIC_INIT(0);
+  atomic_t _tail           = ATOMIC_INIT(0);
+  atomic_t _nbrOfOverflows = ATOMIC_INIT(0);
+};
+
+}  // namespace bike_computer
@@ -29,10 +29,16 @@
 #if CONFIG_TEST == 1
 #include <zephyr/ztest.h>
 #endif  // CONFIG_TEST == 1
-#include <zephyr/tracing/tracing.h>
 
 // std
 #include <chrono>
+#include <functional>
+
+// zpp_lib
+#include "zpp_include/this_thread.hpp"
+
+// local
+#include "trace_events.hpp"
 
 LOG_MODULE_DECLARE(bike_computer, CONFIG_APP_LOG_LEVEL);
 
@@ -46,45 +52,236 @@ const char* TaskManager::kTaskDescriptors[TaskManager::kNbrOfTaskTypes] = {
     const_cast<char*>("Display(1)"),
     const_cast<char*>("Display(2)")};
 
+TaskManager::TaskManager()
+    : _logThread(zpp_lib::PreemptableThreadPriority::PriorityLow, "TaskLog") {}
+
+TaskManager::~TaskManager() { stopLogging(); }
+
+zpp_lib::ZephyrResult TaskManager::startLogging() {
+  zpp_lib::ZephyrResult res;
+  if (_isLogThreadStarted) {
+    return res;
+  }
+  atomic_clear(&_logStopFlag);
+  res = _logThread.start(std::bind(&TaskManager::processLogRecords, this));
+  if (!res) {
+    LOG_ERR("Cannot start log thread: %d", (int)res.error());
+    return res;
+  }
+  _isLogThreadStarted = true;
+  return res;
+}
+
+void TaskManager::stopLogging() {
+  if (!_isLogThreadStarted) {
+    return;
+  }
+  atomic_set_bit(&_logStopFlag, 1);
+  auto res = _logThread.join();
+  if (!res) {
+    LOG_ERR("Cannot join log thread: %d", (int)res.error());
+  }
+  _isLogThreadStarted = false;
+}
+
 void TaskManager::initializePhase() {
   for (uint8_t taskIndex = 0; taskIndex < kNbrOfTaskTypes; taskIndex++) {
     _nbrOfCalls[taskIndex] = 0;
   }
   _phase = zpp_lib::Time::getUpTime();
+  trace_events::phase();
 }
 
 void TaskManager::registerTaskStart(TaskType taskType) {
   uint8_t taskIndex                 = (uint8_t)taskType;
   _taskStartTime[taskIndex]         = zpp_lib::Time::getUpTime();
   _dephasedTaskStartTime[taskIndex] = _taskStartTime[taskIndex] - _phase;
+  _taskStartCycles[taskIndex]       = getThreadExecutionCycles();
+  trace_events::taskStart(taskIndex, _nbrOfCalls[taskIndex]);
+  // in Hi mode, Lo tasks run only once every kDegradedRateDivider releases
+  _isTaskShed[taskIndex] = kTaskCriticalities[taskIndex] == Criticality::Lo &&
+                           getMode() == Criticality::Hi &&
+                           (_nbrOfCalls[taskIndex] % kDegradedRateDivider) != 0;
 }
 
 void TaskManager::simulateComputationTime(TaskType taskType) {
   uint8_t taskIndex = (uint8_t)taskType;
-  if (isWithinExpectedTime(taskType)) {
-    auto elapsedTime = zpp_lib::Time::getUpTime() - _taskStartTime[taskIndex];
-    while (elapsedTime < getTaskComputationTime(taskType)) {
-      elapsedTime = zpp_lib::Time::getUpTime() - _taskStartTime[taskIndex];
-    }
+  if (_isTaskShed[taskIndex]) {
+    // the shed release does not compute anything
+    logShedTask(taskType);
+  } else if (isWithinExpectedTime(taskType)) {
+    const auto computationTime = getTaskComputationTime(taskType);
+    const auto busyEndTime =
+        _taskStartTime[taskIndex] + (computationTime * _busyPercentage) / 100;
+    waitUntil(busyEndTime, _taskStartTime[taskIndex] + computationTime);
 
     logTaskTime(taskType);
+    updateMode(taskType, isBudgetOverrun(taskType));
   } else {
     auto expectedTaskEndTime = _phase +
                                (kTaskPeriods[taskIndex] * (_nbrOfCalls[taskIndex] + 1)) -
                                kTaskOverheadTime;
 
-    auto currentTime = zpp_lib::Time::getUpTime();
-    while (currentTime < expectedTaskEndTime) {
-      currentTime = zpp_lib::Time::getUpTime();
-    }
+    // the dropped task does not compute anything, no busy share
+    waitUntil(std::chrono::microseconds::zero(), expectedTaskEndTime);
 
     logDropTask(taskType);
+    updateMode(taskType, true);
   }
   _nbrOfCalls[taskIndex]++;
 }
 
+Criticality TaskManager::getMode() const {
+  return static_cast<Criticality>(atomic_get(&_mode));
+}
+
+uint32_t TaskManager::getNbrOfModeSwitches() const {
+  return static_cast<uint32_t>(atomic_get(&_nbrOfModeSwitches));
+}
+
+bool TaskManager::isTaskShed(TaskType taskType) const {
+  uint8_t taskIndex = (uint8_t)taskType;
+  __ASSERT(taskIndex < kNbrOfTaskTypes, "Invalid task index %d", taskIndex);
+  return _isTaskShed[taskIndex];
+}
+
+uint64_t TaskManager::getThreadExecutionCycles() {
+#if CONFIG_SCHED_THREAD_USAGE == 1
+  k_thread_runtime_stats_t stats;
+  if (k_thread_runtime_stats_get(k_current_get(), &stats) == 0) {
+    return stats.execution_cycles;
+  }
+#endif  // CONFIG_SCHED_THREAD_USAGE == 1
+  return 0;
+}
+
+bool TaskManager::isBudgetOverrun(TaskType taskType) const {
+#if CONFIG_SCHED_THREAD_USAGE == 1
+  // the budget is compared to the processor time used by the task thread, so that
+  // preemptions by higher priority tasks are not counted as overruns
+  uint8_t taskIndex        = (uint8_t)taskType;
+  const auto executionTime = std::chrono::microseconds(
+      k_cyc_to_us_floor64(getThreadExecutionCycles() - _taskStartCycles[taskIndex]));
+  return executionTime > kTaskComputationTimes[taskIndex] + kAllowedDelta;
+#else
+  // without thread usage statistics, only deadline misses (drops) are overruns
+  (void)taskType;
+  return false;
+#endif  // CONFIG_SCHED_THREAD_USAGE == 1
+}
+
+void TaskManager::updateMode(TaskType taskType, bool isOverrun) {
+  uint8_t taskIndex = (uint8_t)taskType;
+  if (kTaskCriticalities[taskIndex] != Criticality::Hi) {
+    // Lo tasks never trigger a mode change
+    return;
+  }
+  if (isOverrun) {
+    atomic_set(&_nbrOfHiJobsWithinBudget, 0);
+    switchMode(Criticality::Hi);
+  } else if (getMode() == Criticality::Hi &&
+             atomic_inc(&_nbrOfHiJobsWithinBudget) + 1 >= kNbrOfJobsForModeRecovery) {
+    switchMode(Criticality::Lo);
+  }
+}
+
+void TaskManager::switchMode(Criticality mode) {
+  const Criticality previousMode =
+      (mode == Criticality::Hi) ? Criticality::Lo : Criticality::Hi;
+  // Hi tasks may run in different threads: only one of them switches the mode
+  if (!atomic_cas(&_mode, (atomic_val_t)previousMode, (atomic_val_t)mode)) {
+    return;
+  }
+  atomic_set(&_nbrOfHiJobsWithinBudget, 0);
+  const uint32_t nbrOfModeSwitches =
+      static_cast<uint32_t>(atomic_inc(&_nbrOfModeSwitches)) + 1;
+  trace_events::modeChange((uint8_t)mode, nbrOfModeSwitches);
+  const auto switchTime = zpp_lib::Time::getUpTime() - _phase;
+  // the task index field holds the new mode
+  pushLogRecord({.type       = LogRecord::Type::ModeChange,
+                 .taskIndex  = (uint8_t)mode,
+                 .reserved   = 0,
+                 .callNumber = nbrOfModeSwitches,
+                 .startTime  = switchTime.count(),
+                 .endTime    = switchTime.count()});
+}
+
+void TaskManager::setSimulationMode(SimulationMode mode, uint8_t busyPercentage) {
+  __ASSERT(busyPercentage <= 100, "Invalid busy percentage %d", busyPercentage);
+  _simulationMode = mode;
+  _busyPercentage = (mode == SimulationMode::BusyWaitMode) ? 100 : busyPercentage;
+}
+
+void TaskManager::waitUntil(const std::chrono::microseconds& busyEndTime,
+                            const std::chrono::microseconds& endTime) {
+  auto currentTime = zpp_lib::Time::getUpTime();
+  if (_simulationMode == SimulationMode::SleepMode) {
+    // simulate the real work of the task
+    while (currentTime < busyEndTime) {
+      currentTime = zpp_lib::Time::getUpTime();
+    }
+    // release the CPU for the rest of the computation time
+    const auto sleepTime = endTime - kSleepGuardTime - currentTime;
+    if (sleepTime > std::chrono::microseconds::zero()) {
+      k_sleep(K_USEC(sleepTime.count()));
+      currentTime = zpp_lib::Time::getUpTime();
+    }
+  }
+  // use the remaining computation time for formatting pending log records
+  drainLogRecords(endTime);
+  currentTime = zpp_lib::Time::getUpTime();
+  // busy wait until the end time (whole time in BusyWaitMode)
+  while (currentTime < endTime) {
+    currentTime = zpp_lib::Time::getUpTime();
+  }
+}
+
+const TaskStatistics& TaskManager::getTaskStatistics(TaskType taskType) const {
+  uint8_t taskIndex = (uint8_t)taskType;
+  __ASSERT(taskIndex < kNbrOfTaskTypes, "Invalid task index %d", taskIndex);
+  return _taskStatistics[taskIndex];
+}
+
+void TaskManager::resetTaskStatistics() {
+  for (uint8_t taskIndex = 0; taskIndex < kNbrOfTaskTypes; taskIndex++) {
+    _taskStatistics[taskIndex].reset();
+  }
+}
+
+void TaskManager::logTaskStatistics() const {
+  for (uint8_t taskIndex = 0; taskIndex < kNbrOfTaskTypes; taskIndex++) {
+    const TaskStatistics& stats = _taskStatistics[taskIndex];
+    LOG_INF("Task %s: %d runs, %d drops, %d sheds, BCET %lld, mean %lld, WCET %lld "
+            "(budget %lld)",
+            kTaskDescriptors[taskIndex],
+            stats.getNbrOfRuns(),
+            stats.getNbrOfDrops(),
+            stats.getNbrOfSheds(),
+            stats.getNbrOfRuns() > 0 ? stats.getBCET().count() : 0LL,
+            stats.getMeanExecutionTime().count(),
+            stats.getWCET().count(),
+            kTaskComputationTimes[taskIndex].count());
+    LOG_INF("Task %s: p99 execution %lld, start delay %lld, response %lld",
+            kTaskDescriptors[taskIndex],
+            stats.getExecutionTimeHistogram().getPercentile(99).count(),
+            stats.getStartDelayHistogram().getPercentile(99).count(),
+            stats.getResponseTimeHistogram().getPercentile(99).count());
+    for (uint8_t bucketIndex = 0; bucketIndex < Log2Histogram::kNbrOfBuckets;
+         bucketIndex++) {
+      const uint32_t count =
+          stats.getExecutionTimeHistogram().getBucketCount(bucketIndex);
+      if (count > 0) {
+        LOG_INF("  execution time <= %lld: %d",
+                Log2Histogram::getBucketUpperBound(bucketIndex).count(),
+                count);
+      }
+    }
+  }
+}
+
 void TaskManager::logTaskTime(TaskType taskType) {
   uint8_t taskIndex = (uint8_t)taskType;
+  trace_events::taskEnd(taskIndex, _nbrOfCalls[taskIndex]);
 #if CONFIG_TEST == 1
   __ASSERT(taskIndex < kNbrOfTaskTypes, "Invalid task index %d", taskIndex);
   std::chrono::microseconds taskComputationTime =
@@ -103,12 +300,16 @@ void TaskManager::logTaskTime(TaskType taskType) {
   std::chrono::microseconds maxDephasedTaskStartTime =
       kTaskPeriods[taskIndex] * (_nbrOfCalls[taskIndex] + 1) -
       kTaskComputationTimes[taskIndex];
-  LOG_DBG("Task %s: start time %lld (bounds %lld - %lld), computation time %lld",
-          kTaskDescriptors[taskIndex],
-          _dephasedTaskStartTime[taskIndex].count(),
-          minDephasedTaskStartTime.count(),
-          maxDephasedTaskStartTime.count(),
-          taskComputationTime.count());
+  const auto dephasedTaskEndTime =
+      _dephasedTaskStartTime[taskIndex] + taskComputationTime;
+  pushLogRecord({.type       = LogRecord::Type::TaskEnd,
+                 .taskIndex  = taskIndex,
+                 .reserved   = 0,
+                 .callNumber = _nbrOfCalls[taskIndex],
+                 .startTime  = _dephasedTaskStartTime[taskIndex].count(),
+                 .endTime    = dephasedTaskEndTime.count()});
+  _taskStatistics[taskIndex].recordRun(
+      _dephasedTaskStartTime[taskIndex] - minDephasedTaskStartTime, taskComputationTime);
   zassert_true(
       _dephasedTaskStartTime[taskIndex] >= minDephasedTaskStartTime - kAllowedDelta,
       "Task %s started too early at call #%d (%lld vs %lld us)",
@@ -128,32 +329,139 @@ void TaskManager::logTaskTime(TaskType taskType) {
       zpp_lib::Time::getUpTime() - _taskStartTime[taskIndex];
   std::chrono::microseconds minDephasedTaskStartTime =
       kTaskPeriods[taskIndex] * _nbrOfCalls[taskIndex];
-  std::chrono::microseconds maxDephasedTaskStartTime =
-      kTaskPeriods[taskIndex] * (_nbrOfCalls[taskIndex] + 1) -
-      kTaskComputationTimes[taskIndex];
-  sys_trace_named_event("Task end", taskIndex, 0);
-  LOG_DBG("Task %s: start time %lld (bounds %lld - %lld), computation time %lld",
-          kTaskDescriptors[taskIndex],
-          _dephasedTaskStartTime[taskIndex].count(),
-          minDephasedTaskStartTime.count(),
-          maxDephasedTaskStartTime.count(),
-          taskComputationTime.count());
+  _taskStatistics[taskIndex].recordRun(
+      _dephasedTaskStartTime[taskIndex] - minDephasedTaskStartTime, taskComputationTime);
+  const auto dephasedTaskEndTime =
+      _dephasedTaskStartTime[taskIndex] + taskComputationTime;
+  pushLogRecord({.type       = LogRecord::Type::TaskEnd,
+                 .taskIndex  = taskIndex,
+                 .reserved   = 0,
+                 .callNumber = _nbrOfCalls[taskIndex],
+                 .startTime  = _dephasedTaskStartTime[taskIndex].count(),
+                 .endTime    = dephasedTaskEndTime.count()});
 #endif  // CONFIG_TEST == 1
 }
 
 void TaskManager::logDropTask(TaskType taskType) {
   uint8_t taskIndex = (uint8_t)taskType;
+  trace_events::taskDrop(taskIndex, _nbrOfCalls[taskIndex]);
+  _taskStatistics[taskIndex].recordDrop();
+  const auto endTime = zpp_lib::Time::getUpTime() - _phase;
+  pushLogRecord({.type       = LogRecord::Type::TaskDrop,
+                 .taskIndex  = taskIndex,
+                 .reserved   = 0,
+                 .callNumber = _nbrOfCalls[taskIndex],
+                 .startTime  = _dephasedTaskStartTime[taskIndex].count(),
+                 .endTime    = endTime.count()});
+}
+
+void TaskManager::logShedTask(TaskType taskType) {
+  uint8_t taskIndex = (uint8_t)taskType;
+  trace_events::taskShed(taskIndex, _nbrOfCalls[taskIndex]);
+  _taskStatistics[taskIndex].recordShed();
+  const auto endTime = zpp_lib::Time::getUpTime() - _phase;
+  pushLogRecord({.type       = LogRecord::Type::TaskShed,
+                 .taskIndex  = taskIndex,
+                 .reserved   = 0,
+                 .callNumber = _nbrOfCalls[taskIndex],
+                 .startTime  = _dephasedTaskStartTime[taskIndex].count(),
+                 .endTime    = endTime.count()});
+}
+
+void TaskManager::logCycleTime(uint32_t cycleNumber,
+                               const std::chrono::microseconds& startTime,
+                               const std::chrono::microseconds& endTime) {
+  pushLogRecord({.type       = LogRecord::Type::CycleEnd,
+                 .taskIndex  = 0,
+                 .reserved   = 0,
+                 .callNumber = cycleNumber,
+                 .startTime  = startTime.count(),
+                 .endTime    = endTime.count()});
+}
+
+void TaskManager::pushLogRecord(const LogRecord& record) {
+#if CONFIG_LOG == 1
+  // records are lost if the log thread cannot keep up (counted by the ring)
+  k_spinlock_key_t key = k_spin_lock(&_logRecordsLock);
+  (void)_logRecords.push(record);
+  k_spin_unlock(&_logRecordsLock, key);
+#else
+  (void)record;
+#endif  // CONFIG_LOG == 1
+}
+
+void TaskManager::processLogRecords() {
+  while (!atomic_test_bit(&_logStopFlag, 1)) {
+    zpp_lib::ThisThread::sleep_for(kLogDrainPeriod);
+    drainLogRecords(std::chrono::microseconds::max());
+  }
+}
+
+void TaskManager::drainLogRecords(const std::chrono::microseconds& deadline) {
+#if CONFIG_LOG == 1
+  // the ring has a single consumer: skip if another thread is already draining it
+  if (!atomic_cas(&_isDrainingLogRecords, 0, 1)) {
+    return;
+  }
+  LogRecord record;
+  while (deadline - zpp_lib::Time::getUpTime() >= kLogRecordFormatTime &&
+         _logRecords.pop(record)) {
+    formatLogRecord(record);
+  }
+  const uint32_t nbrOfOverflows = _logRecords.getNbrOfOverflows();
+  if (nbrOfOverflows != _nbrOfReportedOverflows) {
+    _nbrOfReportedOverflows = nbrOfOverflows;
+    LOG_WRN("%d log records lost", nbrOfOverflows);
+  }
+  atomic_clear(&_isDrainingLogRecords);
+#else
+  (void)deadline;
+#endif  // CONFIG_LOG == 1
+}
+
+void TaskManager::formatLogRecord(const LogRecord& record) const {
+  if (record.type == LogRecord::Type::CycleEnd) {
+    LOG_DBG("Repeating cycle time is %lld milliseconds (cycle #%d)",
+            (record.endTime - record.startTime) / 1000,
+            record.callNumber);
+    return;
+  }
+  if (record.type == LogRecord::Type::ModeChange) {
+    LOG_WRN("Switching to %s mode at time %lld (switch #%d)",
+            record.taskIndex == (uint8_t)Criticality::Hi ? "Hi" : "Lo",
+            record.startTime,
+            record.callNumber);
+    return;
+  }
+
+  const uint8_t taskIndex = record.taskIndex;
   std::chrono::microseconds minDephasedTaskStartTime =
-      kTaskPeriods[taskIndex] * _nbrOfCalls[taskIndex];
+      kTaskPeriods[taskIndex] * record.callNumber;
   std::chrono::microseconds maxDephasedTaskStartTime =
-      kTaskPeriods[taskIndex] * (_nbrOfCalls[taskIndex] + 1) -
+      kTaskPeriods[taskIndex] * (record.callNumber + 1) -
       kTaskComputationTimes[taskIndex];
-  LOG_DBG("Task %s DROPPED: start time %lld (bounds %lld - %lld), computation time %lld",
-          kTaskDescriptors[taskIndex],
-          _dephasedTaskStartTime[taskIndex].count(),
-          minDephasedTaskStartTime.count(),
-          maxDephasedTaskStartTime.count(),
-          kTaskComputationTimes[taskIndex].count());
+  if (record.type == LogRecord::Type::TaskShed) {
+    LOG_DBG("Task %s SHED (Hi mode): start time %lld (bounds %lld - %lld)",
+            kTaskDescriptors[taskIndex],
+            record.startTime,
+            minDephasedTaskStartTime.count(),
+            maxDephasedTaskStartTime.count());
+  } else if (record.type == LogRecord::Type::TaskEnd) {
+    LOG_DBG("Task %s: start time %lld (bounds %lld - %lld), computation time %lld",
+            kTaskDescriptors[taskIndex],
+            record.startTime,
+            minDephasedTaskStartTime.count(),
+            maxDephasedTaskStartTime.count(),
+            record.endTime - record.startTime);
+  } else {
+    LOG_DBG("Task %s DROPPED: start time %lld (bounds %lld - %lld), computation time "
+            "%lld",
+            kTaskDescriptors[taskIndex],
+            record.startTime,
+            minDephasedTaskStartTime.count(),
+            maxDephasedTaskStartTime.count(),
+            kTaskComputationTimes[taskIndex].count());
+  }
 }
 
 bool TaskManager::isWithinExpectedTime(TaskType taskType) {
@@ -24,12 +24,22 @@
 
 #pragma once
 
+// zephyr
+#include <zephyr/kernel.h>
+
 // std
 #include <chrono>
 
+// local
+#include "criticality.hpp"
+#include "spsc_ring.hpp"
+#include "task_statistics.hpp"
+
 // zpp_lib
 #include "zpp_include/non_copyable.hpp"
+#include "zpp_include/thread.hpp"
 #include "zpp_include/time.hpp"
+#include "zpp_include/zephyr_result.hpp"
 
 namespace bike_computer {
 
@@ -48,10 +58,82 @@ class TaskManager : private zpp_lib::NonCopyable<TaskManager> {
   };
   static constexpr uint8_t kNbrOfTaskTypes = 6;
 
-  TaskManager() = default;
+  // Computation time simulation modes
+  // - BusyWaitMode: the CPU spins for the whole task computation time
+  // - SleepMode: the CPU spins for the configured share of the computation time
+  //   (the "real" work) and the calling thread sleeps through the rest, releasing
+  //   the CPU for lower priority threads
+  enum class SimulationMode { BusyWaitMode = 0, SleepMode = 1 };
+  // share of the computation time simulating the real work of the tasks in the
+  // bike systems (SleepMode)
+  static constexpr uint8_t kSleepModeBusyPercentage = 20;
+
+  // task set definition (computation times include kTaskOverheadTime)
+  // these constants are public for synthesizing schedules at compile time
+  static constexpr std::chrono::microseconds kTaskComputationTimes[kNbrOfTaskTypes] = {
+      100000us, 200000us, 100000us, 100000us, 200000us, 100000us};
+  static constexpr std::chrono::microseconds kTaskPeriods[kNbrOfTaskTypes] = {
+      800000us, 400000us, 1600000us, 800000us, 1600000us, 1600000us};
+  // criticality of each task: the gear, speed and reset tasks are safety relevant,
+  // while the temperature and display tasks may be degraded under overload
+  static constexpr Criticality kTaskCriticalities[kNbrOfTaskTypes] = {
+      Criticality::Hi, Criticality::Hi, Criticality::Lo, Criticality::Hi,
+      Criticality::Lo, Criticality::Lo};
+
+  // compact record written in the task timing hot path instead of formatting log
+  // messages, records are formatted later by a low priority thread
+  struct LogRecord {
+    enum class Type : uint8_t {
+      TaskEnd    = 0,
+      TaskDrop   = 1,
+      CycleEnd   = 2,
+      TaskShed   = 3,
+      ModeChange = 4
+    };
+    Type type;
+    uint8_t taskIndex;
+    uint16_t reserved;
+    uint32_t callNumber;
+    // times in usecs (relative to the phase for tasks)
+    int64_t startTime;
+    int64_t endTime;
+  };
+
+  TaskManager();
+  ~TaskManager();
+  // start the low priority thread that formats the deferred log records (records
+  // are also formatted at the end of the tasks, during their simulated computation)
+  [[nodiscard]] zpp_lib::ZephyrResult startLogging();
+  void stopLogging();
   void initializePhase();
+  // time at which all tasks are released for the first time
+  std::chrono::microseconds getPhase() const { return _phase; }
   void registerTaskStart(TaskType taskType);
   void simulateComputationTime(TaskType taskType);
+  // Mixed-criticality mode: the task manager switches to Hi mode when a Hi task
+  // would miss its deadline or, with CONFIG_SCHED_THREAD_USAGE, uses more processor
+  // time than its budget (time during which it is preempted does not count).
+  // In Hi mode, Lo tasks run only once every kDegradedRateDivider releases (e.g. a
+  // lower display refresh rate) and their other releases are shed. The Lo mode is
+  // restored once kNbrOfJobsForModeRecovery consecutive Hi jobs completed within
+  // their budget.
+  Criticality getMode() const;
+  uint32_t getNbrOfModeSwitches() const;
+  // true if the current release of the task (see registerTaskStart()) is shed:
+  // the task should skip its work and simulateComputationTime() returns at once
+  bool isTaskShed(TaskType taskType) const;
+  // busyPercentage is the share of the computation time spent busy waiting
+  // (used in SleepMode only)
+  void setSimulationMode(SimulationMode mode, uint8_t busyPercentage = 0);
+  // statistics of the task runs since the last reset (WCET, histograms, ...)
+  const TaskStatistics& getTaskStatistics(TaskType taskType) const;
+  void resetTaskStatistics();
+  // dump the statistics of all tasks to the log
+  void logTaskStatistics() const;
+  // record the duration of one cycle of the schedule (deferred logging)
+  void logCycleTime(uint32_t cycleNumber,
+                    const std::chrono::microseconds& startTime,
+                    const std::chrono::microseconds& endTime);
   static inline std::chrono::microseconds getTaskComputationTime(TaskType taskType) {
     uint8_t taskIndex = (uint8_t)taskType;
     return kTaskComputationTimes[taskIndex] - kTaskOverheadTime;
@@ -61,26 +143,63 @@ class TaskManager : private zpp_lib::NonCopyable<TaskManager> {
   // private methods
   void logTaskTime(TaskType taskType);
   void logDropTask(TaskType taskType);
+  void logShedTask(TaskType taskType);
+  // processor time used by the calling thread (requires CONFIG_SCHED_THREAD_USAGE)
+  static uint64_t getThreadExecutionCycles();
+  bool isBudgetOverrun(TaskType taskType) const;
+  void updateMode(TaskType taskType, bool isOverrun);
+  void switchMode(Criticality mode);
   bool isWithinExpectedTime(TaskType taskType);
+  void waitUntil(const std::chrono::microseconds& busyEndTime,
+                 const std::chrono::microseconds& endTime);
+  void pushLogRecord(const LogRecord& record);
+  void processLogRecords();
+  // format log records until the deadline (single consumer, returns at once if
+  // records are being formatted by another thread)
+  void drainLogRecords(const std::chrono::microseconds& deadline);
+  void formatLogRecord(const LogRecord& record) const;
 
   // constants
   static const char* kTaskDescriptors[kNbrOfTaskTypes];
   // kTaskOverheadTime accounts for additional time needed for logging between tasks
-#if CONFIG_LOG == 1
-  static constexpr std::chrono::microseconds kTaskOverheadTime = 13000us;
-#else
+  // (log messages are formatted by the log thread or within the simulated computation
+  // time of the tasks, see LogRecord and drainLogRecords())
   static constexpr std::chrono::microseconds kTaskOverheadTime = 5us;
-#endif
-  static constexpr std::chrono::microseconds kTaskComputationTimes[kNbrOfTaskTypes] = {
-      100000us, 200000us, 100000us, 100000us, 200000us, 100000us};
-  static constexpr std::chrono::microseconds kTaskPeriods[kNbrOfTaskTypes] = {
-      800000us, 400000us, 1600000us, 800000us, 1600000us, 1600000us};
+  // upper bound of the time needed for formatting and printing one log record
+  static constexpr std::chrono::microseconds kLogRecordFormatTime = 13ms;
   static constexpr std::chrono::microseconds kAllowedDelta = 1000us;
+  // mixed-criticality mode parameters
+  static constexpr uint8_t kDegradedRateDivider      = 2;
+  static constexpr uint8_t kNbrOfJobsForModeRecovery = 4;
+  // sleeping ends at tick boundaries: stop sleeping two ticks before the end time
+  // and busy wait for the remaining time
+  static constexpr std::chrono::microseconds kSleepGuardTime =
+      std::chrono::microseconds(2 * 1000000 / CONFIG_SYS_CLOCK_TICKS_PER_SEC);
   // data members
   std::chrono::microseconds _taskStartTime[kNbrOfTaskTypes]         = {0ms};
   std::chrono::microseconds _dephasedTaskStartTime[kNbrOfTaskTypes] = {0ms};
   uint32_t _nbrOfCalls[kNbrOfTaskTypes]                             = {0};
+  bool _isTaskShed[kNbrOfTaskTypes]                                 = {false};
+  uint64_t _taskStartCycles[kNbrOfTaskTypes]                        = {0};
+  TaskStatistics _taskStatistics[kNbrOfTaskTypes];
   std::chrono::microseconds _phase;
+  SimulationMode _simulationMode = SimulationMode::BusyWaitMode;
+  uint8_t _busyPercentage        = 100;
+  // mixed-criticality mode, tasks may run in different threads
+  atomic_t _mode                    = ATOMIC_INIT((atomic_val_t)Criticality::Lo);
+  atomic_t _nbrOfModeSwitches       = ATOMIC_INIT(0);
+  atomic_t _nbrOfHiJobsWithinBudget = ATOMIC_INIT(0);
+  // deferred logging
+  static constexpr uint16_t kLogRingSize                     = 64;
+  static constexpr std::chrono::milliseconds kLogDrainPeriod = 100ms;
+  SpscRing<LogRecord, kLogRingSize> _logRecords;
+  // tasks may run in different threads: producers must be serialized
+  struct k_spinlock _logRecordsLock;
+  zpp_lib::Thread _logThread;
+  bool _isLogThreadStarted         = false;
+  atomic_t _logStopFlag            = ATOMIC_INIT(0x00);
+  atomic_t _isDrainingLogRecords   = ATOMIC_INIT(0);
+  uint32_t _nbrOfReportedOverflows = 0;
 };
 
 }  // namespace bike_computer
@@ -0,0 +1,120 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file task_statistics.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Execution time statistics implementation
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "task_statistics.hpp"
+
+// std
+#include <algorithm>
+
+namespace bike_computer {
+
+void Log2Histogram::add(const std::chrono::microseconds& value) {
+  _buckets[getBucketIndex(value)]++;
+  _count++;
+}
+
+void Log2Histogram::reset() {
+  for (uint8_t bucketIndex = 0; bucketIndex < kNbrOfBuckets; bucketIndex++) {
+    _buckets[bucketIndex] = 0;
+  }
+  _count = 0;
+}
+
+uint32_t Log2Histogram::getBucketCount(uint8_t bucketIndex) const {
+  return bucketIndex < kNbrOfBuckets ? _buckets[bucketIndex] : 0;
+}
+
+std::chrono::microseconds Log2Histogram::getPercentile(uint8_t percentile) const {
+  if (_count == 0) {
+    return std::chrono::microseconds::zero();
+  }
+  // number of samples that must be below or equal to the returned value
+  const uint64_t rank   = (static_cast<uint64_t>(_count) * percentile + 99) / 100;
+  uint64_t nbrOfSamples = 0;
+  for (uint8_t bucketIndex = 0; bucketIndex < kNbrOfBuckets; bucketIndex++) {
+    nbrOfSamples += _buckets[bucketIndex];
+    if (nbrOfSamples >= rank && nbrOfSamples > 0) {
+      return getBucketUpperBound(bucketIndex);
+    }
+  }
+  return getBucketUpperBound(kNbrOfBuckets - 1);
+}
+
+std::chrono::microseconds Log2Histogram::getBucketUpperBound(uint8_t bucketIndex) {
+  if (bucketIndex >= kNbrOfBuckets - 1) {
+    // last bucket also holds all larger values
+    return std::chrono::microseconds::max();
+  }
+  return std::chrono::microseconds((INT64_C(1) << bucketIndex) - 1);
+}
+
+uint8_t Log2Histogram::getBucketIndex(const std::chrono::microseconds& value) {
+  if (value <= std::chrono::microseconds::zero()) {
+    return 0;
+  }
+  // bucket index is the number of significant bits of the value
+  uint64_t v          = static_cast<uint64_t>(value.count());
+  uint8_t bucketIndex = 0;
+  while (v != 0 && bucketIndex < kNbrOfBuckets - 1) {
+    v >>= 1;
+    bucketIndex++;
+  }
+  return bucketIndex;
+}
+
+void TaskStatistics::recordRun(const std::chrono::microseconds& startDelay,
+                               const std::chrono::microseconds& executionTime) {
+  _executionTime.add(executionTime);
+  _startDelay.add(startDelay);
+  _responseTime.add(startDelay + executionTime);
+  _nbrOfRuns++;
+  _wcet = std::max(_wcet, executionTime);
+  _bcet = std::min(_bcet, executionTime);
+  _totalExecTime += executionTime;
+  _worstResponseTime = std::max(_worstResponseTime, startDelay + executionTime);
+}
+
+void TaskStatistics::recordDrop() { _nbrOfDrops++; }
+
+void TaskStatistics::recordShed() { _nbrOfSheds++; }
+
+void TaskStatistics::reset() {
+  _executionTime.reset();
+  _startDelay.reset();
+  _responseTime.reset();
+  _nbrOfRuns         = 0;
+  _nbrOfDrops        = 0;
+  _nbrOfSheds        = 0;
+  _wcet              = std::chrono::microseconds::zero();
+  _bcet              = std::chrono::microseconds::max();
+  _totalExecTime     = std::chrono::microseconds::zero();
+  _worstResponseTime = std::chrono::microseconds::zero();
+}
+
+std::chrono::microseconds TaskStatistics::getMeanExecutionTime() const {
+  return _nbrOfRuns == 0 ? std::chrono::microseconds::zero()
+                         : _totalExecTime / _nbrOfRuns;
+}
+
+}  // namespace bike_computer
@@ -0,0 +1,96 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file task_statistics.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Execution time statistics of periodic tasks (fixed memory)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// std
+#include <chrono>
+#include <cstdint>
+
+namespace bike_computer {
+
+// Histogram with power of two buckets: bucket 0 counts the value 0 and bucket
+// i > 0 counts values in [2^(i-1), 2^i - 1] (expressed in microseconds)
+class Log2Histogram {
+ public:
+  static constexpr uint8_t kNbrOfBuckets = 25;
+
+  void add(const std::chrono::microseconds& value);
+  void reset();
+
+  uint32_t getCount() const { return _count; }
+  uint32_t getBucketCount(uint8_t bucketIndex) const;
+
+  // upper bound of the bucket containing the given percentile (0-100)
+  // the returned value is a safe upper bound of the real percentile
+  std::chrono::microseconds getPercentile(uint8_t percentile) const;
+
+  static std::chrono::microseconds getBucketUpperBound(uint8_t bucketIndex);
+
+ private:
+  static uint8_t getBucketIndex(const std::chrono::microseconds& value);
+
+  uint32_t _buckets[kNbrOfBuckets] = {0};
+  uint32_t _count                  = 0;
+};
+
+// statistics recorded for each task type
+class TaskStatistics {
+ public:
+  // startDelay is the time between the task release and its start
+  void recordRun(const std::chrono::microseconds& startDelay,
+                 const std::chrono::microseconds& executionTime);
+  void recordDrop();
+  // the release was shed by the mixed-criticality mode (Lo task in Hi mode)
+  void recordShed();
+  void reset();
+
+  uint32_t getNbrOfRuns() const { return _nbrOfRuns; }
+  uint32_t getNbrOfDrops() const { return _nbrOfDrops; }
+  uint32_t getNbrOfSheds() const { return _nbrOfSheds; }
+  // worst and best case execution times (observed)
+  std::chrono::microseconds getWCET() const { return _wcet; }
+  std::chrono::microseconds getBCET() const { return _bcet; }
+  std::chrono::microseconds getMeanExecutionTime() const;
+  // worst observed response time (start delay + execution time)
+  std::chrono::microseconds getWorstResponseTime() const { return _worstResponseTime; }
+
+  const Log2Histogram& getExecutionTimeHistogram() const { return _executionTime; }
+  const Log2Histogram& getStartDelayHistogram() const { return _startDelay; }
+  const Log2Histogram& getResponseTimeHistogram() const { return _responseTime; }
+
+ private:
+  Log2Histogram _executionTime;
+  Log2Histogram _startDelay;
+  Log2Histogram _responseTime;
+  uint32_t _nbrOfRuns                          = 0;
+  uint32_t _nbrOfDrops                         = 0;
+  uint32_t _nbrOfSheds                         = 0;
+  std::chrono::microseconds _wcet              = std::chrono::microseconds::zero();
+  std::chrono::microseconds _bcet              = std::chrono::microseconds::max();
+  std::chrono::microseconds _totalExecTime     = std::chrono::microseconds::zero();
+  std::chrono::microseconds _worstResponseTime = std::chrono::microseconds::zero();
+};
+
+}  // namespace bike_computer
@@ -0,0 +1,82 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file trace_events.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Trace events emitted for task and frame timelines
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// zephyr
+#include <zephyr/tracing/tracing.h>
+
+// std
+#include <cstdint>
+
+namespace bike_computer {
+
+// Named events emitted through the Zephyr tracing backend (e.g. CTF) and
+// consumed by tools/trace_timeline.py, which rebuilds the task timeline.
+// Task events carry the task index and the call number, so that the tool can
+// compute the release time and deadline of each job from the phase.
+// Frame events carry the minor cycle index and the frame number.
+namespace trace_events {
+
+// time at which all tasks are released for the first time
+inline void phase() { sys_trace_named_event("Phase", 0, 0); }
+
+inline void taskStart(uint8_t taskIndex, uint32_t callNumber) {
+  sys_trace_named_event("Task start", taskIndex, callNumber);
+}
+
+inline void taskEnd(uint8_t taskIndex, uint32_t callNumber) {
+  sys_trace_named_event("Task end", taskIndex, callNumber);
+}
+
+inline void taskDrop(uint8_t taskIndex, uint32_t callNumber) {
+  sys_trace_named_event("Task drop", taskIndex, callNumber);
+}
+
+// the task release is shed because a Lo task runs in Hi mode
+inline void taskShed(uint8_t taskIndex, uint32_t callNumber) {
+  sys_trace_named_event("Task shed", taskIndex, callNumber);
+}
+
+// mixed-criticality mode change (arg0 is the new mode, 0 for Lo and 1 for Hi)
+inline void modeChange(uint8_t mode, uint32_t nbrOfModeSwitches) {
+  sys_trace_named_event("Mode", mode, nbrOfModeSwitches);
+}
+
+inline void frameStart(uint16_t minorCycleIndex, uint32_t frameNumber) {
+  sys_trace_named_event("Frame start", minorCycleIndex, frameNumber);
+}
+
+inline void frameEnd(uint16_t minorCycleIndex, uint32_t frameNumber) {
+  sys_trace_named_event("Frame end", minorCycleIndex, frameNumber);
+}
+
+// a timer tick was lost because the previous frame did not start yet
+inline void frameLost(uint16_t minorCycleIndex, uint32_t frameNumber) {
+  sys_trace_named_event("Frame lost", minorCycleIndex, frameNumber);
+}
+
+}  // namespace trace_events
+
+}  // namespace bike_computer
@@ -28,19 +28,107 @@
 #include <zephyr/kernel.h>
 
 // std
+#include <algorithm>
 #include <chrono>
 #include <string>
+#include <type_traits>
 
 // zpp_lib
 #include "zpp_include/clock.hpp"
 #include "zpp_include/non_copyable.hpp"
+#include "zpp_include/time.hpp"
 #include "zpp_include/zephyr_result.hpp"
 
+// local
+#include "criticality.hpp"
+#include "spsc_ring.hpp"
+#include "trace_events.hpp"
+
 namespace bike_computer {
 
-template <typename F, uint16_t NbrOfMinorCycles, uint16_t MaxMinorCycleSize>
-class TTCE : private zpp_lib::NonCopyable<TTCE<F, NbrOfMinorCycles, MaxMinorCycleSize>> {
+// Time-triggered cyclic executive. The tasks added to each minor cycle are run
+// in a frame released by a periodic timer.
+// F is the type of the task entries, which must be callable without argument and
+// comparable to nullptr. std::function may be used for any callable, while
+// MemberTask (see member_task.hpp) stores a pointer to member function and calls
+// it without type erasure.
+// Aperiodic jobs (e.g. button handlers) may also be submitted from ISRs or threads.
+// They are run by a polling server in the slack of each frame: once the tasks of
+// the frame are done, queued jobs are run in submission order as long as both their
+// worst case execution time fits in the remaining server budget and they complete
+// before the next tick. The response time of an aperiodic job is thus bounded by
+// about one minor cycle when the server budget is not exhausted, and no processor
+// time is reserved when no job is pending.
+// Each task also has a criticality level, and each Hi task a Lo-mode budget (its
+// execution time bound in Lo mode). When a Hi task exceeds its budget, the
+// executive switches to Hi mode, in which the Lo tasks are shed, and it returns to
+// Lo mode after kNbrOfFramesForModeRecovery consecutive frames in which all Hi
+// tasks ran within their budget. Frames overrun by Lo tasks are counted but do not
+// change the mode.
+template <typename F,
+          uint16_t NbrOfMinorCycles,
+          uint16_t MaxMinorCycleSize,
+          uint16_t AperiodicQueueSize = 8>
+class TTCE : private zpp_lib::NonCopyable<
+                 TTCE<F, NbrOfMinorCycles, MaxMinorCycleSize, AperiodicQueueSize>> {
  public:
+  // statistics of the frames executed for a given minor cycle index
+  // slack is the time remaining between the end of the frame and the next tick
+  // (negative slack means that the frame overran)
+  struct MinorCycleStats {
+    uint32_t nbrOfFrames                = 0;
+    uint32_t nbrOfOverruns              = 0;
+    std::chrono::microseconds minSlack  = std::chrono::microseconds::max();
+    std::chrono::microseconds maxSlack  = std::chrono::microseconds::min();
+    std::chrono::microseconds sumSlack  = std::chrono::microseconds::zero();
+    std::chrono::microseconds lastStart = std::chrono::microseconds::zero();
+    std::chrono::microseconds lastEnd   = std::chrono::microseconds::zero();
+
+    std::chrono::microseconds getAverageSlack() const {
+      return nbrOfFrames == 0 ? std::chrono::microseconds::zero()
+                              : sumSlack / nbrOfFrames;
+    }
+  };
+
+  struct Stats {
+    MinorCycleStats minorCycles[NbrOfMinorCycles];
+    // number of timer ticks
+    uint32_t nbrOfTicks = 0;
+    // ticks that occurred while the previous frame was still running
+    uint32_t nbrOfOverrunTicks = 0;
+    // ticks that were lost because a frame was already waiting to be run
+    uint32_t nbrOfCoalescedTicks = 0;
+    // total number of frames that did not complete before the next tick
+    uint32_t nbrOfOverruns = 0;
+    // number of aperiodic jobs run by the polling server
+    uint32_t nbrOfAperiodicJobs = 0;
+    // number of times the first pending job did not fit in the frame slack
+    uint32_t nbrOfDeferredAperiodicJobs = 0;
+    // worst time from submission to completion of an aperiodic job
+    std::chrono::microseconds maxAperiodicResponseTime = {};
+    // mixed-criticality mode
+    Criticality mode           = Criticality::Lo;
+    uint32_t nbrOfModeSwitches = 0;
+    // number of Hi task runs that exceeded their Lo-mode budget
+    uint32_t nbrOfBudgetOverruns = 0;
+    // number of Lo tasks not run because of the Hi mode
+    uint32_t nbrOfShedTasks = 0;
+  };
+
+  // record of one executed frame (times in usecs), pushed by the work queue thread
+  // so that frames can be logged from another thread without delaying them
+  struct FrameRecord {
+    uint16_t minorCycleIndex;
+    uint16_t nbrOfShedTasks;
+    uint32_t frameNumber;
+    int64_t startTime;
+    int64_t endTime;
+    int64_t slack;
+  };
+
+  // number of frames with all Hi tasks within budget before returning to Lo mode
+  static constexpr uint16_t kNbrOfFramesForModeRecovery = 2 * NbrOfMinorCycles;
+
   explicit TTCE(std::chrono::milliseconds minorCycle) : _minorCycle(minorCycle) {
     k_timer_init(&_timer, &TTCE::_thunk, nullptr);
     // specify this instance as user data
@@ -83,8 +171,36 @@ class TTCE : private zpp_lib::NonCopyable<TTCE<F, NbrOfMinorCycles, MaxMinorCycl
 
   bool isStarted() { return _isStarted; }
 
-  [[nodiscard]] zpp_lib::ZephyrResult addTask(uint16_t minorCycleIndex, F f) {
+  // get a copy of the frame statistics (may be called from any thread)
+  Stats getStats() const {
+    Stats stats;
+    k_spinlock_key_t key = k_spin_lock(&_statsLock);
+    stats                = _stats;
+    k_spin_unlock(&_statsLock, key);
+    return stats;
+  }
+
+  void resetStats() {
+    k_spinlock_key_t key = k_spin_lock(&_statsLock);
+    _stats               = Stats();
+    // the mode is kept
+    _stats.mode = _mode;
+    k_spin_unlock(&_statsLock, key);
+  }
+
+  // budget is the Lo-mode budget of a Hi task (ignored for Lo tasks), a zero
+  // budget stands for the whole minor cycle
+  [[nodiscard]] zpp_lib::ZephyrResult addTask(
+      uint16_t minorCycleIndex,
+      F f,
+      Criticality criticality          = Criticality::Hi,
+      std::chrono::microseconds budget = std::chrono::microseconds::zero()) {
     zpp_lib::ZephyrResult res;
+    if (f == nullptr) {
+      __ASSERT(false, "Invalid task in minor cycle %d", minorCycleIndex);
+      res.assign_error(zpp_lib::ZephyrErrorCode::k_inval);
+      return res;
+    }
     if (minorCycleIndex >= NbrOfMinorCycles) {
       __ASSERT(false, "Invalid minor cycle index %d", minorCycleIndex);
       res.assign_error(zpp_lib::ZephyrErrorCode::k_inval);
@@ -99,12 +215,114 @@ class TTCE : private zpp_lib::NonCopyable<TTCE<F, NbrOfMinorCycles, MaxMinorCycl
       return res;
     }
 
-    _tasks[minorCycleIndex][_nbrOfTasksInMinorCycle[minorCycleIndex]] = f;
+    const uint16_t slotIndex = _nbrOfTasksInMinorCycle[minorCycleIndex];
+
+    _tasks[minorCycleIndex][slotIndex]         = f;
+    _criticalities[minorCycleIndex][slotIndex] = criticality;
+    _budgets[minorCycleIndex][slotIndex] =
+        budget == std::chrono::microseconds::zero() ? _minorCycle : budget;
     _nbrOfTasksInMinorCycle[minorCycleIndex]++;
 
     return res;
   }
 
+  // set the budget of the polling server, i.e. the maximal time spent running
+  // aperiodic jobs in each frame (must be called before start())
+  [[nodiscard]] zpp_lib::ZephyrResult setServerBudget(std::chrono::microseconds budget) {
+    zpp_lib::ZephyrResult res;
+    if (_isStarted || budget < std::chrono::microseconds::zero() ||
+        budget > _minorCycle) {
+      __ASSERT(false, "Invalid server budget %lld us", budget.count());
+      res.assign_error(zpp_lib::ZephyrErrorCode::k_inval);
+      return res;
+    }
+    _serverBudget = budget;
+    return res;
+  }
+
+  // submit an aperiodic job with its worst case execution time
+  // may be called from any thread, and from ISRs only if F is trivially copyable
+  // (e.g. a function pointer): copying a std::function may allocate memory
+  [[nodiscard]] zpp_lib::ZephyrResult submitAperiodicJob(F f,
+                                                         std::chrono::microseconds wcet) {
+    zpp_lib::ZephyrResult res;
+    if (f == nullptr || wcet > _serverBudget) {
+      // such a job would never be run
+      res.assign_error(zpp_lib::ZephyrErrorCode::k_inval);
+      return res;
+    }
+    __ASSERT(std::is_trivially_copyable_v<F> || !k_is_in_isr(),
+             "Aperiodic jobs submitted from ISRs must be trivially copyable");
+    AperiodicJob job;
+    job.function           = f;
+    job.wcet               = wcet;
+    job.submitTime         = zpp_lib::Time::getUpTime();
+    const unsigned int key = irq_lock();
+    const bool isQueued    = _aperiodicJobs.push(job);
+    irq_unlock(key);
+    if (!isQueued) {
+      res.assign_error(zpp_lib::ZephyrErrorCode::k_again);
+    }
+    return res;
+  }
+
+  // number of aperiodic jobs lost because the queue was full
+  uint32_t getNbrOfLostAperiodicJobs() const {
+    return _aperiodicJobs.getNbrOfOverflows();
+  }
+
+  // get the oldest frame record (single consumer), false if no record is pending
+  bool getFrameRecord(FrameRecord& record) { return _frameRecords.pop(record); }
+
+  // number of frame records lost because they were not consumed in time
+  uint32_t getNbrOfLostFrameRecords() const {
+    return _frameRecords.getNbrOfOverflows();
+  }
+
+  // add all tasks of a schedule synthesized with synthesizeSchedule()
+  // tasks[i] is the function called for the task of index i in the schedule
+  // (all tasks are Hi tasks)
+  template <typename Schedule>
+  [[nodiscard]] zpp_lib::ZephyrResult addSchedule(
+      const Schedule& schedule, const F (&tasks)[Schedule::kNbrOfTasks]) {
+    Criticality criticalities[Schedule::kNbrOfTasks];
+    std::fill_n(criticalities, Schedule::kNbrOfTasks, Criticality::Hi);
+    return addSchedule(schedule, tasks, criticalities);
+  }
+
+  // same as above, criticalities[i] is the criticality of the task of index i
+  template <typename Schedule>
+  [[nodiscard]] zpp_lib::ZephyrResult addSchedule(
+      const Schedule& schedule,
+      const F (&tasks)[Schedule::kNbrOfTasks],
+      const Criticality (&criticalities)[Schedule::kNbrOfTasks]) {
+    static_assert(Schedule::kMaxFrameSize <= MaxMinorCycleSize,
+                  "Schedule frames do not fit in the TTCE minor cycles");
+    zpp_lib::ZephyrResult res;
+    if (!schedule.isFeasible || schedule.nbrOfFrames != NbrOfMinorCycles ||
+        schedule.minorCycle != _minorCycle) {
+      __ASSERT(false,
+               "Schedule does not match TTCE (%d minor cycles of %lld ms)",
+               NbrOfMinorCycles,
+               _minorCycle.count());
+      res.assign_error(zpp_lib::ZephyrErrorCode::k_inval);
+      return res;
+    }
+
+    for (uint16_t minorCycleIndex = 0; minorCycleIndex < NbrOfMinorCycles;
+         minorCycleIndex++) {
+      for (uint16_t jobIndex = 0; jobIndex < schedule.frameSizes[minorCycleIndex];
+           jobIndex++) {
+        const uint8_t taskIndex = schedule.frames[minorCycleIndex][jobIndex];
+        res = addTask(minorCycleIndex, tasks[taskIndex], criticalities[taskIndex]);
+        if (!res) {
+          return res;
+        }
+      }
+    }
+    return res;
+  }
+
  private:
   static void _thunk(struct k_timer* timer_id) {
     // submit the periodic TTCE task
@@ -114,11 +332,30 @@ class TTCE : private zpp_lib::NonCopyable<TTCE<F, NbrOfMinorCycles, MaxMinorCycl
       // timer
       // cppcheck-suppress cstyleCast
       TTCE* pTTCE = (TTCE*)timer_id->user_data;  // NOLINT(readability/casting)
-      auto ret    = k_work_submit_to_queue(&pTTCE->_workQueue, &pTTCE->_work);
+      const auto tickTime = zpp_lib::Time::getUpTime();
+      auto ret = k_work_submit_to_queue(&pTTCE->_workQueue, &pTTCE->_work);
       if (ret != 0 && ret != 1 && ret != 2) {
         __ASSERT(false, "Failed to submit work: %d", ret);
         return;
       }
+
+      k_spinlock_key_t key = k_spin_lock(&pTTCE->_statsLock);
+      pTTCE->_stats.nbrOfTicks++;
+      // 0: the work was already queued, 1: the work was queued (normal case),
+      // 2: the work was running and was queued again
+      if (ret == 0) {
+        // the frame released by the previous tick did not even start: this tick is
+        // lost and its release time is not recorded
+        pTTCE->_stats.nbrOfCoalescedTicks++;
+        trace_events::frameLost(pTTCE->_minorCycleIndex, pTTCE->_frameNumber);
+      } else {
+        if (ret == 2) {
+          // the previous frame is still running and the work is queued again
+          pTTCE->_stats.nbrOfOverrunTicks++;
+        }
+        pTTCE->_tickTimes.push(tickTime);
+      }
+      k_spin_unlock(&pTTCE->_statsLock, key);
     }
   }
 
@@ -129,15 +366,172 @@ class TTCE : private zpp_lib::NonCopyable<TTCE<F, NbrOfMinorCycles, MaxMinorCycl
     // cppcheck-suppress dangerousTypeCast
     TTCE* pTTCE = (TTCE*)item;  // NOLINT(readability/casting)
 
-    // execute tasks based on schedule table
-    for (uint16_t taskIndex = 0; taskIndex < MaxMinorCycleSize; taskIndex++) {
-      if (pTTCE->_tasks[pTTCE->_minorCycleIndex][taskIndex] != nullptr) {
-        pTTCE->_tasks[pTTCE->_minorCycleIndex][taskIndex]();
+    const auto frameStart = zpp_lib::Time::getUpTime();
+    k_spinlock_key_t key  = k_spin_lock(&pTTCE->_statsLock);
+    const auto tickTime   = pTTCE->_tickTimes.pop(frameStart);
+    k_spin_unlock(&pTTCE->_statsLock, key);
+    trace_events::frameStart(pTTCE->_minorCycleIndex, pTTCE->_frameNumber);
+
+    // execute tasks based on schedule table (tasks are packed at the start of
+    // each minor cycle)
+    const F* pTask     = pTTCE->_tasks[pTTCE->_minorCycleIndex];
+    const F* pLastTask = pTask + pTTCE->_nbrOfTasksInMinorCycle[pTTCE->_minorCycleIndex];
+    // Lo tasks are shed in Hi mode, Hi tasks are checked against their budget
+    uint16_t nbrOfShedTasks         = 0;
+    uint16_t nbrOfBudgetOverruns    = 0;
+    const bool isLoMode             = pTTCE->_mode == Criticality::Lo;
+    const Criticality* pCriticality = pTTCE->_criticalities[pTTCE->_minorCycleIndex];
+    const auto* pBudget             = pTTCE->_budgets[pTTCE->_minorCycleIndex];
+    for (; pTask != pLastTask; pTask++, pCriticality++, pBudget++) {
+      if (*pCriticality == Criticality::Lo) {
+        if (isLoMode) {
+          (*pTask)();
+        } else {
+          nbrOfShedTasks++;
+        }
+        continue;
+      }
+      const auto taskStart = zpp_lib::Time::getUpTime();
+      (*pTask)();
+      if (zpp_lib::Time::getUpTime() - taskStart > *pBudget) {
+        nbrOfBudgetOverruns++;
       }
     }
+
+    // the slack statistics are those of the periodic tasks only
+    const auto frameEnd = zpp_lib::Time::getUpTime();
+    const auto slack = pTTCE->updateStats(
+        tickTime, frameStart, frameEnd, nbrOfShedTasks, nbrOfBudgetOverruns);
+    // the work queue thread is the single producer of the frame records
+    pTTCE->_frameRecords.push({.minorCycleIndex = pTTCE->_minorCycleIndex,
+                               .nbrOfShedTasks  = nbrOfShedTasks,
+                               .frameNumber     = pTTCE->_frameNumber,
+                               .startTime       = frameStart.count(),
+                               .endTime         = frameEnd.count(),
+                               .slack           = slack.count()});
+
+    // run the pending aperiodic jobs in the slack left before the next tick
+    if (pTTCE->_serverBudget > std::chrono::microseconds::zero()) {
+      pTTCE->runAperiodicJobs(tickTime + pTTCE->_minorCycle);
+    }
+
+    trace_events::frameEnd(pTTCE->_minorCycleIndex, pTTCE->_frameNumber);
+    pTTCE->_frameNumber++;
     pTTCE->_minorCycleIndex = (pTTCE->_minorCycleIndex + 1) % NbrOfMinorCycles;
   }
 
+  void runAperiodicJobs(const std::chrono::microseconds& frameDeadline) {
+    auto remainingBudget = _serverBudget;
+    while (true) {
+      // the first pending job is kept aside when it does not fit in this frame
+      if (!_hasPendingJob) {
+        if (!_aperiodicJobs.pop(_pendingJob)) {
+          return;
+        }
+        _hasPendingJob = true;
+      }
+      const auto jobStart = zpp_lib::Time::getUpTime();
+      if (_pendingJob.wcet > remainingBudget ||
+          jobStart + _pendingJob.wcet > frameDeadline) {
+        k_spinlock_key_t key = k_spin_lock(&_statsLock);
+        _stats.nbrOfDeferredAperiodicJobs++;
+        k_spin_unlock(&_statsLock, key);
+        return;
+      }
+      _hasPendingJob = false;
+      _pendingJob.function();
+      const auto jobEnd = zpp_lib::Time::getUpTime();
+      remainingBudget -= jobEnd - jobStart;
+
+      k_spinlock_key_t key = k_spin_lock(&_statsLock);
+      _stats.nbrOfAperiodicJobs++;
+      _stats.maxAperiodicResponseTime =
+          std::max(_stats.maxAperiodicResponseTime, jobEnd - _pendingJob.submitTime);
+      k_spin_unlock(&_statsLock, key);
+    }
+  }
+
+  std::chrono::microseconds updateStats(const std::chrono::microseconds& tickTime,
+                                        const std::chrono::microseconds& frameStart,
+                                        const std::chrono::microseconds& frameEnd,
+                                        uint16_t nbrOfShedTasks,
+                                        uint16_t nbrOfBudgetOverruns) {
+    k_spinlock_key_t key = k_spin_lock(&_statsLock);
+    // the frame budget ends one minor cycle after the tick that released it
+    const auto slack     = tickTime + _minorCycle - frameEnd;
+    MinorCycleStats& mcs = _stats.minorCycles[_minorCycleIndex];
+    mcs.nbrOfFrames++;
+    mcs.lastStart = frameStart;
+    mcs.lastEnd   = frameEnd;
+    mcs.sumSlack += slack;
+    mcs.minSlack = std::min(mcs.minSlack, slack);
+    mcs.maxSlack = std::max(mcs.maxSlack, slack);
+    if (slack < std::chrono::microseconds::zero()) {
+      mcs.nbrOfOverruns++;
+      _stats.nbrOfOverruns++;
+    }
+    // only Hi tasks exceeding their budget change the mode
+    updateMode(nbrOfBudgetOverruns > 0);
+    _stats.nbrOfShedTasks += nbrOfShedTasks;
+    _stats.nbrOfBudgetOverruns += nbrOfBudgetOverruns;
+    k_spin_unlock(&_statsLock, key);
+    return slack;
+  }
+
+  // called with the statistics lock held
+  void updateMode(bool isBudgetOverrun) {
+    if (isBudgetOverrun) {
+      _nbrOfFramesWithinBudget = 0;
+      if (_mode == Criticality::Hi) {
+        return;
+      }
+      _mode = Criticality::Hi;
+    } else {
+      if (_mode == Criticality::Lo ||
+          ++_nbrOfFramesWithinBudget < kNbrOfFramesForModeRecovery) {
+        return;
+      }
+      _mode = Criticality::Lo;
+    }
+    _stats.mode = _mode;
+    _stats.nbrOfModeSwitches++;
+    trace_events::modeChange((uint8_t)_mode, _stats.nbrOfModeSwitches);
+  }
+
+  // release times of the frames submitted to the work queue
+  // at most two frames may be pending (one queued and one running)
+  struct TickTimes {
+    static constexpr uint8_t kSize         = 2;
+    std::chrono::microseconds times[kSize] = {};
+    uint8_t count                          = 0;
+
+    void push(const std::chrono::microseconds& time) {
+      if (count == kSize) {
+        // should not happen, keep the most recent release times
+        times[0] = times[1];
+        count--;
+      }
+      times[count++] = time;
+    }
+
+    std::chrono::microseconds pop(const std::chrono::microseconds& defaultTime) {
+      if (count == 0) {
+        return defaultTime;
+      }
+      const auto time = times[0];
+      times[0]        = times[1];
+      count--;
+      return time;
+    }
+  };
+
+  // aperiodic job queued for the polling server
+  struct AperiodicJob {
+    F function                           = nullptr;
+    std::chrono::microseconds wcet       = std::chrono::microseconds::zero();
+    std::chrono::microseconds submitTime = std::chrono::microseconds::zero();
+  };
+
   // _work MUST be the first attribute
   struct k_work _work;
   struct k_work_q _workQueue;
@@ -145,8 +539,28 @@ class TTCE : private zpp_lib::NonCopyable<TTCE<F, NbrOfMinorCycles, MaxMinorCycl
   struct k_timer _timer;
   std::chrono::milliseconds _minorCycle;
   uint16_t _minorCycleIndex                          = 0;
+  uint32_t _frameNumber                              = 0;
   F _tasks[NbrOfMinorCycles][MaxMinorCycleSize]      = {nullptr};
   uint16_t _nbrOfTasksInMinorCycle[NbrOfMinorCycles] = {0};
+  // criticality of each task, stored apart from the tasks to keep them packed
+  Criticality _criticalities[NbrOfMinorCycles][MaxMinorCycleSize] = {};
+  // Lo-mode budget of each task (only used for Hi tasks)
+  std::chrono::microseconds _budgets[NbrOfMinorCycles][MaxMinorCycleSize] = {};
+  // mixed-criticality mode (only modified by the work queue thread)
+  Criticality _mode                 = Criticality::Lo;
+  uint16_t _nbrOfFramesWithinBudget = 0;
+  // frame statistics, shared between the timer ISR and the work queue thread
+  mutable struct k_spinlock _statsLock;
+  TickTimes _tickTimes;
+  Stats _stats;
+  // polling server, producers are serialized by locking interrupts
+  std::chrono::microseconds _serverBudget = std::chrono::microseconds::zero();
+  SpscRing<AperiodicJob, AperiodicQueueSize> _aperiodicJobs;
+  AperiodicJob _pendingJob;
+  bool _hasPendingJob = false;
+  // deferred frame logging
+  static constexpr uint16_t kFrameRecordsSize = 32;
+  SpscRing<FrameRecord, kFrameRecordsSize> _frameRecords;
 };
 
 }  // namespace bike_computer
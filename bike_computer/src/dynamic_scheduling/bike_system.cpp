@@ -0,0 +1,366 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file bike_system.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike System implementation (dynamic scheduling)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "bike_system.hpp"
+
+// std
+#include <chrono>
+#include <functional>
+
+// zephyr
+// false positive cpplint warning
+// NOLINTNEXTLINE(build/include_order)
+#include <zephyr/logging/log.h>
+
+// zpp_lib
+#include "zpp_include/time.hpp"
+
+// from common
+#include "common/absolute_time.hpp"
+#include "common/schedulability_report.hpp"
+
+LOG_MODULE_DECLARE(bike_computer, CONFIG_APP_LOG_LEVEL);
+
+namespace bike_computer {
+
+namespace dynamic_scheduling {
+
+BikeSystem::BikeSystem()
+    : _gearThread(getTaskPriority(TaskManager::TaskType::GearTaskType), "Gear"),
+      _speedDistanceThread(getTaskPriority(TaskManager::TaskType::SpeedTaskType),
+                           "SpeedDistance"),
+      _temperatureThread(getTaskPriority(TaskManager::TaskType::TemperatureTaskType),
+                         "Temperature"),
+      _resetThread(getTaskPriority(TaskManager::TaskType::ResetTaskType), "Reset"),
+      _displayThread1(getTaskPriority(TaskManager::TaskType::DisplayTask1Type),
+                      "Display1"),
+      _displayThread2(getTaskPriority(TaskManager::TaskType::DisplayTask2Type),
+                      "Display2") {}
+
+zpp_lib::PreemptableThreadPriority BikeSystem::getTaskPriority(
+    TaskManager::TaskType taskType) {
+  // priorities from highest to lowest
+  static constexpr zpp_lib::PreemptableThreadPriority kPriorities[] = {
+      zpp_lib::PreemptableThreadPriority::PriorityHigh,
+      zpp_lib::PreemptableThreadPriority::PriorityAboveNormal,
+      zpp_lib::PreemptableThreadPriority::PriorityNormal,
+      zpp_lib::PreemptableThreadPriority::PriorityBelowNormal};
+  static constexpr uint8_t kNbrOfPriorities =
+      sizeof(kPriorities) / sizeof(kPriorities[0]);
+
+  // the priority rank is the number of distinct periods shorter than the task period
+  const auto period = TaskManager::kTaskPeriods[(uint8_t)taskType];
+  uint8_t rank      = 0;
+  for (uint8_t taskIndex = 0; taskIndex < TaskManager::kNbrOfTaskTypes; taskIndex++) {
+    const auto otherPeriod = TaskManager::kTaskPeriods[taskIndex];
+    if (otherPeriod >= period) {
+      continue;
+    }
+    // count each distinct period only once
+    bool isFirst = true;
+    for (uint8_t index = 0; index < taskIndex; index++) {
+      if (TaskManager::kTaskPeriods[index] == otherPeriod) {
+        isFirst = false;
+      }
+    }
+    if (isFirst) {
+      rank++;
+    }
+  }
+  __ASSERT(rank < kNbrOfPriorities, "Not enough priorities for rank %d", rank);
+  return kPriorities[rank < kNbrOfPriorities ? rank : kNbrOfPriorities - 1];
+}
+
+zpp_lib::ZephyrResult BikeSystem::start() {
+  LOG_INF("Starting rate monotonic scheduling");
+
+  auto res = initialize();
+  if (!res) {
+    LOG_ERR("Init failed: %d", (int)res.error());
+    return res;
+  }
+
+  // initialize the task manager phase: all tasks are released at this time
+  _taskManager.initializePhase();
+
+#if CONFIG_BIKE_SPEEDOMETER_SAMPLING == 1
+  // the speedometer samples the pedal rotation time and the gear size on its own
+  // thread and the speed task only reads the results
+  res = _speedometer.startSampling(
+      [this]() { return _pedalDevice.getCurrentRotationTime(); },
+      [this]() { return _bikeState.gear.read().gearSize; });
+  if (!res) {
+    LOG_ERR("Cannot start speedometer sampling: %d", (int)res.error());
+    return res;
+  }
+#endif  // CONFIG_BIKE_SPEEDOMETER_SAMPLING == 1
+
+  struct ThreadInfo {
+    zpp_lib::Thread& thread;
+    TaskManager::TaskType taskType;
+    TaskMethod task;
+  };
+  ThreadInfo threads[] = {
+      {_gearThread, TaskManager::TaskType::GearTaskType, &BikeSystem::gearTask},
+      {_speedDistanceThread,
+       TaskManager::TaskType::SpeedTaskType,
+       &BikeSystem::speedDistanceTask},
+      {_temperatureThread,
+       TaskManager::TaskType::TemperatureTaskType,
+       &BikeSystem::temperatureTask},
+      {_resetThread, TaskManager::TaskType::ResetTaskType, &BikeSystem::resetTask},
+      {_displayThread1,
+       TaskManager::TaskType::DisplayTask1Type,
+       &BikeSystem::displayTask1},
+      {_displayThread2,
+       TaskManager::TaskType::DisplayTask2Type,
+       &BikeSystem::displayTask2}};
+
+  // only the threads started successfully can be joined
+  uint8_t nbrOfStartedThreads = 0;
+  for (auto& threadInfo : threads) {
+    res = threadInfo.thread.start(std::bind(
+        &BikeSystem::runPeriodicTask, this, threadInfo.taskType, threadInfo.task));
+    if (!res) {
+      LOG_ERR("Cannot start task thread: %d", (int)res.error());
+      stop();
+      break;
+    }
+    nbrOfStartedThreads++;
+  }
+
+  // wait for the system to be stopped and for the started task threads to exit
+  _events.wait_any(kStoppedEvent);
+  for (uint8_t threadIndex = 0; threadIndex < nbrOfStartedThreads; threadIndex++) {
+    auto joinRes = threads[threadIndex].thread.join();
+    if (!joinRes) {
+      LOG_ERR("Cannot join task thread: %d", (int)joinRes.error());
+    }
+  }
+
+#if CONFIG_BIKE_SPEEDOMETER_SAMPLING == 1
+  _speedometer.stopSampling();
+  const SpeedStatistics statistics = _speedometer.getStatistics();
+  LOG_INF("Speedometer: average speed %u m/h, max speed %u m/h, cadence %u turns/min",
+          statistics.averageSpeed,
+          statistics.maxSpeed,
+          statistics.cadence);
+#endif  // CONFIG_BIKE_SPEEDOMETER_SAMPLING == 1
+
+  _taskManager.logTaskStatistics();
+  logSchedulabilityReport(_taskManager);
+
+  return res;
+}
+
+void BikeSystem::stop() {
+  atomic_set_bit(&_stopFlag, 1);
+  _events.set(kStoppedEvent);
+}
+
+zpp_lib::ZephyrResult BikeSystem::initialize() {
+  // the tasks sleep through most of their simulated computation time, which releases
+  // the CPU for the lower priority threads (logging, sensor, speedometer sampling)
+  _taskManager.setSimulationMode(TaskManager::SimulationMode::SleepMode,
+                                 TaskManager::kSleepModeBusyPercentage);
+  auto res = _taskManager.startLogging();
+  if (!res) {
+    LOG_ERR("Cannot start task logging: %d", (int)res.error());
+    return res;
+  }
+
+  // initialize the display
+  res = _bikeDisplay.initialize();
+  if (!res) {
+    LOG_ERR("Cannot initialize display: %d", (int)res.error());
+    return res;
+  }
+
+  // initialize the sensor device
+  res = _sensorDevice.initialize();
+  if (!res) {
+    LOG_ERR("Sensor not present or initialization failed: %d", (int)res.error());
+  } else {
+#if CONFIG_BIKE_SENSOR_STREAMING == 1
+    // sample the sensor at a higher rate and get one filtered sample per
+    // temperature task period
+    static constexpr std::chrono::milliseconds kSamplingPeriod = 100ms;
+    static constexpr auto kDecimationFactor =
+        TaskManager::kTaskPeriods[(uint8_t)TaskManager::TaskType::TemperatureTaskType] /
+        kSamplingPeriod;
+    res = _sensorDevice.startStreaming(kSamplingPeriod, kDecimationFactor);
+    if (!res) {
+      LOG_ERR("Cannot start sensor streaming: %d", (int)res.error());
+    }
+#else
+    // request the first sample
+    res = _sensorDevice.requestSample();
+    if (!res) {
+      LOG_ERR("Cannot request sensor sample: %d", (int)res.error());
+    }
+#endif  // CONFIG_BIKE_SENSOR_STREAMING == 1
+  }
+
+  return zpp_lib::ZephyrResult();
+}
+
+void BikeSystem::runPeriodicTask(TaskManager::TaskType taskType, TaskMethod task) {
+  const auto period = TaskManager::kTaskPeriods[(uint8_t)taskType];
+  // releases are computed from the phase, so that no drift accumulates
+  auto releaseTime = _taskManager.getPhase();
+  while (!atomic_test_bit(&_stopFlag, 1)) {
+    sleepUntil(releaseTime);
+    (this->*task)();
+    releaseTime += period;
+  }
+}
+
+void BikeSystem::gearTask() {
+  // gear task
+  _taskManager.registerTaskStart(TaskManager::TaskType::GearTaskType);
+
+  GearState gearState;
+  gearState.gear     = _gearDevice.getCurrentGear();
+  gearState.gearSize = _gearDevice.getCurrentGearSize();
+  _bikeState.gear.publish(gearState);
+
+  _taskManager.simulateComputationTime(TaskManager::TaskType::GearTaskType);
+}
+
+void BikeSystem::speedDistanceTask() {
+  // speed and distance task
+  _taskManager.registerTaskStart(TaskManager::TaskType::SpeedTaskType);
+
+#if CONFIG_BIKE_SPEEDOMETER_SAMPLING != 1
+  const auto pedalRotationTime = _pedalDevice.getCurrentRotationTime();
+  _speedometer.setCurrentRotationTime(pedalRotationTime);
+  _speedometer.setGearSize(_bikeState.gear.read().gearSize);
+#endif  // CONFIG_BIKE_SPEEDOMETER_SAMPLING != 1
+  SpeedState speedState;
+  speedState.speed    = _speedometer.getCurrentSpeed();
+  speedState.distance = _speedometer.getDistance();
+  _bikeState.speed.publish(speedState);
+
+  _taskManager.simulateComputationTime(TaskManager::TaskType::SpeedTaskType);
+}
+
+void BikeSystem::temperatureTask() {
+  _taskManager.registerTaskStart(TaskManager::TaskType::TemperatureTaskType);
+
+#if CONFIG_BIKE_SENSOR_STREAMING == 1
+  // publish the sample filtered from the samples queued since the previous release
+  SensorSample sample;
+  auto res = _sensorDevice.readFilteredSample(sample);
+  if (res) {
+    TemperatureState temperatureState;
+    temperatureState.temperature = sample.temperature;
+    _bikeState.temperature.publish(temperatureState);
+  }
+#else
+  // publish the sample fetched since the previous release and request the next
+  // one, so that the task never waits for the sensor
+  static constexpr auto kMaxSampleAge =
+      2 * TaskManager::kTaskPeriods[(uint8_t)TaskManager::TaskType::TemperatureTaskType];
+  SensorSample sample;
+  auto res = _sensorDevice.getSample(sample, kMaxSampleAge);
+  if (res) {
+    TemperatureState temperatureState;
+    temperatureState.temperature = sample.temperature;
+    _bikeState.temperature.publish(temperatureState);
+  }
+  res = _sensorDevice.requestSample();
+  if (!res) {
+    LOG_DBG("Cannot request sensor sample: %d", (int)res.error());
+  }
+#endif  // CONFIG_BIKE_SENSOR_STREAMING == 1
+
+  // simulate task computation by waiting for the required task computation time
+  _taskManager.simulateComputationTime(TaskManager::TaskType::TemperatureTaskType);
+}
+
+void BikeSystem::resetTask() {
+  _taskManager.registerTaskStart(TaskManager::TaskType::ResetTaskType);
+
+  // each queued press is reported with its own response time
+  while (_resetDevice.checkReset()) {
+    std::chrono::microseconds responseTime =
+        zpp_lib::Time::getUpTime() - _resetDevice.getPressTime();
+    LOG_INF("Reset task: response time is %" PRIu64 " usecs", responseTime.count());
+    _speedometer.reset();
+  }
+
+  _taskManager.simulateComputationTime(TaskManager::TaskType::ResetTaskType);
+}
+
+void BikeSystem::lockDisplay() {
+  auto res = _displayMutex.lock();
+  if (!res) {
+    LOG_ERR("Cannot lock display mutex: %d", (int)res.error());
+  }
+}
+
+void BikeSystem::unlockDisplay() {
+  auto res = _displayMutex.unlock();
+  if (!res) {
+    LOG_ERR("Cannot unlock display mutex: %d", (int)res.error());
+  }
+}
+
+void BikeSystem::displayTask1() {
+  _taskManager.registerTaskStart(TaskManager::TaskType::DisplayTask1Type);
+
+  // the display is refreshed at a lower rate in Hi mode
+  if (!_taskManager.isTaskShed(TaskManager::TaskType::DisplayTask1Type)) {
+    // read a consistent snapshot of the published states
+    const GearState gearState   = _bikeState.gear.read();
+    const SpeedState speedState = _bikeState.speed.read();
+    lockDisplay();
+    _bikeDisplay.displayGear(gearState.gear);
+    _bikeDisplay.displaySpeed(speedState.speed);
+    _bikeDisplay.displayDistance(speedState.distance);
+    // a single transfer for the three info boxes
+    _bikeDisplay.flush();
+    unlockDisplay();
+  }
+
+  _taskManager.simulateComputationTime(TaskManager::TaskType::DisplayTask1Type);
+}
+
+void BikeSystem::displayTask2() {
+  _taskManager.registerTaskStart(TaskManager::TaskType::DisplayTask2Type);
+
+  if (!_taskManager.isTaskShed(TaskManager::TaskType::DisplayTask2Type)) {
+    const float temperature = _bikeState.temperature.read().temperature;
+    lockDisplay();
+    _bikeDisplay.displayTemperature(temperature);
+    _bikeDisplay.flush();
+    unlockDisplay();
+  }
+
+  _taskManager.simulateComputationTime(TaskManager::TaskType::DisplayTask2Type);
+}
+
+}  // namespace dynamic_scheduling
+
+}  // namespace bike_computer
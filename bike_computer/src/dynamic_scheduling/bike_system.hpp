@@ -0,0 +1,126 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file bike_system.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike System header file (dynamic scheduling)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// zephyr
+#include <zephyr/kernel.h>
+
+// from static scheduling (with event)
+#include "static_scheduling/reset_device.hpp"
+#include "static_scheduling_with_event/gear_device.hpp"
+#include "static_scheduling_with_event/pedal_device.hpp"
+
+// zpp_lib
+#include "zpp_include/events.hpp"
+#include "zpp_include/mutex.hpp"
+#include "zpp_include/thread.hpp"
+
+// from common
+#include "common/bike_display.hpp"
+#include "common/bike_state.hpp"
+#include "common/sensor_device.hpp"
+#include "common/speedometer.hpp"
+#include "common/task_manager.hpp"
+
+namespace bike_computer {
+
+namespace dynamic_scheduling {
+
+// Each task runs in its own thread, released periodically at absolute times.
+// Thread priorities are assigned with the rate monotonic policy (the shorter
+// the period, the higher the priority).
+class BikeSystem : private zpp_lib::NonCopyable<BikeSystem> {
+ public:
+  // constructor
+  BikeSystem();
+
+  // method called in main() for starting the system
+  // returns once the system is stopped
+  [[nodiscard]] zpp_lib::ZephyrResult start();
+
+  // method called for stopping the system
+  void stop();
+
+  // rate monotonic priority of a task
+  static zpp_lib::PreemptableThreadPriority getTaskPriority(
+      TaskManager::TaskType taskType);
+
+  // methods used for tests only
+#if CONFIG_TEST == 1
+  const TaskManager& getTaskManager() const { return _taskManager; }
+#endif  // CONFIG_TEST == 1
+
+ private:
+  using TaskMethod = void (BikeSystem::*)();
+
+  // private methods
+  [[nodiscard]] zpp_lib::ZephyrResult initialize();
+  void runPeriodicTask(TaskManager::TaskType taskType, TaskMethod task);
+  void gearTask();
+  void speedDistanceTask();
+  void temperatureTask();
+  void resetTask();
+  void displayTask1();
+  void displayTask2();
+  // the display tasks run in different threads and BikeDisplay (with its glyph
+  // cache, image chunk and frame buffer) must be used by one thread at a time
+  void lockDisplay();
+  void unlockDisplay();
+
+  // stop flag, used for stopping the task threads (set in stop())
+  atomic_t _stopFlag                     = ATOMIC_INIT(0x00);
+  static constexpr uint8_t kStoppedEvent = BIT(0);
+  zpp_lib::Events _events;
+  // one thread per task type
+  zpp_lib::Thread _gearThread;
+  zpp_lib::Thread _speedDistanceThread;
+  zpp_lib::Thread _temperatureThread;
+  zpp_lib::Thread _resetThread;
+  zpp_lib::Thread _displayThread1;
+  zpp_lib::Thread _displayThread2;
+  // data member that represents the device for manipulating the gear
+  static_scheduling_with_event::GearDevice _gearDevice;
+  // data member that represents the device for manipulating the pedal rotation
+  // speed/time
+  static_scheduling_with_event::PedalDevice _pedalDevice;
+  // data member that represents the device used for resetting
+  static_scheduling::ResetDevice _resetDevice;
+  // data member that represents the display
+  BikeDisplay _bikeDisplay;
+  zpp_lib::Mutex _displayMutex;
+  // data member that represents the device for counting wheel rotations
+  Speedometer _speedometer;
+  // data member that represents the sensor device
+  SensorDevice _sensorDevice;
+  // state published by the gear, speed and temperature tasks
+  BikeState _bikeState;
+
+  // used for managing tasks info
+  TaskManager _taskManager;
+};
+
+}  // namespace dynamic_scheduling
+
+}  // namespace bike_computer
@@ -34,6 +34,8 @@
 
 // from common
 #include "common/bike_display.hpp"
+#include "common/bike_schedule.hpp"
+#include "common/bike_state.hpp"
 #include "common/sensor_device.hpp"
 #include "common/speedometer.hpp"
 #include "common/task_manager.hpp"
@@ -67,13 +69,9 @@ class BikeSystem : private zpp_lib::NonCopyable<BikeSystem> {
   atomic_t _stopFlag = ATOMIC_INIT(0x00);
   // data member that represents the device for manipulating the gear
   GearDevice _gearDevice;
-  uint8_t _currentGear     = bike_computer::kMinGear;
-  uint8_t _currentGearSize = bike_computer::kMinGearSize;
   // data member that represents the device for manipulating the pedal rotation
   // speed/time
   PedalDevice _pedalDevice;
-  float _currentSpeed     = 0.0f;
-  float _traveledDistance = 0.0f;
   // data member that represents the device used for resetting
   ResetDevice _resetDevice;
   // data member that represents the display
@@ -82,7 +80,8 @@ class BikeSystem : private zpp_lib::NonCopyable<BikeSystem> {
   Speedometer _speedometer;
   // data member that represents the sensor device
   SensorDevice _sensorDevice;
-  float _currentTemperature = 0.0f;
+  // state published by the gear, speed and temperature tasks
+  BikeState _bikeState;
 
   // used for managing tasks info
   TaskManager _taskManager;
@@ -37,6 +37,11 @@
 #include "zpp_include/time.hpp"
 #include "zpp_include/work_queue.hpp"
 
+// from common
+#include "common/absolute_time.hpp"
+#include "common/schedulability_report.hpp"
+#include "common/trace_events.hpp"
+
 LOG_MODULE_DECLARE(bike_computer, CONFIG_APP_LOG_LEVEL);
 
 namespace bike_computer {
@@ -54,34 +59,56 @@ zpp_lib::ZephyrResult BikeSystem::start() {
 
   LOG_DBG("Starting super-loop");
 
-  // initialize the task manager phase
+  // initialize the task manager phase, which is the epoch of all releases
   _taskManager.initializePhase();
+  const std::chrono::microseconds epoch = _taskManager.getPhase();
+
+  uint32_t iteration = 0;
+  // number of frames run so far (for tracing)
+  uint32_t frameNumber = 0;
+  // tasks indexed by TaskManager::TaskType, as used in kBikeSchedule
+  using TaskMethod = void (BikeSystem::*)();
+  static constexpr TaskMethod kTasks[TaskManager::kNbrOfTaskTypes] = {
+      &BikeSystem::gearTask,
+      &BikeSystem::speedDistanceTask,
+      &BikeSystem::temperatureTask,
+      &BikeSystem::resetTask,
+      &BikeSystem::displayTask1,
+      &BikeSystem::displayTask2};
 
-  uint32_t iteration                                 = 0;
-  static constexpr uint32_t iterationsForFixingDrift = 10;
   while (true) {
-    auto startTime = zpp_lib::Time::getUpTime();
-
-    // TODO: implement calls to different tasks based on computed schedule
+    // each major cycle is released at an absolute time computed from the epoch,
+    // so that the delays of a cycle never accumulate into the next ones
+    const auto startTime = epoch + kBikeSchedule.hyperperiod * iteration;
+
+    // run the tasks of each minor cycle as computed by the schedule synthesizer
+    for (uint16_t frameIndex = 0; frameIndex < kBikeSchedule.nbrOfFrames; frameIndex++) {
+      // frames are not started before their release time, the slack left by frames
+      // ending early (e.g. with dropped or shed tasks) is slept
+      const auto frameStartTime = startTime + kBikeSchedule.minorCycle * frameIndex;
+      sleepUntil(frameStartTime);
+      trace_events::frameStart(frameIndex, frameNumber);
+      for (uint16_t jobIndex = 0; jobIndex < kBikeSchedule.frameSizes[frameIndex];
+           jobIndex++) {
+        (this->*kTasks[kBikeSchedule.frames[frameIndex][jobIndex]])();
+      }
+      trace_events::frameEnd(frameIndex, frameNumber);
+      frameNumber++;
+    }
 
-    // register the time at the end of the cyclic schedule period and print the
-    // elapsed time for the period
+    // register the time at the end of the cyclic schedule period and log the
+    // elapsed time for the period (formatted outside of the super-loop)
     std::chrono::microseconds endTime = zpp_lib::Time::getUpTime();
-    const auto cycle =
-        std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
-    LOG_DBG("Repeating cycle time is %" PRIu64 " milliseconds", cycle.count());
+    _taskManager.logCycleTime(iteration, startTime, endTime);
+    iteration++;
 
     if (atomic_test_bit(&_stopFlag, 1)) {
       break;
     }
-
-    // fix the schedule drift to pass the tests
-    // this demonstrates that static scheduling is very sensitive to overload
-    if (iteration % iterationsForFixingDrift == 0) {
-      _taskManager.initializePhase();
-    }
   }
 
+  logSchedulabilityReport(_taskManager);
+
   return res;
 }
 
@@ -93,8 +120,18 @@ void BikeSystem::stop() {
 }
 
 zpp_lib::ZephyrResult BikeSystem::initialize() {
+  // the frames are fully packed, so the processor can only idle during the tasks:
+  // they sleep through most of their simulated computation time
+  _taskManager.setSimulationMode(TaskManager::SimulationMode::SleepMode,
+                                 TaskManager::kSleepModeBusyPercentage);
+  auto res = _taskManager.startLogging();
+  if (!res) {
+    LOG_ERR("Cannot start task logging: %d", (int)res.error());
+    return res;
+  }
+
   // initialize the display
-  auto res = _bikeDisplay.initialize();
+  res = _bikeDisplay.initialize();
   if (!res) {
     LOG_ERR("Cannot initialize display: %d", (int)res.error());
     return res;
@@ -104,6 +141,25 @@ zpp_lib::ZephyrResult BikeSystem::initialize() {
   res = _sensorDevice.initialize();
   if (!res) {
     LOG_ERR("Sensor not present or initialization failed: %d", (int)res.error());
+  } else {
+#if CONFIG_BIKE_SENSOR_STREAMING == 1
+    // sample the sensor at a higher rate and get one filtered sample per
+    // temperature task period
+    static constexpr std::chrono::milliseconds kSamplingPeriod = 100ms;
+    static constexpr auto kDecimationFactor =
+        TaskManager::kTaskPeriods[(uint8_t)TaskManager::TaskType::TemperatureTaskType] /
+        kSamplingPeriod;
+    res = _sensorDevice.startStreaming(kSamplingPeriod, kDecimationFactor);
+    if (!res) {
+      LOG_ERR("Cannot start sensor streaming: %d", (int)res.error());
+    }
+#else
+    // request the first sample
+    res = _sensorDevice.requestSample();
+    if (!res) {
+      LOG_ERR("Cannot request sensor sample: %d", (int)res.error());
+    }
+#endif  // CONFIG_BIKE_SENSOR_STREAMING == 1
   }
 
   return zpp_lib::ZephyrResult();
@@ -113,9 +169,10 @@ void BikeSystem::gearTask() {
   // gear task
   _taskManager.registerTaskStart(TaskManager::TaskType::GearTaskType);
 
-  // no need to protect access to data members (single threaded)
-  _currentGear     = _gearDevice.getCurrentGear();
-  _currentGearSize = _gearDevice.getCurrentGearSize();
+  GearState gearState;
+  gearState.gear     = _gearDevice.getCurrentGear();
+  gearState.gearSize = _gearDevice.getCurrentGearSize();
+  _bikeState.gear.publish(gearState);
 
   _taskManager.simulateComputationTime(TaskManager::TaskType::GearTaskType);
 }
@@ -126,10 +183,11 @@ void BikeSystem::speedDistanceTask() {
 
   const auto pedalRotationTime = _pedalDevice.getCurrentRotationTime();
   _speedometer.setCurrentRotationTime(pedalRotationTime);
-  _speedometer.setGearSize(_currentGearSize);
-  // no need to protect access to data members (single threaded)
-  _currentSpeed     = _speedometer.getCurrentSpeed();
-  _traveledDistance = _speedometer.getDistance();
+  _speedometer.setGearSize(_bikeState.gear.read().gearSize);
+  SpeedState speedState;
+  speedState.speed    = _speedometer.getCurrentSpeed();
+  speedState.distance = _speedometer.getDistance();
+  _bikeState.speed.publish(speedState);
 
   _taskManager.simulateComputationTime(TaskManager::TaskType::SpeedTaskType);
 }
@@ -137,8 +195,33 @@ void BikeSystem::speedDistanceTask() {
 void BikeSystem::temperatureTask() {
   _taskManager.registerTaskStart(TaskManager::TaskType::TemperatureTaskType);
 
-  // TO DO: read temperature from _sensorDevice
-  
+#if CONFIG_BIKE_SENSOR_STREAMING == 1
+  // publish the sample filtered from the samples queued since the previous release
+  SensorSample sample;
+  auto res = _sensorDevice.readFilteredSample(sample);
+  if (res) {
+    TemperatureState temperatureState;
+    temperatureState.temperature = sample.temperature;
+    _bikeState.temperature.publish(temperatureState);
+  }
+#else
+  // publish the sample fetched since the previous release and request the next
+  // one, so that the task never waits for the sensor
+  static constexpr auto kMaxSampleAge =
+      2 * TaskManager::kTaskPeriods[(uint8_t)TaskManager::TaskType::TemperatureTaskType];
+  SensorSample sample;
+  auto res = _sensorDevice.getSample(sample, kMaxSampleAge);
+  if (res) {
+    TemperatureState temperatureState;
+    temperatureState.temperature = sample.temperature;
+    _bikeState.temperature.publish(temperatureState);
+  }
+  res = _sensorDevice.requestSample();
+  if (!res) {
+    LOG_DBG("Cannot request sensor sample: %d", (int)res.error());
+  }
+#endif  // CONFIG_BIKE_SENSOR_STREAMING == 1
+
   // simulate task computation by waiting for the required task computation time
   _taskManager.simulateComputationTime(TaskManager::TaskType::TemperatureTaskType);
 }
@@ -146,7 +229,8 @@ void BikeSystem::temperatureTask() {
 void BikeSystem::resetTask() {
   _taskManager.registerTaskStart(TaskManager::TaskType::ResetTaskType);
 
-  if (_resetDevice.checkReset()) {
+  // each queued press is reported with its own response time
+  while (_resetDevice.checkReset()) {
     std::chrono::microseconds responseTime =
         zpp_lib::Time::getUpTime() - _resetDevice.getPressTime();
     LOG_INF("Reset task: response time is %" PRIu64 " usecs", responseTime.count());
@@ -159,16 +243,29 @@ void BikeSystem::resetTask() {
 void BikeSystem::displayTask1() {
   _taskManager.registerTaskStart(TaskManager::TaskType::DisplayTask1Type);
 
-  // TODO: update gear, speed and distance displayed on screen
-  
+  // the display is refreshed at a lower rate in Hi mode
+  if (!_taskManager.isTaskShed(TaskManager::TaskType::DisplayTask1Type)) {
+    // read a consistent snapshot of the published states
+    const GearState gearState   = _bikeState.gear.read();
+    const SpeedState speedState = _bikeState.speed.read();
+    _bikeDisplay.displayGear(gearState.gear);
+    _bikeDisplay.displaySpeed(speedState.speed);
+    _bikeDisplay.displayDistance(speedState.distance);
+    // a single transfer for the three info boxes
+    _bikeDisplay.flush();
+  }
+
   _taskManager.simulateComputationTime(TaskManager::TaskType::DisplayTask1Type);
 }
 
 void BikeSystem::displayTask2() {
   _taskManager.registerTaskStart(TaskManager::TaskType::DisplayTask2Type);
 
-  // TODO: update temperature on screen
-  
+  if (!_taskManager.isTaskShed(TaskManager::TaskType::DisplayTask2Type)) {
+    _bikeDisplay.displayTemperature(_bikeState.temperature.read().temperature);
+    _bikeDisplay.flush();
+  }
+
   _taskManager.simulateComputationTime(TaskManager::TaskType::DisplayTask2Type);
 }
 
@@ -0,0 +1,56 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file reset_device.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief ResetDevice implementation (static scheduling)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+
+#include "reset_device.hpp"
+
+// std
+#include <functional>
+
+namespace bike_computer {
+
+namespace static_scheduling {
+
+ResetDevice::ResetDevice() {
+  _button1.fall(std::bind(&ResetDevice::onFallButton1, this));
+}
+
+bool ResetDevice::checkReset() {
+  InputEvent event;
+  if (!_events.get(event)) {
+    return false;
+  }
+  _pressTime = event.time;
+  return true;
+}
+
+std::chrono::microseconds ResetDevice::getPressTime() { return _pressTime; }
+
+uint32_t ResetDevice::getNbrOfLostEvents() const { return _events.getNbrOfOverflows(); }
+
+void ResetDevice::onFallButton1() { _events.post(InputEvent::Type::Reset); }
+
+}  // namespace static_scheduling
+
+}  // namespace bike_computer
@@ -27,6 +27,9 @@
 // std
 #include <chrono>
 
+// local
+#include "common/input_event_queue.hpp"
+
 // zpp_lib
 #include "zpp_include/interrupt_in.hpp"
 #include "zpp_include/non_copyable.hpp"
@@ -40,18 +43,25 @@ class ResetDevice : private zpp_lib::NonCopyable<ResetDevice> {
   ResetDevice();
 
   // method called for checking the reset status
+  // each press is reported by one call, in order
   bool checkReset();
 
-  // for computing the response time
+  // for computing the response time (press time of the last reported reset)
   std::chrono::microseconds getPressTime();
 
+  // number of presses lost because the event queue was full
+  uint32_t getNbrOfLostEvents() const;
+
  private:
   // called when one of the buttons is pressed
   void onFallButton1();
 
   // data members
   zpp_lib::InterruptIn<zpp_lib::PinName::BUTTON1> _button1;
-  std::chrono::microseconds _pressTime;
+  // presses posted in ISR and not yet reported
+  static constexpr uint16_t kEventQueueSize = 8;
+  InputEventQueue<kEventQueueSize> _events;
+  std::chrono::microseconds _pressTime = std::chrono::microseconds::zero();
 };
 
 }  // namespace static_scheduling
@@ -0,0 +1,87 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file gear_device.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief GearDevice implementation (static scheduling with event)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "gear_device.hpp"
+
+// zephyr
+#include <zephyr/logging/log.h>
+
+// std
+#include <cinttypes>
+#include <functional>
+
+// zpp_lib
+#include "zpp_include/time.hpp"
+
+LOG_MODULE_DECLARE(bike_computer, CONFIG_APP_LOG_LEVEL);
+
+namespace bike_computer {
+
+namespace static_scheduling_with_event {
+
+GearDevice::GearDevice() {
+  _button3.fall(std::bind(&GearDevice::onFallButton3, this));
+  _button4.fall(std::bind(&GearDevice::onFallButton4, this));
+}
+
+uint8_t GearDevice::getCurrentGear() {
+  // apply the changes requested since the last call, in order
+  InputEvent event;
+  while (_events.get(event)) {
+    if (event.type == InputEvent::Type::GearUp &&
+        _currentGear < bike_computer::kMaxGear) {
+      _currentGear++;
+    } else if (event.type == InputEvent::Type::GearDown &&
+               _currentGear > bike_computer::kMinGear) {
+      _currentGear--;
+    }
+    LOG_DBG("Gear event latency: %" PRIu64 " usecs",
+            (zpp_lib::Time::getUpTime() - event.time).count());
+  }
+  return _currentGear;
+}
+
+uint8_t GearDevice::getCurrentGearSize() const {
+  return bike_computer::kMaxGearSize - _currentGear;
+}
+
+uint32_t GearDevice::getNbrOfLostEvents() const { return _events.getNbrOfOverflows(); }
+
+void GearDevice::onFallButton3() {
+  // the gear decreases when button3 is pressed while button2 is pressed
+  if (_button3Debouncer.accept() && _button2.read() == zpp_lib::kPolarityPressed) {
+    _events.post(InputEvent::Type::GearDown);
+  }
+}
+
+void GearDevice::onFallButton4() {
+  // the gear increases when button4 is pressed while button2 is pressed
+  if (_button4Debouncer.accept() && _button2.read() == zpp_lib::kPolarityPressed) {
+    _events.post(InputEvent::Type::GearUp);
+  }
+}
+
+}  // namespace static_scheduling_with_event
+
+}  // namespace bike_computer
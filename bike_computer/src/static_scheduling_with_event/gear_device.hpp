@@ -0,0 +1,77 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file gear_device.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief GearDevice header file (static scheduling with event)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// zephyr
+#include <zephyr/kernel.h>
+
+// local
+#include "common/constants.hpp"
+#include "common/edge_debouncer.hpp"
+#include "common/input_event_queue.hpp"
+
+// zpp_lib
+#include "zpp_include/interrupt_in.hpp"
+#include "zpp_include/non_copyable.hpp"
+
+namespace bike_computer {
+
+namespace static_scheduling_with_event {
+
+// Interrupt driven gear device: gear changes are queued in the button ISRs and
+// applied when the gear task calls getCurrentGear()
+class GearDevice : private zpp_lib::NonCopyable<GearDevice> {
+ public:
+  GearDevice();
+
+  // method called for updating the bike system
+  uint8_t getCurrentGear();
+  uint8_t getCurrentGearSize() const;
+
+  // number of gear changes lost because the event queue was full
+  uint32_t getNbrOfLostEvents() const;
+
+ private:
+  // called when button3/button4 is pressed
+  void onFallButton3();
+  void onFallButton4();
+
+  // data members
+  uint8_t _currentGear = bike_computer::kMinGear;
+  // gear changes requested since the last call to getCurrentGear() (posted in ISR)
+  static constexpr uint16_t kEventQueueSize = 16;
+  InputEventQueue<kEventQueueSize> _events;
+  EdgeDebouncer _button3Debouncer;
+  EdgeDebouncer _button4Debouncer;
+
+  // buttons
+  zpp_lib::InterruptIn<zpp_lib::PinName::BUTTON2> _button2;
+  zpp_lib::InterruptIn<zpp_lib::PinName::BUTTON3> _button3;
+  zpp_lib::InterruptIn<zpp_lib::PinName::BUTTON4> _button4;
+};
+
+}  // namespace static_scheduling_with_event
+
+}  // namespace bike_computer
@@ -0,0 +1,86 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file pedal_device.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief PedalDevice implementation (static scheduling with event)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "pedal_device.hpp"
+
+// zephyr
+#include <zephyr/logging/log.h>
+
+// std
+#include <cinttypes>
+#include <functional>
+
+// zpp_lib
+#include "zpp_include/time.hpp"
+
+LOG_MODULE_DECLARE(bike_computer, CONFIG_APP_LOG_LEVEL);
+
+namespace bike_computer {
+
+namespace static_scheduling_with_event {
+
+PedalDevice::PedalDevice() {
+  _button3.fall(std::bind(&PedalDevice::onFallButton3, this));
+  _button4.fall(std::bind(&PedalDevice::onFallButton4, this));
+}
+
+std::chrono::milliseconds PedalDevice::getCurrentRotationTime() {
+  // apply the changes requested since the last call, in order
+  // increasing the rotation speed means decreasing the rotation time
+  InputEvent event;
+  while (_events.get(event)) {
+    if (event.type == InputEvent::Type::PedalSpeedUp &&
+        _pedalRotationTime > bike_computer::kMinPedalRotationTime) {
+      _pedalRotationTime -= kDeltaPedalRotationTime;
+    } else if (event.type == InputEvent::Type::PedalSpeedDown &&
+               _pedalRotationTime < bike_computer::kMaxPedalRotationTime) {
+      _pedalRotationTime += kDeltaPedalRotationTime;
+    }
+    LOG_DBG("Pedal event latency: %" PRIu64 " usecs",
+            (zpp_lib::Time::getUpTime() - event.time).count());
+  }
+  return _pedalRotationTime;
+}
+
+uint32_t PedalDevice::getNbrOfLostEvents() const { return _events.getNbrOfOverflows(); }
+
+void PedalDevice::onFallButton3() {
+  // the rotation speed decreases when button3 is pressed alone
+  // (button2 + button3 is used for changing gear)
+  if (_button3Debouncer.accept() && _button2.read() != zpp_lib::kPolarityPressed) {
+    _events.post(InputEvent::Type::PedalSpeedDown);
+  }
+}
+
+void PedalDevice::onFallButton4() {
+  // the rotation speed increases when button4 is pressed alone
+  // (button2 + button4 is used for changing gear)
+  if (_button4Debouncer.accept() && _button2.read() != zpp_lib::kPolarityPressed) {
+    _events.post(InputEvent::Type::PedalSpeedUp);
+  }
+}
+
+}  // namespace static_scheduling_with_event
+
+}  // namespace bike_computer
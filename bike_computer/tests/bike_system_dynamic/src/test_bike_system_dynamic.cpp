@@ -0,0 +1,88 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_bike_system_dynamic.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for the BikeSystem class (rate monotonic scheduling)
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+// zephyr
+#include <zephyr/logging/log.h>
+#include <zephyr/ztest.h>
+
+// std
+#include <chrono>
+#include <cstdio>
+
+// zpp_lib
+#include "zpp_include/this_thread.hpp"
+#include "zpp_include/thread.hpp"
+
+// bike computer
+#include "dynamic_scheduling/bike_system.hpp"
+
+LOG_MODULE_REGISTER(bike_system, CONFIG_APP_LOG_LEVEL);
+
+// for ms or s literals
+using namespace std::literals;
+
+static constexpr std::chrono::milliseconds testDuration = 10s;
+
+// the task manager asserts the start and computation times of every task run
+// (CONFIG_TEST), the statistics are checked once all task threads exited
+ZTEST(bike_system_dynamic, test_bike_system_rate_monotonic) {
+  using bike_computer::TaskManager;
+  using bike_computer::dynamic_scheduling::BikeSystem;
+  // create the BikeSystem instance
+  static BikeSystem bikeSystem;
+
+  // run the bike system in a separate thread
+  zpp_lib::Thread thread(zpp_lib::PreemptableThreadPriority::PriorityNormal,
+                         "Test BS RM");
+  auto res = thread.start(std::bind(&BikeSystem::start, &bikeSystem));
+  zassert_true(res, "Could not start thread");
+
+  // let the bike system run for the test duration
+  zpp_lib::ThisThread::sleep_for(testDuration);
+
+  // stop the bike system and wait for all task threads to exit
+  bikeSystem.stop();
+  res = thread.join();
+  zassert_true(res, "Could not join thread");
+
+  // the task set is schedulable with rate monotonic: no deadline is missed
+  const TaskManager& taskManager = bikeSystem.getTaskManager();
+  zassert_equal(taskManager.getNbrOfModeSwitches(), 0, "Deadline missed");
+  for (uint8_t taskIndex = 0; taskIndex < TaskManager::kNbrOfTaskTypes; taskIndex++) {
+    const auto& statistics =
+        taskManager.getTaskStatistics(static_cast<TaskManager::TaskType>(taskIndex));
+    zassert_equal(statistics.getNbrOfDrops(), 0, "Task %d dropped", taskIndex);
+    // every release during the test duration was run (the last one may be
+    // interrupted by the stop)
+    const uint32_t nbrOfReleases = static_cast<uint32_t>(
+        testDuration / TaskManager::kTaskPeriods[taskIndex]);
+    zassert_true(statistics.getNbrOfRuns() + 1 >= nbrOfReleases,
+                 "Task %d ran %d times for %d releases",
+                 taskIndex,
+                 statistics.getNbrOfRuns(),
+                 nbrOfReleases);
+  }
+}
+
+ZTEST_SUITE(bike_system_dynamic, NULL, NULL, NULL, NULL, NULL);
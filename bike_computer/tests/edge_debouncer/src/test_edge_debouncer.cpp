@@ -0,0 +1,58 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_edge_debouncer.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for the EdgeDebouncer class
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+// zephyr
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/ztest.h>
+
+// std
+#include <chrono>
+
+// bike_computer
+#include "common/edge_debouncer.hpp"
+
+LOG_MODULE_REGISTER(test_edge_debouncer, CONFIG_APP_LOG_LEVEL);
+
+using bike_computer::EdgeDebouncer;
+
+// edges within the debounce time of the last accepted edge are bounces
+ZTEST(edge_debouncer, test_accept) {
+  EdgeDebouncer debouncer;
+
+  // the first edge is always accepted
+  zassert_true(debouncer.accept(), "First edge rejected");
+
+  // bounces inside the debounce window are rejected
+  zassert_false(debouncer.accept(), "Immediate bounce accepted");
+  k_busy_wait(EdgeDebouncer::kDebounceTime.count() / 4);
+  zassert_false(debouncer.accept(), "Bounce inside the debounce window accepted");
+
+  // a press after the debounce window is accepted and opens a new window
+  k_sleep(K_USEC(EdgeDebouncer::kDebounceTime.count()));
+  zassert_true(debouncer.accept(), "Edge after the debounce window rejected");
+  zassert_false(debouncer.accept(), "Bounce of the second press accepted");
+}
+
+ZTEST_SUITE(edge_debouncer, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,124 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_fixed_point_format.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for the fixed-point formatter
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+// zephyr
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/ztest.h>
+
+// std
+#include <cstdio>
+#include <cstring>
+
+// bike_computer
+#include "common/fixed_point_format.hpp"
+
+LOG_MODULE_REGISTER(test_fixed_point_format, CONFIG_APP_LOG_LEVEL);
+
+using bike_computer::fixed_point_format::format;
+using bike_computer::fixed_point_format::toFixedPoint;
+
+static void check_format(int32_t value,
+                         uint8_t nbrOfDecimals,
+                         uint8_t minWidth,
+                         const char* expected) {
+  char buffer[16]       = {0};
+  const uint8_t length = format(value, nbrOfDecimals, buffer, sizeof(buffer), minWidth);
+  zassert_equal(length, strlen(expected), "Wrong length for %d", value);
+  zassert_str_equal(buffer, expected, "Got \"%s\" expected \"%s\"", buffer, expected);
+}
+
+// check formatting of fixed-point values, including sign, padding and values
+// with fewer digits than decimals
+ZTEST(fixed_point_format, test_format) {
+  check_format(0, 0, 0, "0");
+  check_format(7, 0, 0, "7");
+  check_format(123, 1, 0, "12.3");
+  check_format(1234, 2, 0, "12.34");
+  check_format(5, 2, 0, "0.05");
+  check_format(-5, 2, 0, "-0.05");
+  check_format(-1234, 1, 0, "-123.4");
+  check_format(42, 1, 6, "   4.2");
+  check_format(INT32_MIN, 0, 0, "-2147483648");
+  check_format(-5, 10, 0, "-0.0000000005");
+}
+
+// the text must not overflow the buffer
+ZTEST(fixed_point_format, test_buffer_too_small) {
+  char buffer[5] = {'x', 'x', 'x', 'x', 'x'};
+  zassert_equal(format(12345, 2, buffer, sizeof(buffer)), 0, "Text should not fit");
+  zassert_equal(buffer[0], '\0', "Buffer should be empty");
+  zassert_equal(format(1234, 2, buffer, sizeof(buffer)), 0, "Text should not fit");
+  zassert_equal(format(123, 2, buffer, sizeof(buffer)), 4, "Text should fit");
+  zassert_str_equal(buffer, "1.23", "Wrong text");
+
+  // more decimals than digits of an int32_t are rejected
+  char largeBuffer[32] = {'x'};
+  zassert_equal(format(5, 12, largeBuffer, sizeof(largeBuffer)), 0, "Too many decimals");
+  zassert_equal(largeBuffer[0], '\0', "Buffer should be empty");
+}
+
+// check rounding of floating point values and compare with snprintf
+ZTEST(fixed_point_format, test_to_fixed_point) {
+  zassert_equal(toFixedPoint(12.345f, 1), 123, "Wrong rounding");
+  zassert_equal(toFixedPoint(12.35f, 1), 124, "Wrong rounding");
+  zassert_equal(toFixedPoint(-0.056f, 2), -6, "Wrong rounding");
+  zassert_equal(toFixedPoint(7.0f, 0), 7, "Wrong rounding");
+
+  static constexpr float kValues[] = {0.0f, 1.0f, 9.87f, 23.45f, 99.96f, 123.4f};
+  for (float value : kValues) {
+    char expected[16] = {0};
+    char buffer[16]   = {0};
+    snprintf(expected, sizeof(expected), "%.1f", static_cast<double>(value));
+    format(toFixedPoint(value, 1), 1, buffer, sizeof(buffer));
+    zassert_str_equal(buffer, expected, "Got \"%s\" expected \"%s\"", buffer, expected);
+  }
+}
+
+// measure the cost of the fixed-point formatter compared to snprintf
+// (cycle counts are only logged: they are not deterministic on emulated targets)
+ZTEST(fixed_point_format, test_benchmark) {
+  static constexpr uint32_t kNbrOfIterations = 1000;
+  char buffer[16]                            = {0};
+  volatile float value                       = 23.45f;
+
+  uint32_t startCycles = k_cycle_get_32();
+  for (uint32_t i = 0; i < kNbrOfIterations; i++) {
+    snprintf(buffer, sizeof(buffer), "%.1f", static_cast<double>(value));
+  }
+  const uint32_t snprintfCycles = k_cycle_get_32() - startCycles;
+
+  startCycles = k_cycle_get_32();
+  for (uint32_t i = 0; i < kNbrOfIterations; i++) {
+    format(toFixedPoint(value, 1), 1, buffer, sizeof(buffer));
+  }
+  const uint32_t formatCycles = k_cycle_get_32() - startCycles;
+
+  LOG_INF("snprintf: %u cycles, fixed-point format: %u cycles (%u iterations)",
+          snprintfCycles,
+          formatCycles,
+          kNbrOfIterations);
+}
+
+ZTEST_SUITE(fixed_point_format, NULL, NULL, NULL, NULL, NULL);
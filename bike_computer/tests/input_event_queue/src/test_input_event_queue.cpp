@@ -0,0 +1,104 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_input_event_queue.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for the InputEventQueue class
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+// zephyr
+#include <zephyr/logging/log.h>
+#include <zephyr/ztest.h>
+
+// std
+#include <chrono>
+
+// bike_computer
+#include "common/input_event_queue.hpp"
+
+LOG_MODULE_REGISTER(test_input_event_queue, CONFIG_APP_LOG_LEVEL);
+
+// for ms or s literals
+using namespace std::literals;
+
+static constexpr uint16_t kQueueSize = 8;
+using EventType                      = bike_computer::InputEvent::Type;
+static constexpr EventType kBurst[]  = {EventType::GearUp,
+                                        EventType::GearUp,
+                                        EventType::PedalSpeedUp,
+                                        EventType::Reset,
+                                        EventType::GearDown,
+                                        EventType::PedalSpeedDown};
+static constexpr uint16_t kBurstSize = sizeof(kBurst) / sizeof(kBurst[0]);
+
+// a burst of events is delivered without loss, in order, each with its own time
+ZTEST(input_event_queue, test_burst) {
+  bike_computer::InputEventQueue<kQueueSize> queue;
+  // time separating two events, larger than the up time resolution
+  static constexpr std::chrono::microseconds kEventInterval = 2ms;
+  for (uint16_t eventIndex = 0; eventIndex < kBurstSize; eventIndex++) {
+    zassert_true(queue.post(kBurst[eventIndex]), "Event %d not posted", eventIndex);
+    k_busy_wait(kEventInterval.count());
+  }
+  zassert_equal(queue.getSize(), kBurstSize);
+
+  bike_computer::InputEvent event;
+  std::chrono::microseconds previousTime = std::chrono::microseconds::zero();
+  for (uint16_t eventIndex = 0; eventIndex < kBurstSize; eventIndex++) {
+    zassert_true(queue.get(event), "Event %d missing", eventIndex);
+    zassert_true(event.type == kBurst[eventIndex], "Event %d out of order", eventIndex);
+    if (eventIndex > 0) {
+      zassert_true(event.time >= previousTime + kEventInterval,
+                   "Event %d does not have its own time",
+                   eventIndex);
+    }
+    previousTime = event.time;
+  }
+  zassert_false(queue.get(event), "Unexpected event");
+  zassert_true(queue.isEmpty());
+  zassert_equal(queue.getNbrOfOverflows(), 0);
+}
+
+// events posted to a full queue are dropped and counted, the queued ones are kept
+ZTEST(input_event_queue, test_overflow) {
+  bike_computer::InputEventQueue<kQueueSize> queue;
+  static constexpr uint16_t kNbrOfExtraEvents = 3;
+  for (uint16_t eventIndex = 0; eventIndex < kQueueSize; eventIndex++) {
+    zassert_true(queue.post(EventType::GearUp), "Event %d not posted", eventIndex);
+  }
+  for (uint16_t eventIndex = 0; eventIndex < kNbrOfExtraEvents; eventIndex++) {
+    zassert_false(queue.post(EventType::Reset), "Event posted to a full queue");
+  }
+  zassert_equal(queue.getNbrOfOverflows(), kNbrOfExtraEvents);
+  zassert_equal(queue.getSize(), kQueueSize);
+
+  bike_computer::InputEvent event;
+  for (uint16_t eventIndex = 0; eventIndex < kQueueSize; eventIndex++) {
+    zassert_true(queue.get(event), "Event %d missing", eventIndex);
+    zassert_true(event.type == EventType::GearUp, "Dropped event was queued");
+  }
+  zassert_true(queue.isEmpty());
+
+  // the queue accepts events again once drained
+  zassert_true(queue.post(EventType::Reset));
+  zassert_equal(queue.getSize(), 1);
+  zassert_equal(queue.getNbrOfOverflows(), kNbrOfExtraEvents);
+}
+
+ZTEST_SUITE(input_event_queue, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,80 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_schedulability_analyzer.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for the schedulability analyzer
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+// zephyr
+#include <zephyr/logging/log.h>
+#include <zephyr/ztest.h>
+
+// std
+#include <chrono>
+
+// bike_computer
+#include "common/schedulability_report.hpp"
+
+LOG_MODULE_REGISTER(test_schedulability_analyzer, CONFIG_APP_LOG_LEVEL);
+
+// for ms or s literals
+using namespace std::literals;
+
+// the bike task set has harmonic periods and a utilization of 1: the utilization
+// based tests are inconclusive but both the response time analysis and EDF pass
+ZTEST(schedulability_analyzer, test_bike_task_set) {
+  const auto& analysis = bike_computer::kBikeTaskSetAnalysis;
+  zassert_within(analysis.utilization, 1.0, 1e-6, "Wrong utilization");
+  zassert_within(analysis.liuLaylandBound, 0.7348, 1e-4, "Wrong Liu&Layland bound");
+  zassert_false(analysis.isLiuLaylandSchedulable, "Liu&Layland test should fail");
+  zassert_false(analysis.isHyperbolicSchedulable, "Hyperbolic test should fail");
+  zassert_true(analysis.isFixedPrioritySchedulable, "Task set not RM schedulable");
+  zassert_true(analysis.isEDFSchedulable, "Task set not EDF schedulable");
+  zassert_equal(analysis.getEDFIdleTime().count(), 0, "Wrong EDF idle time");
+
+  static constexpr std::chrono::microseconds kExpectedResponseTimes[] = {
+      300ms, 200ms, 700ms, 400ms, 1500ms, 1600ms};
+  static constexpr uint8_t kExpectedPriorities[] = {1, 0, 3, 2, 4, 5};
+  for (uint8_t taskIndex = 0; taskIndex < analysis.kNbrOfTasks; taskIndex++) {
+    zassert_equal(analysis.responseTimes[taskIndex].count(),
+                  kExpectedResponseTimes[taskIndex].count(),
+                  "Wrong response time for task %d",
+                  taskIndex);
+    zassert_equal(analysis.priorities[taskIndex],
+                  kExpectedPriorities[taskIndex],
+                  "Wrong priority for task %d",
+                  taskIndex);
+  }
+}
+
+// a task set that can be scheduled with EDF but not with rate monotonic
+ZTEST(schedulability_analyzer, test_edf_only_task_set) {
+  static constexpr std::chrono::microseconds kPeriods[]          = {5ms, 7ms};
+  static constexpr std::chrono::microseconds kComputationTimes[] = {2ms, 4ms};
+  static constexpr auto analysis =
+      bike_computer::analyzeTaskSet(kPeriods, kComputationTimes);
+  zassert_true(analysis.isEDFSchedulable, "Task set should be EDF schedulable");
+  zassert_false(analysis.isFixedPrioritySchedulable,
+                "Task set should not be RM schedulable");
+  zassert_true(analysis.responseTimes[1] > kPeriods[1], "Deadline miss not detected");
+  zassert_equal(analysis.getEDFIdleTime().count(), 1000, "Wrong EDF idle time");
+}
+
+ZTEST_SUITE(schedulability_analyzer, NULL, NULL, NULL, NULL, NULL);
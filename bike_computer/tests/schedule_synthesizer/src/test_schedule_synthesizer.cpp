@@ -0,0 +1,88 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_schedule_synthesizer.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for the cyclic schedule synthesizer
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+// zephyr
+#include <zephyr/logging/log.h>
+#include <zephyr/ztest.h>
+
+// std
+#include <chrono>
+
+// bike_computer
+#include "common/bike_schedule.hpp"
+
+LOG_MODULE_REGISTER(test_schedule_synthesizer, CONFIG_APP_LOG_LEVEL);
+
+// for ms or s literals
+using namespace std::literals;
+
+using bike_computer::TaskManager;
+
+// check that each task runs the expected number of times in the hyperperiod and
+// that each job runs in a frame within its period
+ZTEST(schedule_synthesizer, test_bike_schedule) {
+  const auto& schedule = bike_computer::kBikeSchedule;
+  zassert_true(schedule.isFeasible, "Bike schedule is not feasible");
+  zassert_equal(schedule.hyperperiod.count(), 1600000, "Invalid hyperperiod");
+  zassert_equal(schedule.hyperperiod.count(),
+                schedule.minorCycle.count() * schedule.nbrOfFrames,
+                "Frames do not cover the hyperperiod");
+
+  uint32_t nbrOfJobs[TaskManager::kNbrOfTaskTypes] = {0};
+  for (uint16_t frameIndex = 0; frameIndex < schedule.nbrOfFrames; frameIndex++) {
+    const auto frameStartTime           = schedule.minorCycle * frameIndex;
+    std::chrono::microseconds frameLoad = 0us;
+    for (uint16_t jobIndex = 0; jobIndex < schedule.frameSizes[frameIndex]; jobIndex++) {
+      const uint8_t taskIndex = schedule.frames[frameIndex][jobIndex];
+      const auto period       = TaskManager::kTaskPeriods[taskIndex];
+      // the job of the task run in this frame is the one released last
+      const auto release = (frameStartTime / period) * period;
+      zassert_true(frameStartTime + schedule.minorCycle <= release + period,
+                   "Task %d misses its deadline in frame %d",
+                   taskIndex,
+                   frameIndex);
+      frameLoad += TaskManager::kTaskComputationTimes[taskIndex];
+      nbrOfJobs[taskIndex]++;
+    }
+    zassert_true(frameLoad <= schedule.minorCycle, "Frame %d overloaded", frameIndex);
+  }
+
+  for (uint8_t taskIndex = 0; taskIndex < TaskManager::kNbrOfTaskTypes; taskIndex++) {
+    zassert_equal(nbrOfJobs[taskIndex],
+                  schedule.hyperperiod / TaskManager::kTaskPeriods[taskIndex],
+                  "Wrong number of jobs for task %d",
+                  taskIndex);
+  }
+}
+
+// an overloaded task set must be reported as infeasible
+ZTEST(schedule_synthesizer, test_infeasible_task_set) {
+  static constexpr std::chrono::microseconds kPeriods[]          = {400ms, 800ms};
+  static constexpr std::chrono::microseconds kComputationTimes[] = {300ms, 300ms};
+  static constexpr auto schedule =
+      bike_computer::synthesizeSchedule<16, 4>(kPeriods, kComputationTimes);
+  zassert_false(schedule.isFeasible, "Overloaded task set reported as feasible");
+}
+
+ZTEST_SUITE(schedule_synthesizer, NULL, NULL, NULL, NULL, NULL);
@@ -26,9 +26,14 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/ztest.h>
 
+// std
+#include <chrono>
+
 // bike_computer
 #include "common/sensor_device.hpp"
 
+using namespace std::literals;
+
 LOG_MODULE_REGISTER(test_sensor_device, CONFIG_APP_LOG_LEVEL);
 
 ZTEST(sensor_device, test_sensor_device) {
@@ -67,4 +72,74 @@ ZTEST(sensor_device, test_sensor_device) {
                  static_cast<double>(humidity));
 }
 
+// both measurements must be served from a single sample fetch
+ZTEST(sensor_device, test_cached_sample) {
+  bike_computer::SensorDevice sensorDevice;
+
+  auto res = sensorDevice.initialize();
+  zassert_true(res, "Cannot initialize sensor device: %d", res.error());
+
+  // no sample is available before the first request completes
+  bike_computer::SensorSample sample;
+  res = sensorDevice.getSample(sample, bike_computer::SensorDevice::kMaxSampleAge);
+  zassert_false(res, "Sample available before any request");
+
+  float temperature = 0.0f;
+  res               = sensorDevice.readTemperature(temperature);
+  zassert_true(res, "Cannot read temperature: %d", res.error());
+  res = sensorDevice.readTemperature(temperature);
+  zassert_true(res, "Cannot read temperature: %d", res.error());
+  zassert_equal(sensorDevice.getNbrOfFetches(), 1, "Sample fetched more than once");
+
+  // an asynchronous request completes without the caller waiting for it
+  res = sensorDevice.requestSample();
+  zassert_true(res, "Cannot request sample: %d", res.error());
+  k_sleep(K_MSEC(100));
+  zassert_equal(sensorDevice.getNbrOfFetches(), 2, "Sample not fetched");
+  res = sensorDevice.getSample(sample, bike_computer::SensorDevice::kMaxSampleAge);
+  zassert_true(res, "Cannot get sample: %d", res.error());
+  zassert_within(sample.temperature, temperature, 5.0f, "Inconsistent temperature");
+}
+
+// samples are fetched periodically and filtered at the consumer rate
+ZTEST(sensor_device, test_streaming) {
+  bike_computer::SensorDevice sensorDevice;
+
+  auto res = sensorDevice.initialize();
+  zassert_true(res, "Cannot initialize sensor device: %d", res.error());
+
+  // no filtered sample is available before streaming
+  bike_computer::SensorSample sample;
+  res = sensorDevice.readFilteredSample(sample);
+  zassert_false(res, "Filtered sample available before streaming");
+
+  static constexpr std::chrono::milliseconds kSamplingPeriod = 20ms;
+  static constexpr uint8_t kDecimationFactor                 = 4;
+  res = sensorDevice.startStreaming(kSamplingPeriod, kDecimationFactor);
+  zassert_true(res, "Cannot start streaming: %d", res.error());
+  // a second start is rejected while streaming
+  res = sensorDevice.startStreaming(kSamplingPeriod, kDecimationFactor);
+  zassert_false(res, "Streaming started twice");
+
+  // fewer samples than the ring size are produced: none may be dropped
+  k_sleep(K_MSEC(3 * kDecimationFactor * kSamplingPeriod.count()));
+  res = sensorDevice.readFilteredSample(sample);
+  zassert_true(res, "Cannot read filtered sample: %d", res.error());
+  zassert_equal(sensorDevice.getNbrOfDroppedSamples(), 0, "Samples dropped");
+  static constexpr float kTemperatureRange = 20.0f;
+  static constexpr float kMeanTemperature  = 15.0f;
+  zassert_within(sample.temperature,
+                 kMeanTemperature,
+                 kTemperatureRange,
+                 "Filtered temperature outside range: %f",
+                 static_cast<double>(sample.temperature));
+
+  // no sample is fetched once streaming is stopped
+  sensorDevice.stopStreaming();
+  k_sleep(K_MSEC(2 * kSamplingPeriod.count()));
+  const uint32_t nbrOfFetches = sensorDevice.getNbrOfFetches();
+  k_sleep(K_MSEC(4 * kSamplingPeriod.count()));
+  zassert_equal(sensorDevice.getNbrOfFetches(), nbrOfFetches, "Streaming not stopped");
+}
+
 ZTEST_SUITE(sensor_device, NULL, NULL, NULL, NULL, NULL);
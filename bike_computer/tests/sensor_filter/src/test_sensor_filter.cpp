@@ -0,0 +1,76 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_sensor_filter.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for the sensor measurement filters
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+// zephyr
+#include <zephyr/logging/log.h>
+#include <zephyr/ztest.h>
+
+// bike_computer
+#include "common/sensor_filter.hpp"
+
+LOG_MODULE_REGISTER(test_sensor_filter, CONFIG_APP_LOG_LEVEL);
+
+static constexpr float kAllowedDelta = 0.001f;
+
+// isolated outliers must be removed by the median filter
+ZTEST(sensor_filter, test_median_filter) {
+  bike_computer::MedianFilter<3> filter;
+  zassert_within(filter.update(20.0f), 20.0f, kAllowedDelta);
+  // mean of the two middle values while warming up
+  zassert_within(filter.update(21.0f), 20.5f, kAllowedDelta);
+  zassert_within(filter.update(80.0f), 21.0f, kAllowedDelta, "Outlier not removed");
+  zassert_within(filter.update(22.0f), 22.0f, kAllowedDelta);
+  zassert_within(filter.update(-40.0f), 22.0f, kAllowedDelta, "Outlier not removed");
+
+  // an outlier in the second value must not be passed through
+  filter.reset();
+  zassert_within(filter.update(1.0f), 1.0f, kAllowedDelta);
+  zassert_true(filter.update(100.0f) < 100.0f, "Outlier passed while warming up");
+}
+
+// the IIR filter starts from the first value and converges to a constant input
+ZTEST(sensor_filter, test_iir_filter) {
+  bike_computer::IirFilter filter(0.5f);
+  zassert_within(filter.update(10.0f), 10.0f, kAllowedDelta);
+  zassert_within(filter.update(20.0f), 15.0f, kAllowedDelta);
+  zassert_within(filter.update(20.0f), 17.5f, kAllowedDelta);
+  for (uint8_t i = 0; i < 20; i++) {
+    filter.update(20.0f);
+  }
+  zassert_within(filter.update(20.0f), 20.0f, kAllowedDelta, "Filter did not converge");
+
+  filter.reset();
+  zassert_within(filter.update(5.0f), 5.0f, kAllowedDelta, "Filter not reset");
+}
+
+// an outlier must not disturb the output of the combined filter
+ZTEST(sensor_filter, test_channel_filter) {
+  bike_computer::ChannelFilter<3> filter(0.25f);
+  static constexpr float kValues[] = {15.0f, 15.0f, 15.0f, 100.0f, 15.0f, 15.0f};
+  for (float value : kValues) {
+    zassert_within(filter.update(value), 15.0f, kAllowedDelta, "Outlier not filtered");
+  }
+}
+
+ZTEST_SUITE(sensor_filter, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,128 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_speed_history.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for the SpeedHistory class
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+// zephyr
+#include <zephyr/logging/log.h>
+#include <zephyr/ztest.h>
+
+// std
+#include <algorithm>
+#include <chrono>
+
+// bike_computer
+#include "common/speed_history.hpp"
+
+LOG_MODULE_REGISTER(test_speed_history, CONFIG_APP_LOG_LEVEL);
+
+using namespace std::literals;
+
+static constexpr uint16_t kHistorySize = 8;
+using TestSpeedHistory                 = bike_computer::SpeedHistory<kHistorySize>;
+
+// deterministic samples with varying speeds and pedal rotation times
+// (the maximal speed is reached early, so that it leaves the ring)
+static bike_computer::SpeedSample makeSample(uint32_t sampleIndex) {
+  bike_computer::SpeedSample sample;
+  sample.time     = std::chrono::microseconds(sampleIndex * 100000);
+  sample.speed    = (sampleIndex == 3) ? 60000 : 20000 + (sampleIndex * 7919) % 10000;
+  sample.distance = static_cast<uint64_t>(sampleIndex) * 555000;
+  // some samples have no pedal rotation (no cadence)
+  sample.pedalRotationTime =
+      (sampleIndex % 5 == 0) ? 0ms : std::chrono::milliseconds(700 + sampleIndex * 13);
+  return sample;
+}
+
+// statistics computed from all samples added so far (the last kHistorySize for
+// the averages)
+static bike_computer::SpeedStatistics computeExpectedStatistics(uint32_t nbrOfSamples) {
+  bike_computer::SpeedStatistics statistics;
+  const uint32_t firstIndex =
+      nbrOfSamples > kHistorySize ? nbrOfSamples - kHistorySize : 0;
+  statistics.nbrOfSamples = static_cast<uint16_t>(nbrOfSamples - firstIndex);
+  uint64_t speedSum       = 0;
+  uint64_t cadenceSum     = 0;
+  for (uint32_t sampleIndex = 0; sampleIndex < nbrOfSamples; sampleIndex++) {
+    const auto sample   = makeSample(sampleIndex);
+    statistics.maxSpeed = std::max(statistics.maxSpeed, sample.speed);
+    if (sampleIndex < firstIndex) {
+      continue;
+    }
+    speedSum += sample.speed;
+    const uint64_t pedalRotationTime = sample.pedalRotationTime.count();
+    cadenceSum += pedalRotationTime == 0 ? 0 : 60000000 / pedalRotationTime;
+  }
+  const auto lastSample   = makeSample(nbrOfSamples - 1);
+  statistics.speed        = lastSample.speed;
+  statistics.averageSpeed = static_cast<uint32_t>(speedSum / statistics.nbrOfSamples);
+  statistics.distance     = static_cast<uint32_t>(lastSample.distance / 1000000);
+  statistics.cadence =
+      static_cast<uint32_t>((cadenceSum / statistics.nbrOfSamples + 500) / 1000);
+  return statistics;
+}
+
+// the running sums must match a brute-force computation, also once the oldest
+// samples are overwritten
+ZTEST(speed_history, test_overfill) {
+  static TestSpeedHistory speedHistory;
+  zassert_equal(speedHistory.computeStatistics().nbrOfSamples, 0);
+
+  static constexpr uint32_t kNbrOfSamples = 5 * kHistorySize + 3;
+  for (uint32_t sampleIndex = 0; sampleIndex < kNbrOfSamples; sampleIndex++) {
+    speedHistory.addSample(makeSample(sampleIndex));
+
+    const auto statistics = speedHistory.computeStatistics();
+    const auto expected   = computeExpectedStatistics(sampleIndex + 1);
+    zassert_equal(statistics.nbrOfSamples, expected.nbrOfSamples);
+    zassert_equal(statistics.speed, expected.speed, "Wrong speed (%d)", sampleIndex);
+    zassert_equal(statistics.averageSpeed,
+                  expected.averageSpeed,
+                  "Wrong average speed %d instead of %d (%d)",
+                  statistics.averageSpeed,
+                  expected.averageSpeed,
+                  sampleIndex);
+    zassert_equal(statistics.maxSpeed, expected.maxSpeed, "Wrong max (%d)", sampleIndex);
+    zassert_equal(statistics.distance, expected.distance);
+    zassert_equal(statistics.cadence,
+                  expected.cadence,
+                  "Wrong cadence %d instead of %d (%d)",
+                  statistics.cadence,
+                  expected.cadence,
+                  sampleIndex);
+  }
+
+  // samples are indexed from the oldest to the most recent one
+  zassert_equal(speedHistory.getNbrOfSamples(), kHistorySize);
+  for (uint16_t index = 0; index < kHistorySize; index++) {
+    const auto expected = makeSample(kNbrOfSamples - kHistorySize + index);
+    zassert_equal(speedHistory.getSample(index).time.count(), expected.time.count());
+  }
+
+  // clearing also resets the max speed
+  speedHistory.clear();
+  zassert_equal(speedHistory.computeStatistics().nbrOfSamples, 0);
+  speedHistory.addSample(makeSample(0));
+  zassert_equal(speedHistory.computeStatistics().maxSpeed, makeSample(0).speed);
+}
+
+ZTEST_SUITE(speed_history, NULL, NULL, NULL, NULL, NULL);
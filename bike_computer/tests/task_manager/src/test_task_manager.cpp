@@ -0,0 +1,169 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_task_manager.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for the TaskManager class
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+// zephyr
+#include <zephyr/logging/log.h>
+#include <zephyr/ztest.h>
+
+// std
+#include <chrono>
+#include <initializer_list>
+
+// zpp_lib
+#include "zpp_include/thread.hpp"
+
+// bike_computer
+#include "common/absolute_time.hpp"
+#include "common/task_manager.hpp"
+
+LOG_MODULE_REGISTER(test_task_manager, CONFIG_APP_LOG_LEVEL);
+
+// for ms or s literals
+using namespace std::literals;
+
+using bike_computer::Criticality;
+using bike_computer::TaskManager;
+
+static void runTask(TaskManager& taskManager, TaskManager::TaskType taskType) {
+  taskManager.registerTaskStart(taskType);
+  taskManager.simulateComputationTime(taskType);
+}
+
+// a Hi task missing its deadline switches to Hi mode, in which every other
+// release of the Lo tasks is shed, and the Lo mode is restored after
+// consecutive Hi jobs completed within their budget
+ZTEST(task_manager, test_mode_switch) {
+  static TaskManager taskManager;
+  using TaskType             = TaskManager::TaskType;
+  static constexpr auto kGap = 50ms;
+
+  taskManager.initializePhase();
+  zassert_true(taskManager.getMode() == Criticality::Lo, "Wrong initial mode");
+
+  // first release of a Lo task in Lo mode
+  runTask(taskManager, TaskType::DisplayTask2Type);
+  zassert_equal(taskManager.getTaskStatistics(TaskType::DisplayTask2Type).getNbrOfRuns(),
+                1);
+
+  // the gear task starts too late for completing before its deadline
+  const auto gearPeriod = TaskManager::kTaskPeriods[(uint8_t)TaskType::GearTaskType];
+  bike_computer::sleepUntil(taskManager.getPhase() + gearPeriod - kGap);
+  runTask(taskManager, TaskType::GearTaskType);
+  zassert_equal(taskManager.getTaskStatistics(TaskType::GearTaskType).getNbrOfDrops(), 1);
+  zassert_true(taskManager.getMode() == Criticality::Hi, "Hi mode not entered");
+  zassert_equal(taskManager.getNbrOfModeSwitches(), 1);
+
+  // the second release of the Lo task is shed and takes no computation time
+  const auto displayPeriod =
+      TaskManager::kTaskPeriods[(uint8_t)TaskType::DisplayTask2Type];
+  bike_computer::sleepUntil(taskManager.getPhase() + displayPeriod);
+  taskManager.registerTaskStart(TaskType::DisplayTask2Type);
+  zassert_true(taskManager.isTaskShed(TaskType::DisplayTask2Type), "Lo task not shed");
+  const auto shedStartTime = zpp_lib::Time::getUpTime();
+  taskManager.simulateComputationTime(TaskType::DisplayTask2Type);
+  zassert_true(zpp_lib::Time::getUpTime() - shedStartTime < kGap,
+               "Shed task computed");
+  zassert_equal(taskManager.getTaskStatistics(TaskType::DisplayTask2Type).getNbrOfSheds(),
+                1);
+  // Hi tasks are never shed
+  taskManager.initializePhase();
+  taskManager.registerTaskStart(TaskType::GearTaskType);
+  zassert_false(taskManager.isTaskShed(TaskType::GearTaskType), "Hi task shed");
+  taskManager.simulateComputationTime(TaskType::GearTaskType);
+  zassert_true(taskManager.getMode() == Criticality::Hi, "Lo mode restored too early");
+
+  // Hi jobs completed within their budget restore the Lo mode (the first one ran
+  // just above)
+  runTask(taskManager, TaskType::ResetTaskType);
+  bike_computer::sleepUntil(taskManager.getPhase() + gearPeriod);
+  runTask(taskManager, TaskType::GearTaskType);
+  zassert_true(taskManager.getMode() == Criticality::Hi, "Lo mode restored too early");
+  runTask(taskManager, TaskType::ResetTaskType);
+  zassert_true(taskManager.getMode() == Criticality::Lo, "Lo mode not restored");
+  zassert_equal(taskManager.getNbrOfModeSwitches(), 2);
+
+  // no release is shed in Lo mode
+  taskManager.registerTaskStart(TaskType::DisplayTask2Type);
+  zassert_false(taskManager.isTaskShed(TaskType::DisplayTask2Type), "Lo task shed");
+  taskManager.simulateComputationTime(TaskType::DisplayTask2Type);
+}
+
+// low priority activity that can only run when the tasks release the CPU
+static atomic_t gBackgroundStopFlag   = ATOMIC_INIT(0x00);
+static atomic_t gNbrOfBackgroundLoops = ATOMIC_INIT(0);
+
+static void runBackground() {
+  while (!atomic_test_bit(&gBackgroundStopFlag, 0)) {
+    atomic_inc(&gNbrOfBackgroundLoops);
+    k_busy_wait(100);
+  }
+}
+
+// in SleepMode, the tasks release the CPU during their computation time while the
+// deadline checks of TaskManager (CONFIG_TEST) still hold
+ZTEST(task_manager, test_sleep_mode) {
+  static TaskManager taskManager;
+  using TaskType = TaskManager::TaskType;
+  taskManager.setSimulationMode(TaskManager::SimulationMode::SleepMode,
+                                TaskManager::kSleepModeBusyPercentage);
+
+  zpp_lib::Thread background(zpp_lib::PreemptableThreadPriority::PriorityLow,
+                             "Background");
+  auto res = background.start(runBackground);
+  zassert_true(res, "Could not start thread");
+
+  // run the gear and speed tasks at each of their releases for two gear periods
+  const auto speedPeriod = TaskManager::kTaskPeriods[(uint8_t)TaskType::SpeedTaskType];
+  static constexpr uint32_t kNbrOfSpeedCalls = 4;
+  taskManager.initializePhase();
+  for (uint32_t callIndex = 0; callIndex < kNbrOfSpeedCalls; callIndex++) {
+    bike_computer::sleepUntil(taskManager.getPhase() + speedPeriod * callIndex);
+    if (callIndex % 2 == 0) {
+      runTask(taskManager, TaskType::GearTaskType);
+    }
+    const auto nbrOfBackgroundLoops = atomic_get(&gNbrOfBackgroundLoops);
+    runTask(taskManager, TaskType::SpeedTaskType);
+    zassert_true(atomic_get(&gNbrOfBackgroundLoops) > nbrOfBackgroundLoops,
+                 "The speed task did not release the CPU");
+  }
+
+  atomic_set_bit(&gBackgroundStopFlag, 0);
+  res = background.join();
+  zassert_true(res, "Could not join thread");
+
+  // the tasks ran within their budget and none was dropped
+  static constexpr std::chrono::microseconds kAllowedDelta = 1ms;
+  for (const auto taskType : {TaskType::GearTaskType, TaskType::SpeedTaskType}) {
+    const auto& statistics = taskManager.getTaskStatistics(taskType);
+    const auto budget      = TaskManager::kTaskComputationTimes[(uint8_t)taskType];
+    zassert_equal(statistics.getNbrOfDrops(), 0);
+    zassert_true(statistics.getWCET() <= budget + kAllowedDelta,
+                 "Task %d ran longer than its budget",
+                 (int)taskType);
+  }
+  zassert_equal(taskManager.getTaskStatistics(TaskType::SpeedTaskType).getNbrOfRuns(),
+                kNbrOfSpeedCalls);
+}
+
+ZTEST_SUITE(task_manager, NULL, NULL, NULL, NULL, NULL);
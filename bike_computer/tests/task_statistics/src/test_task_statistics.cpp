@@ -0,0 +1,85 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_task_statistics.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for the TaskStatistics class
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+// zephyr
+#include <zephyr/logging/log.h>
+#include <zephyr/ztest.h>
+
+// std
+#include <chrono>
+
+// bike_computer
+#include "common/task_statistics.hpp"
+
+LOG_MODULE_REGISTER(test_task_statistics, CONFIG_APP_LOG_LEVEL);
+
+// for ms or s literals
+using namespace std::literals;
+
+// test the histogram buckets and percentiles
+ZTEST(task_statistics, test_histogram) {
+  bike_computer::Log2Histogram histogram;
+  zassert_equal(histogram.getPercentile(99).count(), 0, "Empty histogram percentile");
+
+  // 90 samples of 100 us and 10 samples of 100 ms
+  for (uint8_t index = 0; index < 90; index++) {
+    histogram.add(100us);
+  }
+  for (uint8_t index = 0; index < 10; index++) {
+    histogram.add(100ms);
+  }
+  zassert_equal(histogram.getCount(), 100, "Wrong number of samples");
+
+  // 100 us is in bucket [64, 127], 100 ms in bucket [65536, 131071]
+  zassert_equal(histogram.getBucketCount(7), 90, "Wrong bucket count");
+  zassert_equal(histogram.getBucketCount(17), 10, "Wrong bucket count");
+  zassert_equal(histogram.getPercentile(50).count(), 127, "Wrong median");
+  zassert_equal(histogram.getPercentile(90).count(), 127, "Wrong 90th percentile");
+  zassert_equal(histogram.getPercentile(99).count(), 131071, "Wrong 99th percentile");
+  zassert_true(histogram.getPercentile(99) >= 100ms, "Percentile is not an upper bound");
+}
+
+// test the execution time statistics
+ZTEST(task_statistics, test_task_statistics) {
+  bike_computer::TaskStatistics stats;
+  stats.recordRun(0us, 100ms);
+  stats.recordRun(2ms, 98ms);
+  stats.recordRun(1ms, 102ms);
+  stats.recordDrop();
+  stats.recordShed();
+
+  zassert_equal(stats.getNbrOfRuns(), 3, "Wrong number of runs");
+  zassert_equal(stats.getNbrOfDrops(), 1, "Wrong number of drops");
+  zassert_equal(stats.getNbrOfSheds(), 1, "Wrong number of sheds");
+  zassert_true(stats.getWCET() == 102ms, "Wrong WCET");
+  zassert_true(stats.getBCET() == 98ms, "Wrong BCET");
+  zassert_true(stats.getMeanExecutionTime() == 100ms, "Wrong mean execution time");
+  zassert_true(stats.getResponseTimeHistogram().getPercentile(100) >= 103ms,
+               "Wrong response time");
+
+  stats.reset();
+  zassert_equal(stats.getNbrOfRuns(), 0, "Statistics not reset");
+}
+
+ZTEST_SUITE(task_statistics, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,252 @@
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_ttce.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Test program for the TTCE polling server
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+// zephyr
+#include <zephyr/logging/log.h>
+#include <zephyr/ztest.h>
+
+// std
+#include <chrono>
+#include <functional>
+
+// zpp_lib
+#include "zpp_include/this_thread.hpp"
+#include "zpp_include/thread.hpp"
+
+// bike_computer
+#include "common/member_task.hpp"
+#include "common/ttce.hpp"
+
+LOG_MODULE_REGISTER(test_ttce, CONFIG_APP_LOG_LEVEL);
+
+// for ms or s literals
+using namespace std::literals;
+
+static constexpr std::chrono::milliseconds kMinorCycle       = 50ms;
+static constexpr std::chrono::microseconds kTaskTime         = 20ms;
+static constexpr std::chrono::microseconds kServerBudget     = 20ms;
+static constexpr std::chrono::microseconds kAperiodicJobTime = 5ms;
+static constexpr uint32_t kNbrOfAperiodicJobs                = 5;
+
+using TestTTCE = bike_computer::TTCE<std::function<void()>, 4, 1>;
+static TestTTCE gTTCE(kMinorCycle);
+static atomic_t gNbrOfAperiodicJobs = ATOMIC_INIT(0);
+
+// lightly loaded executive, each frame completes well before the next tick
+static TestTTCE gLightTTCE(kMinorCycle);
+
+ZTEST(ttce, test_tick_accounting) {
+  static constexpr std::chrono::microseconds kLightTaskTime = 5ms;
+  for (uint16_t minorCycleIndex = 0; minorCycleIndex < 4; minorCycleIndex++) {
+    auto res = gLightTTCE.addTask(minorCycleIndex,
+                                  []() { k_busy_wait(kLightTaskTime.count()); });
+    zassert_true(res, "Cannot add task: %d", res.error());
+  }
+
+  zpp_lib::Thread thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, "TTCE");
+  auto res = thread.start(std::bind(&TestTTCE::start, &gLightTTCE));
+  zassert_true(res, "Could not start thread");
+  zpp_lib::ThisThread::sleep_for(20 * kMinorCycle - kMinorCycle / 2);
+  gLightTTCE.stop();
+  res = thread.join();
+  zassert_true(res, "Could not join thread");
+
+  // every tick releases a frame and the slack is measured from the tick
+  const auto stats = gLightTTCE.getStats();
+  zassert_true(stats.nbrOfTicks >= 19, "Too few ticks: %d", stats.nbrOfTicks);
+  zassert_equal(stats.nbrOfCoalescedTicks, 0, "Ticks wrongly counted as coalesced");
+  zassert_equal(stats.nbrOfOverrunTicks, 0, "Ticks wrongly counted as overruns");
+  zassert_equal(stats.nbrOfOverruns, 0);
+  uint32_t nbrOfFrames = 0;
+  for (uint16_t minorCycleIndex = 0; minorCycleIndex < 4; minorCycleIndex++) {
+    const auto& mcs = stats.minorCycles[minorCycleIndex];
+    nbrOfFrames += mcs.nbrOfFrames;
+    zassert_true(mcs.maxSlack <= kMinorCycle - kLightTaskTime,
+                 "Slack larger than the frame budget: %lld us",
+                 mcs.maxSlack.count());
+  }
+  zassert_equal(nbrOfFrames, stats.nbrOfTicks);
+
+  // one record per frame, in execution order
+  zassert_equal(gLightTTCE.getNbrOfLostFrameRecords(), 0);
+  TestTTCE::FrameRecord record;
+  uint32_t nbrOfRecords = 0;
+  while (gLightTTCE.getFrameRecord(record)) {
+    zassert_equal(record.frameNumber, nbrOfRecords);
+    zassert_equal(record.minorCycleIndex, nbrOfRecords % 4);
+    zassert_true(record.endTime - record.startTime >= kLightTaskTime.count());
+    zassert_true(record.slack >= 0, "Frame %d overran", record.frameNumber);
+    nbrOfRecords++;
+  }
+  zassert_equal(nbrOfRecords, nbrOfFrames);
+}
+
+ZTEST(ttce, test_polling_server) {
+  // one periodic task per frame, leaving slack for the server
+  for (uint16_t minorCycleIndex = 0; minorCycleIndex < 4; minorCycleIndex++) {
+    auto res = gTTCE.addTask(minorCycleIndex, []() { k_busy_wait(kTaskTime.count()); });
+    zassert_true(res, "Cannot add task: %d", res.error());
+  }
+  auto res = gTTCE.setServerBudget(kServerBudget);
+  zassert_true(res, "Cannot set server budget: %d", res.error());
+
+  // jobs longer than the server budget are rejected
+  res = gTTCE.submitAperiodicJob([]() {}, kServerBudget + 1ms);
+  zassert_false(res, "Job exceeding the server budget should be rejected");
+
+  zpp_lib::Thread thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, "TTCE");
+  res = thread.start(std::bind(&TestTTCE::start, &gTTCE));
+  zassert_true(res, "Could not start thread");
+
+  for (uint32_t jobIndex = 0; jobIndex < kNbrOfAperiodicJobs; jobIndex++) {
+    zpp_lib::ThisThread::sleep_for(3 * kMinorCycle);
+    res = gTTCE.submitAperiodicJob(
+        []() {
+          k_busy_wait(kAperiodicJobTime.count());
+          atomic_inc(&gNbrOfAperiodicJobs);
+        },
+        kAperiodicJobTime);
+    zassert_true(res, "Cannot submit aperiodic job: %d", res.error());
+  }
+  zpp_lib::ThisThread::sleep_for(3 * kMinorCycle);
+
+  gTTCE.stop();
+
+  // each job is run in the slack of the first frame that follows its submission
+  const auto stats = gTTCE.getStats();
+  zassert_equal(atomic_get(&gNbrOfAperiodicJobs), kNbrOfAperiodicJobs);
+  zassert_equal(stats.nbrOfAperiodicJobs, kNbrOfAperiodicJobs);
+  zassert_true(stats.maxAperiodicResponseTime <= 2 * kMinorCycle,
+               "Aperiodic response time too long: %lld us",
+               stats.maxAperiodicResponseTime.count());
+  zassert_equal(stats.nbrOfOverruns, 0);
+  zassert_equal(gTTCE.getNbrOfLostAperiodicJobs(), 0);
+
+  res = thread.join();
+  zassert_true(res, "Could not join thread");
+}
+
+// tasks run through MemberTask entries
+class Counters {
+ public:
+  void countTask0() { atomic_inc(&_nbrOfCalls[0]); }
+  void countTask1() { atomic_inc(&_nbrOfCalls[1]); }
+  uint32_t getNbrOfCalls(uint8_t taskIndex) const {
+    return static_cast<uint32_t>(atomic_get(&_nbrOfCalls[taskIndex]));
+  }
+
+ private:
+  atomic_t _nbrOfCalls[2] = {ATOMIC_INIT(0), ATOMIC_INIT(0)};
+};
+
+using MemberTaskTTCE = bike_computer::TTCE<bike_computer::MemberTask<Counters>, 2, 2>;
+static MemberTaskTTCE gMemberTaskTTCE(kMinorCycle);
+static Counters gCounters;
+
+ZTEST(ttce, test_member_task_dispatch) {
+  // task 0 runs in both minor cycles and task 1 in the first one only
+  using Task = bike_computer::MemberTask<Counters>;
+  auto res   = gMemberTaskTTCE.addTask(0, Task(&gCounters, &Counters::countTask0));
+  zassert_true(res, "Cannot add task: %d", res.error());
+  res = gMemberTaskTTCE.addTask(0, Task(&gCounters, &Counters::countTask1));
+  zassert_true(res, "Cannot add task: %d", res.error());
+  res = gMemberTaskTTCE.addTask(1, Task(&gCounters, &Counters::countTask0));
+  zassert_true(res, "Cannot add task: %d", res.error());
+  res = gMemberTaskTTCE.addTask(1, Task());
+  zassert_false(res, "Empty task should be rejected");
+
+  zpp_lib::Thread thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, "TTCE");
+  res = thread.start(std::bind(&MemberTaskTTCE::start, &gMemberTaskTTCE));
+  zassert_true(res, "Could not start thread");
+  static constexpr uint32_t kNbrOfMajorCycles = 10;
+  zpp_lib::ThisThread::sleep_for(2 * kMinorCycle * kNbrOfMajorCycles - kMinorCycle / 2);
+  gMemberTaskTTCE.stop();
+
+  zassert_equal(gCounters.getNbrOfCalls(0), 2 * kNbrOfMajorCycles);
+  zassert_equal(gCounters.getNbrOfCalls(1), kNbrOfMajorCycles);
+
+  res = thread.join();
+  zassert_true(res, "Could not join thread");
+}
+
+using MixedCriticalityTTCE = bike_computer::TTCE<std::function<void()>, 2, 2>;
+static MixedCriticalityTTCE gMixedCriticalityTTCE(kMinorCycle);
+static atomic_t gNbrOfHiTaskCalls = ATOMIC_INIT(0);
+static atomic_t gNbrOfLoTaskCalls = ATOMIC_INIT(0);
+
+ZTEST(ttce, test_mode_switch) {
+  using bike_computer::Criticality;
+  // the Hi task exceeds its Lo-mode budget once, at its third call, while its
+  // frame still completes in time
+  static constexpr uint32_t kBudgetOverrunCall              = 2;
+  static constexpr std::chrono::microseconds kHiTaskBudget  = 5ms;
+  static constexpr std::chrono::microseconds kBudgetOverrun = 2 * kHiTaskBudget;
+  // the Lo task of the second frame overruns its frame once, at its first call
+  static constexpr std::chrono::microseconds kFrameOverrun = kMinorCycle + 10ms;
+
+  auto res = gMixedCriticalityTTCE.addTask(
+      0,
+      []() {
+        if (atomic_inc(&gNbrOfHiTaskCalls) == kBudgetOverrunCall) {
+          k_busy_wait(kBudgetOverrun.count());
+        }
+      },
+      Criticality::Hi,
+      kHiTaskBudget);
+  zassert_true(res, "Cannot add task: %d", res.error());
+  // one Lo task per frame
+  res = gMixedCriticalityTTCE.addTask(
+      0, []() { atomic_inc(&gNbrOfLoTaskCalls); }, Criticality::Lo);
+  zassert_true(res, "Cannot add task: %d", res.error());
+  res = gMixedCriticalityTTCE.addTask(
+      1,
+      []() {
+        if (atomic_inc(&gNbrOfLoTaskCalls) == 1) {
+          k_busy_wait(kFrameOverrun.count());
+        }
+      },
+      Criticality::Lo);
+  zassert_true(res, "Cannot add task: %d", res.error());
+
+  zpp_lib::Thread thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, "TTCE");
+  res = thread.start(std::bind(&MixedCriticalityTTCE::start, &gMixedCriticalityTTCE));
+  zassert_true(res, "Could not start thread");
+  zpp_lib::ThisThread::sleep_for(20 * kMinorCycle);
+  gMixedCriticalityTTCE.stop();
+
+  // the frame overrun of the Lo task does not change the mode, the budget overrun
+  // of the Hi task switches to Hi mode and the Lo tasks are shed in each frame
+  // until the Lo mode is restored
+  const auto stats = gMixedCriticalityTTCE.getStats();
+  zassert_equal(stats.nbrOfOverruns, 1);
+  zassert_equal(stats.nbrOfBudgetOverruns, 1);
+  zassert_equal(stats.nbrOfModeSwitches, 2);
+  zassert_true(stats.mode == Criticality::Lo, "Lo mode not restored");
+  zassert_equal(stats.nbrOfShedTasks, MixedCriticalityTTCE::kNbrOfFramesForModeRecovery);
+
+  res = thread.join();
+  zassert_true(res, "Could not join thread");
+}
+
+ZTEST_SUITE(ttce, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+# Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Convert the byte padded 1bpp font tables into packed fonts.
+
+The input is a font implementation file (``fonts<size>.cpp``) whose table
+contains the glyphs from ' ' to '~', each made of ``height`` rows of
+``(width + 7) / 8`` bytes (msb first). Only the characters used by BikeDisplay
+are kept. Each glyph is cropped to its ink bounding box and its rows are
+stored as a continuous bit stream (msb first) without padding.
+
+The output (``font<size>_packed.hpp``) defines a ``PackedFont`` named
+``kFont<size>``.
+
+Usage: font_converter.py <fonts<size>.cpp> [<fonts<size>.cpp> ...]
+"""
+
+import pathlib
+import re
+import sys
+
+LICENSE = """\
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+"""
+
+# digits and signs used for numeric fields and the characters of the title
+CHARACTERS = sorted(set(" -.0123456789" + "Bike Computer"))
+
+
+def parse_font(text):
+    """Return (table, width, height) of the font defined in the file."""
+    table = re.search(r"const uint8_t \w+_Table\[\] = \{(.*?)\};", text, re.S)
+    font = re.search(r"Font\{\w+_Table, (\d+), (\d+)\}", text)
+    if table is None or font is None:
+        raise ValueError("not a font file")
+    # strip the ascii art comments before collecting the bytes
+    values = re.sub(r"/\*.*?\*/|//[^\n]*", "", table.group(1))
+    data = [int(value, 16) for value in re.findall(r"0x[0-9A-Fa-f]{2}", values)]
+    return data, int(font.group(1)), int(font.group(2))
+
+
+def get_glyph_rows(data, width, height, character):
+    bytes_per_row = (width + 7) // 8
+    offset = (ord(character) - ord(" ")) * height * bytes_per_row
+    rows = []
+    for row in range(height):
+        start = offset + row * bytes_per_row
+        bits = int.from_bytes(bytes(data[start:start + bytes_per_row]), "big")
+        rows.append([(bits >> (bytes_per_row * 8 - 1 - column)) & 1
+                     for column in range(width)])
+    return rows
+
+
+def pack_glyph(rows, width, height):
+    """Return (x offset, y offset, width, height, bits) of the cropped glyph."""
+    ink_rows = [row for row in range(height) if any(rows[row])]
+    ink_columns = [column for column in range(width)
+                   if any(rows[row][column] for row in range(height))]
+    if not ink_rows:
+        return 0, 0, 0, 0, []
+    x_offset, y_offset = ink_columns[0], ink_rows[0]
+    glyph_width = ink_columns[-1] - x_offset + 1
+    glyph_height = ink_rows[-1] - y_offset + 1
+    bits = [rows[y_offset + row][x_offset + column]
+            for row in range(glyph_height) for column in range(glyph_width)]
+    return x_offset, y_offset, glyph_width, glyph_height, bits
+
+
+def format_array(values, fmt, per_line):
+    lines = []
+    for start in range(0, len(values), per_line):
+        chunk = values[start:start + per_line]
+        lines.append("    " + ", ".join(fmt.format(value) for value in chunk) + ",")
+    return "\n".join(lines)
+
+
+def convert(path):
+    data, width, height = parse_font(path.read_text(encoding="utf-8"))
+    suffix = path.stem[len("fonts"):]
+
+    glyphs = []
+    bits = []
+    for character in CHARACTERS:
+        x_offset, y_offset, glyph_width, glyph_height, glyph_bits = pack_glyph(
+            get_glyph_rows(data, width, height, character), width, height)
+        glyphs.append((character, x_offset, y_offset, glyph_width, glyph_height,
+                       len(bits)))
+        bits.extend(glyph_bits)
+    if len(bits) > 0xFFFF:
+        raise ValueError(f"{path.name}: bitmap too large for 16 bits offsets")
+    bits.extend([0] * (-len(bits) % 8))
+    bitmap = [int("".join(map(str, bits[index:index + 8])), 2)
+              for index in range(0, len(bits), 8)]
+
+    glyph_lines = "\n".join(
+        f"    {{'{c}', {x}, {y}, {w}, {h}, {offset}}}," for c, x, y, w, h, offset in glyphs)
+    output = path.with_name(f"font{suffix}_packed.hpp")
+    output.write_text(f"""{LICENSE}
+/****************************************************************************
+ * @file {output.name}
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Packed font (size {suffix}) restricted to the characters used by BikeDisplay
+ *        (generated by tools/font_converter.py from {path.name})
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "common/packed_font.hpp"
+
+// clang-format off
+// {len(bitmap)} bytes
+const uint8_t kFont{suffix}Bitmap[] = {{
+{format_array(bitmap, "0x{:02x}", 14)}
+}};
+
+// character, x offset, y offset, width, height, bit offset
+const bike_computer::PackedGlyph kFont{suffix}Glyphs[] = {{
+{glyph_lines}
+}};
+// clang-format on
+
+constexpr bike_computer::PackedFont kFont{suffix} = {{
+    .pGlyphs     = kFont{suffix}Glyphs,
+    .nbrOfGlyphs = sizeof(kFont{suffix}Glyphs) / sizeof(kFont{suffix}Glyphs[0]),
+    .pBitmap     = kFont{suffix}Bitmap,
+    .width       = {width},
+    .height      = {height}}};
+""", encoding="utf-8")
+    table_size = len(data)
+    print(f"{output.name}: {table_size} -> {len(bitmap) + 8 * len(glyphs)} bytes")
+
+
+def main(args):
+    if not args:
+        print(__doc__)
+        return 1
+    for arg in args:
+        convert(pathlib.Path(arg))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+# Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Convert raw ARGB8888 icon headers into palette indexed RLE icon headers.
+
+The input is a header generated for BikeDisplay (``<name>_icon_<size>.hpp``)
+that defines the icon width and height constants and a ``uint32_t`` ARGB array.
+The output (``<name>_icon_<size>_rle.hpp``) defines the same width and height
+constants, the palette and the compressed data, and a ``CompressedImage``
+descriptor named like the original array.
+
+Each row is encoded independently as a sequence of packets. A packet starts
+with a control byte c:
+- if c & 0x80, the next byte is a palette index repeated (c & 0x7F) + 1 times
+- otherwise, the next c + 1 bytes are palette indices
+
+Usage: icon_converter.py <input.hpp> [<input.hpp> ...]
+"""
+
+import pathlib
+import re
+import sys
+
+LICENSE = """\
+// Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+"""
+
+MAX_PACKET_LENGTH = 128
+MIN_RUN_LENGTH = 3
+
+
+def parse_icon(text):
+    """Return (width constant, width, height constant, height, name, pixels)."""
+    width = re.search(r"constexpr uint8_t (k\w+Width)\s*=\s*(\d+);", text)
+    height = re.search(r"constexpr uint8_t (k\w+Height)\s*=\s*(\d+);", text)
+    array = re.search(r"const uint32_t (\w+)\[\] = \{([^}]*)\};", text)
+    if width is None or height is None or array is None:
+        raise ValueError("not an icon header")
+    pixels = [int(value, 16) for value in re.findall(r"0x[0-9A-Fa-f]{8}", array.group(2))]
+    if len(pixels) != int(width.group(2)) * int(height.group(2)):
+        raise ValueError("icon size does not match the array size")
+    return (width.group(1), int(width.group(2)), height.group(1), int(height.group(2)),
+            array.group(1), pixels)
+
+
+def encode_row(row):
+    """Encode one row of palette indices into run and literal packets."""
+    data = []
+    literals = []
+
+    def flush_literals():
+        while literals:
+            packet = literals[:MAX_PACKET_LENGTH]
+            del literals[:MAX_PACKET_LENGTH]
+            data.append(len(packet) - 1)
+            data.extend(packet)
+
+    index = 0
+    while index < len(row):
+        end = index
+        while end < len(row) and row[end] == row[index] and end - index < MAX_PACKET_LENGTH:
+            end += 1
+        if end - index >= MIN_RUN_LENGTH:
+            flush_literals()
+            data.append(0x80 | (end - index - 1))
+            data.append(row[index])
+            index = end
+        else:
+            literals.append(row[index])
+            index += 1
+    flush_literals()
+    return data
+
+
+def format_array(values, fmt, per_line):
+    lines = []
+    for start in range(0, len(values), per_line):
+        chunk = values[start:start + per_line]
+        lines.append("    " + ", ".join(fmt.format(value) for value in chunk) + ",")
+    return "\n".join(lines)
+
+
+def convert(path):
+    text = path.read_text(encoding="utf-8")
+    width_name, width, height_name, height, name, pixels = parse_icon(text)
+
+    palette = sorted(set(pixels))
+    if len(palette) > 256:
+        raise ValueError(f"{path.name}: too many colors ({len(palette)})")
+    indices = {color: index for index, color in enumerate(palette)}
+    data = []
+    for row in range(height):
+        data.extend(encode_row([indices[pixel] for pixel in
+                                pixels[row * width:(row + 1) * width]]))
+
+    output = path.with_name(path.stem + "_rle.hpp")
+    title = re.sub(r"_icon_(\d+)$", r" icon (size \1)", path.stem).capitalize()
+    compressed_size = len(data) + 4 * len(palette)
+    name_length = max(len(width_name), len(height_name))
+    output.write_text(f"""{LICENSE}
+/****************************************************************************
+ * @file {output.name}
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief {title} as palette indexed RLE data
+ *        (generated by tools/icon_converter.py from {path.name})
+ *
+ * @date 2025-07-01
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "common/compressed_image.hpp"
+
+constexpr uint8_t {height_name.ljust(name_length)} = {height};
+constexpr uint8_t {width_name.ljust(name_length)} = {width};
+
+// compressed size is {compressed_size} (raw size is {4 * len(pixels)})
+// clang-format off
+const uint32_t {name}_palette[] = {{
+{format_array(palette, "0x{:08x}", 7)}
+}};
+
+const uint8_t {name}_data[] = {{
+{format_array(data, "0x{:02x}", 14)}
+}};
+// clang-format on
+
+constexpr bike_computer::CompressedImage {name} = {{
+    .pPalette    = {name}_palette,
+    .pData       = {name}_data,
+    .imageWidth  = {width_name},
+    .imageHeight = {height_name}}};
+""", encoding="utf-8")
+    print(f"{output.name}: {4 * len(pixels)} -> {compressed_size} bytes")
+
+
+def main(args):
+    if not args:
+        print(__doc__)
+        return 1
+    for arg in args:
+        convert(pathlib.Path(arg))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,236 @@
+#!/usr/bin/env python3
+# Copyright 2025 Haute école d'ingénierie et d'architecture de Fribourg
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+"""Rebuild the task timeline from the trace events emitted by the bike computer.
+
+The firmware emits named events through the Zephyr tracing backend (see
+src/common/trace_events.hpp):
+- "Phase": all tasks are released (the call numbers restart from 0)
+- "Task start", "Task end", "Task drop", "Task shed": arg0 is the task index
+  and arg1 the call number of the job (a shed job is a Lo task skipped in Hi
+  mode, not a deadline miss)
+- "Mode": mixed-criticality mode change, arg0 is 0 for Lo and 1 for Hi
+- "Frame start", "Frame end", "Frame lost": arg0 is the minor cycle index and
+  arg1 the frame number
+
+The input is either a CTF trace directory (read with the babeltrace2 Python
+bindings, as for the Zephyr CTF backend) or a CSV file with one event per line
+(time_us,name,arg0,arg1), e.g. from a ring buffer dumped over UART.
+
+The release time of job k of task i is phase + k * Ti and its deadline is the
+next release. The tool reports, for each task, the deadline misses, the dropped
+and shed jobs, the worst response time and the start jitter (start - release),
+as well as the mode changes, and optionally renders a Gantt chart (requires
+matplotlib).
+
+Usage: trace_timeline.py [--periods T0,T1,...] [--gantt out.png] <trace>
+"""
+
+import argparse
+import csv
+import math
+import pathlib
+import sys
+
+# bike computer task set (TaskManager::kTaskPeriods), expressed in us
+DEFAULT_PERIODS = [800000, 400000, 1600000, 800000, 1600000, 1600000]
+TASK_NAMES = ["Gear", "Speed", "Temperature", "Reset", "Display(1)", "Display(2)"]
+
+
+def read_ctf(path):
+    """Return the list of (time_us, name, arg0, arg1) named events of a CTF trace."""
+    import bt2  # pylint: disable=import-outside-toplevel
+
+    events = []
+    for msg in bt2.TraceCollectionMessageIterator(str(path)):
+        if type(msg) is not bt2._EventMessageConst:  # pylint: disable=protected-access
+            continue
+        if msg.event.name != "named_event":
+            continue
+        time_us = msg.default_clock_snapshot.ns_from_origin / 1000
+        name = str(msg.event.payload_field["name"])
+        events.append((time_us, name, int(msg.event.payload_field["arg0"]),
+                       int(msg.event.payload_field["arg1"])))
+    return events
+
+
+def read_csv(path):
+    """Return the list of (time_us, name, arg0, arg1) events of a CSV trace."""
+    events = []
+    with open(path, newline="", encoding="utf-8") as file:
+        for row in csv.reader(file):
+            if not row or row[0].startswith("#"):
+                continue
+            events.append((float(row[0]), row[1].strip(), int(row[2]), int(row[3])))
+    return events
+
+
+class Job:  # pylint: disable=too-few-public-methods
+    """One run (or drop) of a task."""
+
+    def __init__(self, task, call, release, period):
+        self.task = task
+        self.call = call
+        self.release = release
+        self.deadline = release + period
+        self.start = None
+        self.end = None
+        self.dropped = False
+        self.shed = False
+
+    @property
+    def is_deadline_miss(self):
+        return self.dropped or (self.end is not None and self.end > self.deadline)
+
+
+def build_timeline(events, periods):
+    """Pair the task events into jobs and the frame events into frames."""
+    phase = None
+    jobs = []
+    running = {}
+    frames = []
+    frame_starts = {}
+    nbr_of_lost_frames = 0
+    mode_changes = []
+    for time_us, name, arg0, arg1 in sorted(events, key=lambda event: event[0]):
+        if name == "Phase":
+            phase = time_us
+            running.clear()
+        elif name == "Mode":
+            mode_changes.append((time_us, "Hi" if arg0 == 1 else "Lo"))
+        elif name in ("Task start", "Task end", "Task drop", "Task shed"):
+            if phase is None or arg0 >= len(periods):
+                continue
+            key = (arg0, arg1)
+            if name == "Task start":
+                job = Job(arg0, arg1, phase + arg1 * periods[arg0], periods[arg0])
+                job.start = time_us
+                running[key] = job
+                jobs.append(job)
+            elif key in running:
+                job = running.pop(key)
+                job.end = time_us
+                job.dropped = name == "Task drop"
+                job.shed = name == "Task shed"
+        elif name == "Frame start":
+            frame_starts[arg1] = (arg0, time_us)
+        elif name == "Frame end" and arg1 in frame_starts:
+            minor_cycle, start = frame_starts.pop(arg1)
+            frames.append((minor_cycle, start, time_us))
+        elif name == "Frame lost":
+            nbr_of_lost_frames += 1
+    return jobs, frames, nbr_of_lost_frames, mode_changes
+
+
+def report(jobs, frames, nbr_of_lost_frames, mode_changes, nbr_of_tasks):
+    """Print the per task statistics and the deadline misses."""
+    print(f"{'task':<12} {'jobs':>5} {'drops':>5} {'sheds':>5} {'misses':>6} "
+          f"{'max resp':>10} "
+          f"{'jitter min':>10} {'max':>10} {'mean':>10} {'stdev':>10}  (us)")
+    for task in range(nbr_of_tasks):
+        all_jobs = [job for job in jobs if job.task == task and job.end is not None]
+        task_jobs = [job for job in all_jobs if not job.shed]
+        sheds = len(all_jobs) - len(task_jobs)
+        name = TASK_NAMES[task] if task < len(TASK_NAMES) else f"Task {task}"
+        if not task_jobs:
+            if sheds > 0:
+                print(f"{name:<12} {0:>5} {0:>5} {sheds:>5} {0:>6}")
+            continue
+        drops = sum(1 for job in task_jobs if job.dropped)
+        misses = sum(1 for job in task_jobs if job.is_deadline_miss)
+        response = max(job.end - job.release for job in task_jobs)
+        jitters = [job.start - job.release for job in task_jobs]
+        mean = sum(jitters) / len(jitters)
+        stdev = math.sqrt(sum((jitter - mean) ** 2 for jitter in jitters) / len(jitters))
+        print(f"{name:<12} {len(task_jobs):>5} {drops:>5} {sheds:>5} {misses:>6} "
+              f"{response:>10.0f} {min(jitters):>10.0f} {max(jitters):>10.0f} "
+              f"{mean:>10.0f} {stdev:>10.0f}")
+
+    for job in jobs:
+        if job.is_deadline_miss:
+            name = TASK_NAMES[job.task] if job.task < len(TASK_NAMES) else job.task
+            if job.dropped:
+                what = "dropped"
+            else:
+                what = f"ended {job.end - job.deadline:.0f} us late"
+            print(f"deadline miss: {name} call #{job.call} {what}")
+
+    for time_us, mode in mode_changes:
+        print(f"mode change: {mode} mode at {time_us:.0f} us")
+
+    if frames:
+        lengths = [end - start for _, start, end in frames]
+        print(f"{len(frames)} frames, longest {max(lengths):.0f} us, "
+              f"{nbr_of_lost_frames} lost")
+
+
+def render_gantt(jobs, frames, nbr_of_tasks, output):
+    """Render the jobs as a Gantt chart (one row per task)."""
+    import matplotlib  # pylint: disable=import-outside-toplevel
+
+    matplotlib.use("Agg")
+    import matplotlib.pyplot as plt  # pylint: disable=import-outside-toplevel
+
+    origin = min(job.start for job in jobs)
+    _, axes = plt.subplots(figsize=(16, 1 + nbr_of_tasks))
+    for job in jobs:
+        if job.end is None or job.shed:
+            continue
+        color = "tab:red" if job.is_deadline_miss else "tab:blue"
+        axes.broken_barh([((job.start - origin) / 1000, (job.end - job.start) / 1000)],
+                         (job.task - 0.4, 0.8), facecolors=color)
+        axes.plot([(job.release - origin) / 1000], [job.task - 0.45], "k^", markersize=3)
+    for _, start, _ in frames:
+        axes.axvline((start - origin) / 1000, color="grey", linewidth=0.5)
+    axes.set_yticks(range(nbr_of_tasks))
+    axes.set_yticklabels(TASK_NAMES[:nbr_of_tasks])
+    axes.invert_yaxis()
+    axes.set_xlabel("time (ms)")
+    plt.tight_layout()
+    plt.savefig(output)
+
+
+def main(args):
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("trace", type=pathlib.Path,
+                        help="CTF trace directory or CSV file")
+    parser.add_argument("--periods", default=",".join(map(str, DEFAULT_PERIODS)),
+                        help="task periods in us, indexed by task index")
+    parser.add_argument("--gantt", type=pathlib.Path, help="output image of the timeline")
+    options = parser.parse_args(args)
+
+    periods = [int(period) for period in options.periods.split(",")]
+    if options.trace.is_dir():
+        events = read_ctf(options.trace)
+    else:
+        events = read_csv(options.trace)
+    jobs, frames, nbr_of_lost_frames, mode_changes = build_timeline(events, periods)
+    if not jobs:
+        print("no task events found in the trace")
+        return 1
+    report(jobs, frames, nbr_of_lost_frames, mode_changes, len(periods))
+    if options.gantt is not None:
+        try:
+            render_gantt(jobs, frames, len(periods), options.gantt)
+        except ImportError:
+            print("matplotlib is required for rendering the Gantt chart")
+            return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -34,8 +34,7 @@ LOG_MODULE_REGISTER(wait_on_button, CONFIG_APP_LOG_LEVEL);
 namespace multi_tasking {
 
 WaitOnButton::WaitOnButton(const char* threadName)
-    : _thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, threadName),
-      _pressedTime(std::chrono::microseconds::zero()) {
+    : _thread(zpp_lib::PreemptableThreadPriority::PriorityNormal, threadName) {
   _pushButton.fall(std::bind(&WaitOnButton::buttonPressed, this));
   LOG_DBG("WaitOnButton initialized");
 }
@@ -63,17 +62,27 @@ void WaitOnButton::waitForButtonEvent() {
   LOG_DBG("Waiting for button press");
   _events.set(kStartedEvent);
 
+  uint32_t nbrOfLostPresses = 0;
   while (true) {
     _events.wait_any(kPressedEvent);
-    std::chrono::microseconds time    = zpp_lib::Time::getUpTime();
-    std::chrono::microseconds latency = time - _pressedTime;
-    LOG_DBG("Button pressed with response time: %lld usecs", latency.count());
+    // presses that occurred while the thread was not waiting are all reported
+    bike_computer::InputEvent press;
+    while (_presses.get(press)) {
+      std::chrono::microseconds time    = zpp_lib::Time::getUpTime();
+      std::chrono::microseconds latency = time - press.time;
+      LOG_DBG("Button pressed with response time: %lld usecs", latency.count());
+    }
+    if (_presses.getNbrOfOverflows() != nbrOfLostPresses) {
+      nbrOfLostPresses = _presses.getNbrOfOverflows();
+      LOG_WRN("%u button presses lost", nbrOfLostPresses);
+    }
     LOG_DBG("Waiting for button press");
   }
 }
 
 void WaitOnButton::buttonPressed() {
-  _pressedTime = zpp_lib::Time::getUpTime();
+  // the press is timestamped when queued
+  (void)_presses.post(bike_computer::InputEvent::Type::ButtonPressed);
   _events.set(kPressedEvent);
 }
 
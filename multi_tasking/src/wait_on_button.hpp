@@ -32,6 +32,9 @@
 #include "zpp_include/interrupt_in.hpp"
 #include "zpp_include/thread.hpp"
 
+// from bike_computer (relative to this file, no include path is needed)
+#include "../../bike_computer/src/common/input_event_queue.hpp"
+
 namespace multi_tasking {
 
 class WaitOnButton {
@@ -46,11 +49,13 @@ class WaitOnButton {
   void waitForButtonEvent();
   void buttonPressed();
 
-  static constexpr uint8_t kPressedEvent = BIT(0);
-  static constexpr uint8_t kStartedEvent = BIT(1);
+  static constexpr uint8_t kPressedEvent    = BIT(0);
+  static constexpr uint8_t kStartedEvent    = BIT(1);
+  static constexpr uint16_t kPressQueueSize = 8;
 
   zpp_lib::Thread _thread;
-  std::chrono::microseconds _pressedTime;
+  // each press is queued with its own time, the event flag only wakes up the thread
+  bike_computer::InputEventQueue<kPressQueueSize> _presses;
   zpp_lib::Events _events;
   zpp_lib::InterruptIn<zpp_lib::PinName::BUTTON1> _pushButton;
 };